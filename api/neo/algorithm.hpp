@@ -0,0 +1,247 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_ALGORITHM_HPP
+#define NEO_ALGORITHM_HPP
+
+#include <neo/saturating.hpp>
+#include <neo/span.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/kernels.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<typename T>
+struct span_lane
+{
+};
+
+template<typename T, typename Policy>
+struct span_lane<value<T, Policy>>
+{
+    using type = T;
+    using policy = Policy;
+};
+
+template<typename T, typename Policy>
+struct span_lane<value<T, Policy> const> : span_lane<value<T, Policy>>
+{
+};
+
+// The fundamental type of the elements of span<T>, where T is a (possibly
+// const) value type, and its arithmetic policy.
+template<typename T>
+using span_lane_t = typename span_lane<T>::type;
+
+template<typename T>
+using span_policy_t = typename span_lane<T>::policy;
+
+template<typename A, typename B>
+using span_wider_t = value<wider_t<span_lane_t<A>, span_lane_t<B>>, span_policy_t<A>>;
+
+template<typename A, typename B, typename = void>
+struct are_similar_spans : std::false_type
+{
+};
+
+template<typename A, typename B>
+struct are_similar_spans<A, B, void_t<span_wider_t<A, B>>> : std::integral_constant<bool,
+        are_similar_numeric<span_lane_t<A>, span_lane_t<B>>::value &&
+        std::is_same<span_policy_t<A>, span_policy_t<B>>::value
+    >
+{
+};
+
+// The kernel operation that implements `Op` for values with arithmetic policy
+// `Policy`, if there is one.
+template<typename Policy, typename Op>
+struct span_op
+{
+};
+
+template<typename Op>
+struct span_op<policy::unchecked, Op>
+{
+    using type = Op;
+};
+
+template<>
+struct span_op<policy::saturating, add_op>
+{
+    using type = saturating_add_op;
+};
+
+template<>
+struct span_op<policy::saturating, sub_op>
+{
+    using type = saturating_sub_op;
+};
+
+template<>
+struct span_op<policy::saturating, min_op>
+{
+    using type = min_op;
+};
+
+template<>
+struct span_op<policy::saturating, max_op>
+{
+    using type = max_op;
+};
+
+template<typename A, typename Op>
+using span_op_t = typename span_op<span_policy_t<A>, Op>::type;
+
+template<typename A, typename B, typename Op, typename = void>
+struct are_transformable_spans : std::false_type
+{
+};
+
+template<typename A, typename B, typename Op>
+struct are_transformable_spans<A, B, Op, void_t<span_op_t<A, Op>>> : are_similar_spans<A, B>
+{
+};
+
+template<typename A>
+struct is_unchecked_span : std::is_same<span_policy_t<A>, policy::unchecked>
+{
+};
+
+template<typename T, typename Policy>
+T const* lanes(value<T, Policy> const* p) noexcept
+{
+    return reinterpret_cast<T const*>(p);
+}
+
+template<typename T, typename Policy>
+T* lanes(value<T, Policy>* p) noexcept
+{
+    return reinterpret_cast<T*>(p);
+}
+
+template<typename Op, typename A, typename B, typename R, typename Policy>
+void transform(span<A> a, span<B> b, span<value<R, Policy>> out) noexcept
+{
+    using kernel = transform_kernel<R, typename span_op<Policy, Op>::type>;
+
+    dispatch<kernel>::call(lanes(a.data()), lanes(b.data()), lanes(out.data()), out.size());
+}
+
+} // namespace detail
+
+// Span Kernels
+//--------------
+//
+// Element-wise operations over contiguous ranges of values, using the widest
+// vector instructions the processor supports. As with the operators of
+// value<T>, the operands must be similar, and results have the wider of the
+// two types: combining spans of int16 and int32 gives int32. Transforms of
+// saturating values saturate, and the other kernels take unchecked values.
+
+// Assigns `a[i] + b[i]` to each `out[i]`. `a`, `b` and `out` must have the same
+// size, and `out` may be the same range as `a` or `b`.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_transformable_spans<A, B, detail::add_op>::value>
+>
+void transform_add(span<A> a, span<B> b, span<detail::span_wider_t<A, B>> out) noexcept
+{
+    detail::transform<detail::add_op>(a, b, out);
+}
+
+// Assigns `a[i] - b[i]` to each `out[i]`.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_transformable_spans<A, B, detail::sub_op>::value>
+>
+void transform_sub(span<A> a, span<B> b, span<detail::span_wider_t<A, B>> out) noexcept
+{
+    detail::transform<detail::sub_op>(a, b, out);
+}
+
+// Assigns `a[i] * b[i]` to each `out[i]`.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_transformable_spans<A, B, detail::mul_op>::value>
+>
+void transform_mul(span<A> a, span<B> b, span<detail::span_wider_t<A, B>> out) noexcept
+{
+    detail::transform<detail::mul_op>(a, b, out);
+}
+
+// Assigns the lesser of `a[i]` and `b[i]` to each `out[i]`, or `b[i]` if
+// either is NaN.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_transformable_spans<A, B, detail::min_op>::value>
+>
+void transform_min(span<A> a, span<B> b, span<detail::span_wider_t<A, B>> out) noexcept
+{
+    detail::transform<detail::min_op>(a, b, out);
+}
+
+// Assigns the greater of `a[i]` and `b[i]` to each `out[i]`, or `b[i]` if
+// either is NaN.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_transformable_spans<A, B, detail::max_op>::value>
+>
+void transform_max(span<A> a, span<B> b, span<detail::span_wider_t<A, B>> out) noexcept
+{
+    detail::transform<detail::max_op>(a, b, out);
+}
+
+// Returns the sum of the elements of `a`. Floating-point elements are added in
+// an unspecified order.
+template<typename A, typename T = detail::span_lane_t<A>, typename = detail::enable_if_t<
+    detail::is_unchecked_span<A>::value>
+>
+value<T> sum(span<A> a) noexcept
+{
+    return detail::dispatch<detail::sum_kernel<T>>::call(detail::lanes(a.data()), a.size());
+}
+
+// Returns the sum of `a[i] * b[i]`, computed in the wider of the two types.
+// `a` and `b` must have the same size.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_similar_spans<A, B>::value && detail::is_unchecked_span<A>::value>
+>
+detail::span_wider_t<A, B> dot(span<A> a, span<B> b) noexcept
+{
+    using result = detail::wider_t<detail::span_lane_t<A>, detail::span_lane_t<B>>;
+
+    return detail::dispatch<detail::dot_kernel<result>>::call(
+            detail::lanes(a.data()), detail::lanes(b.data()), a.size());
+}
+
+// Compares `a` and `b` lexicographically, returning a negative value if `a`
+// is less, zero if they are equivalent, and a positive value if `a` is
+// greater. As with std::lexicographical_compare, elements are equivalent if
+// neither is less than the other.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_similar_spans<A, B>::value>
+>
+int_ compare(span<A> a, span<B> b) noexcept
+{
+    using lane = detail::wider_t<detail::span_lane_t<A>, detail::span_lane_t<B>>;
+
+    std::size_t const count = a.size() < b.size() ? a.size() : b.size();
+    std::size_t const i = detail::dispatch<detail::mismatch_kernel<lane>>::call(
+            detail::lanes(a.data()), detail::lanes(b.data()), count);
+
+    if (i != count)
+    {
+        return a[i] < b[i] ? -1 : 1;
+    }
+
+    return a.size() < b.size() ? -1 : b.size() < a.size() ? 1 : 0;
+}
+
+} // namespace neo
+
+#endif // NEO_ALGORITHM_HPP
@@ -0,0 +1,290 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_ATOMIC_HPP
+#define NEO_ATOMIC_HPP
+
+#include <neo/value.hpp>
+#include <neo/wrapping.hpp>
+
+#include <neo/detail/atomic.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Whether the arithmetic of `Policy` on T is what the hardware does, so that
+// fetch_add and fetch_sub are single instructions.
+template<typename T, typename Policy>
+struct has_atomic_arithmetic : std::integral_constant<bool,
+        is_integral<T>::value &&
+        !is_same<T, bool>::value &&
+        (std::is_same<Policy, policy::unchecked>::value || std::is_same<Policy, policy::wrapping>::value)
+    >
+{
+};
+
+} // namespace detail
+
+template<typename T>
+class atomic_ref;
+
+template<typename T>
+class atomic;
+
+// Atomic References
+//-------------------
+//
+// Atomic operations on a value<T, Policy> which was not declared atomic, such
+// as an element of an array which is only shared between threads for part of
+// its lifetime. The value must be aligned to `required_alignment`, and while
+// any atomic_ref to it exists, it must only be accessed through them.
+//
+// Operands convert to value<T, Policy> by the rules of value.hpp, so they
+// cannot narrow or mix policies, and, as for the compound assignment
+// operators, fetch_add and fetch_sub are only provided for numeric types, and
+// the bitwise operations only for unsigned integral types. Arithmetic follows
+// `Policy`: with policy::unchecked and policy::wrapping, integer operations are
+// single instructions (e.g. LOCK XADD on x86), and with other policies, or
+// floating-point types, they are compare-exchange loops.
+template<typename T, typename Policy>
+class atomic_ref<value<T, Policy>>
+{
+public:
+    using value_type = value<T, Policy>;
+
+    static constexpr std::size_t required_alignment = detail::atomic_access<T>::required_alignment;
+
+private:
+    using access = detail::atomic_access<T>;
+    using native = detail::has_atomic_arithmetic<T, Policy>;
+
+    T* m_object;
+
+public:
+    explicit atomic_ref(value_type& object) noexcept :
+        m_object(reinterpret_cast<T*>(&object))
+    {
+    }
+
+    atomic_ref(atomic_ref const&) noexcept = default;
+    atomic_ref& operator=(atomic_ref const&) = delete;
+
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return access::load(m_object, order);
+    }
+
+    void store(value_type const& desired, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        access::store(m_object, desired.get(), order);
+    }
+
+    value_type exchange(value_type const& desired, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return access::exchange(m_object, desired.get(), order);
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type const& desired,
+            std::memory_order success, std::memory_order failure) const noexcept
+    {
+        return access::compare_exchange_weak(m_object, *reinterpret_cast<T*>(&expected), desired.get(), success, failure);
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type const& desired,
+            std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return compare_exchange_weak(expected, desired, order, detail::failure_order(order));
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type const& desired,
+            std::memory_order success, std::memory_order failure) const noexcept
+    {
+        return access::compare_exchange_strong(m_object, *reinterpret_cast<T*>(&expected), desired.get(), success, failure);
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type const& desired,
+            std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return compare_exchange_strong(expected, desired, order, detail::failure_order(order));
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    value_type fetch_add(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) const noexcept(Policy::is_nothrow)
+    {
+        return detail::atomic_fetch_add<Policy>(m_object, arg.get(), order, native());
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    value_type fetch_sub(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) const noexcept(Policy::is_nothrow)
+    {
+        return detail::atomic_fetch_sub<Policy>(m_object, arg.get(), order, native());
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    value_type fetch_and(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return access::fetch_and(m_object, arg.get(), order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    value_type fetch_or(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return access::fetch_or(m_object, arg.get(), order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    value_type fetch_xor(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return access::fetch_xor(m_object, arg.get(), order);
+    }
+
+    bool is_lock_free() const noexcept
+    {
+        return access::is_lock_free();
+    }
+};
+
+template<typename T, typename Policy>
+constexpr std::size_t atomic_ref<value<T, Policy>>::required_alignment;
+
+// Atomic Values
+//---------------
+//
+// A value<T, Policy> with the operations of atomic_ref. Like value<T>, it is
+// zero by default.
+template<typename T, typename Policy>
+class atomic<value<T, Policy>>
+{
+public:
+    using value_type = value<T, Policy>;
+
+private:
+    alignas(atomic_ref<value_type>::required_alignment) value_type m_value;
+
+    atomic_ref<value_type> ref() const noexcept
+    {
+        return atomic_ref<value_type>(const_cast<value_type&>(m_value));
+    }
+
+public:
+    constexpr atomic() noexcept :
+        m_value()
+    {
+    }
+
+    constexpr atomic(value_type const& desired) noexcept :
+        m_value(desired)
+    {
+    }
+
+    atomic(atomic const&) = delete;
+    atomic& operator=(atomic const&) = delete;
+
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return ref().load(order);
+    }
+
+    void store(value_type const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        ref().store(desired, order);
+    }
+
+    value_type exchange(value_type const& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return ref().exchange(desired, order);
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type const& desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return ref().compare_exchange_weak(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_weak(value_type& expected, value_type const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return ref().compare_exchange_weak(expected, desired, order);
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type const& desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return ref().compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_strong(value_type& expected, value_type const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return ref().compare_exchange_strong(expected, desired, order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    value_type fetch_add(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept(Policy::is_nothrow)
+    {
+        return ref().fetch_add(arg, order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    value_type fetch_sub(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept(Policy::is_nothrow)
+    {
+        return ref().fetch_sub(arg, order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    value_type fetch_and(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return ref().fetch_and(arg, order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    value_type fetch_or(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return ref().fetch_or(arg, order);
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    value_type fetch_xor(value_type const& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return ref().fetch_xor(arg, order);
+    }
+
+    bool is_lock_free() const noexcept
+    {
+        return ref().is_lock_free();
+    }
+};
+
+} // namespace neo
+
+#endif // NEO_ATOMIC_HPP
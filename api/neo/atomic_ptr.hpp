@@ -0,0 +1,261 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_ATOMIC_PTR_HPP
+#define NEO_ATOMIC_PTR_HPP
+
+#include <neo/ptr.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/atomic_ptr.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace neo
+{
+
+// Atomic Pointers
+//-----------------
+//
+// A ptr<T> which can be loaded, stored and exchanged atomically. Like ptr<T>,
+// it is null by default. A failed compare-exchange updates `expected` with the
+// current pointer.
+template<typename T>
+class atomic_ptr
+{
+public:
+    using element_type = T;
+    using pointer = element_type*;
+
+private:
+    std::atomic<pointer> m_value;
+
+public:
+    constexpr atomic_ptr() noexcept :
+        atomic_ptr(nullptr)
+    {
+    }
+
+    constexpr atomic_ptr(std::nullptr_t) noexcept :
+        m_value(nullptr)
+    {
+    }
+
+    constexpr atomic_ptr(pointer value) noexcept :
+        m_value(value)
+    {
+    }
+
+    atomic_ptr(ptr<T> const& value) noexcept :
+        m_value(value.get())
+    {
+    }
+
+    atomic_ptr(atomic_ptr const&) = delete;
+    atomic_ptr& operator=(atomic_ptr const&) = delete;
+
+    ptr<T> load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return m_value.load(order);
+    }
+
+    void store(ptr<T> const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        m_value.store(value.get(), order);
+    }
+
+    ptr<T> exchange(ptr<T> const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return m_value.exchange(value.get(), order);
+    }
+
+    bool compare_exchange_weak(ptr<T>& expected, ptr<T> const& desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        pointer e = expected.get();
+        bool const result = m_value.compare_exchange_weak(e, desired.get(), success, failure);
+        expected = e;
+        return result;
+    }
+
+    bool compare_exchange_weak(ptr<T>& expected, ptr<T> const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        pointer e = expected.get();
+        bool const result = m_value.compare_exchange_weak(e, desired.get(), order);
+        expected = e;
+        return result;
+    }
+
+    bool compare_exchange_strong(ptr<T>& expected, ptr<T> const& desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        pointer e = expected.get();
+        bool const result = m_value.compare_exchange_strong(e, desired.get(), success, failure);
+        expected = e;
+        return result;
+    }
+
+    bool compare_exchange_strong(ptr<T>& expected, ptr<T> const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        pointer e = expected.get();
+        bool const result = m_value.compare_exchange_strong(e, desired.get(), order);
+        expected = e;
+        return result;
+    }
+
+    bool is_lock_free() const noexcept
+    {
+        return m_value.is_lock_free();
+    }
+};
+
+// Versioned Pointers
+//--------------------
+//
+// A pointer and the number of times that the atomic_versioned_ptr it was
+// loaded from had been changed.
+template<typename T>
+struct versioned_ptr
+{
+    ptr<T> pointer;
+    value<std::uint64_t> version;
+};
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator==(versioned_ptr<T1> const& lhs, versioned_ptr<T2> const& rhs) noexcept
+{
+    return lhs.pointer.get() == rhs.pointer.get() && lhs.version.get() == rhs.version.get();
+}
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator!=(versioned_ptr<T1> const& lhs, versioned_ptr<T2> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+// An atomic_ptr<T> which is immune to the ABA problem: every change increments
+// a 64-bit version, and a compare-exchange only succeeds if both the pointer
+// and the version are unchanged, so a pointer that was popped from a lock-free
+// stack and pushed again is not mistaken for the one that was loaded. On
+// x86-64 targets with CMPXCHG16B, the pointer and version are exchanged
+// together with it; elsewhere, they are exchanged by std::atomic.
+//
+// Unlike a version packed into the unused bits of the pointer, which has at
+// most 16-19 bits on x86-64 and can wrap while a thread is preempted, a 64-bit
+// version never wraps in practice.
+template<typename T>
+class atomic_versioned_ptr
+{
+public:
+    using element_type = T;
+    using pointer = element_type*;
+    using value_type = versioned_ptr<T>;
+
+private:
+    detail::atomic_versioned_words m_words;
+
+    static detail::versioned_words to_words(ptr<T> const& p, std::uint64_t version) noexcept
+    {
+        return { static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(p.get())), version };
+    }
+
+    static value_type from_words(detail::versioned_words const& w) noexcept
+    {
+        return { reinterpret_cast<pointer>(static_cast<std::uintptr_t>(w.pointer)), w.version };
+    }
+
+public:
+    atomic_versioned_ptr() noexcept :
+        atomic_versioned_ptr(nullptr)
+    {
+    }
+
+    atomic_versioned_ptr(ptr<T> const& value) noexcept :
+        m_words(to_words(value, 0u))
+    {
+    }
+
+    atomic_versioned_ptr(std::nullptr_t) noexcept :
+        m_words(detail::versioned_words{0u, 0u})
+    {
+    }
+
+    atomic_versioned_ptr(pointer value) noexcept :
+        atomic_versioned_ptr(ptr<T>(value))
+    {
+    }
+
+    atomic_versioned_ptr(atomic_versioned_ptr const&) = delete;
+    atomic_versioned_ptr& operator=(atomic_versioned_ptr const&) = delete;
+
+    // The pointer and version may be loaded separately, and so may not have
+    // been current at the same time, but a compare-exchange which expects
+    // them fails and loads a pair which was.
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return from_words(m_words.load(order));
+    }
+
+    void store(ptr<T> const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        exchange(value, order);
+    }
+
+    value_type exchange(ptr<T> const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        value_type expected = load(std::memory_order_relaxed);
+        while (!compare_exchange_weak(expected, value, order, std::memory_order_relaxed))
+        {
+        }
+        return expected;
+    }
+
+    // The exchange stores `desired` with the version after `expected`. It
+    // never fails spuriously, and is always sequentially consistent.
+    bool compare_exchange_weak(value_type& expected, ptr<T> const& desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    bool compare_exchange_weak(value_type& expected, ptr<T> const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, order);
+    }
+
+    bool compare_exchange_strong(value_type& expected, ptr<T> const& desired,
+            std::memory_order, std::memory_order) noexcept
+    {
+        detail::versioned_words e = to_words(expected.pointer, expected.version.get());
+        bool const result = m_words.compare_exchange(e, to_words(desired, e.version + 1u));
+        expected = from_words(e);
+        return result;
+    }
+
+    bool compare_exchange_strong(value_type& expected, ptr<T> const& desired,
+            std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, order, order);
+    }
+
+    bool is_lock_free() const noexcept
+    {
+        return m_words.is_lock_free();
+    }
+};
+
+} // namespace neo
+
+#endif // NEO_ATOMIC_PTR_HPP
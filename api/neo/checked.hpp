@@ -0,0 +1,190 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_CHECKED_HPP
+#define NEO_CHECKED_HPP
+
+#include <neo/value.hpp>
+
+#include <neo/detail/overflow.hpp>
+
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+struct throwing_handler
+{
+    static constexpr bool is_nothrow = false;
+
+    [[noreturn]] static void overflow()
+    {
+        throw std::overflow_error("neo::checked: integer overflow");
+    }
+
+    [[noreturn]] static void division_by_zero()
+    {
+        throw std::domain_error("neo::checked: division by zero");
+    }
+};
+
+struct trapping_handler
+{
+    static constexpr bool is_nothrow = true;
+
+    [[noreturn]] static void overflow() noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_trap();
+#else
+        std::abort();
+#endif
+    }
+
+    [[noreturn]] static void division_by_zero() noexcept
+    {
+        overflow();
+    }
+};
+
+// Integer arithmetic which calls Handler::overflow() if the result is not
+// representable in the operand type, and Handler::division_by_zero() on
+// division by zero.
+template<typename Handler>
+struct checking
+{
+    static constexpr bool is_nothrow = Handler::is_nothrow;
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T add(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        T result;
+
+        if (add_overflow(lhs, rhs, result))
+        {
+            Handler::overflow();
+        }
+
+        return result;
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T sub(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        T result;
+
+        if (sub_overflow(lhs, rhs, result))
+        {
+            Handler::overflow();
+        }
+
+        return result;
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T mul(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        T result;
+
+        if (mul_overflow(lhs, rhs, result))
+        {
+            Handler::overflow();
+        }
+
+        return result;
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T div(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        if (rhs == 0)
+        {
+            Handler::division_by_zero();
+        }
+
+        if (is_signed<T>::value && lhs == numeric_limits<T>::min() && rhs == static_cast<T>(-1))
+        {
+            Handler::overflow();
+        }
+
+        return static_cast<T>(lhs / rhs);
+    }
+
+    // The remainder of the minimum value and -1 is 0, even though the quotient
+    // overflows.
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T mod(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        if (rhs == 0)
+        {
+            Handler::division_by_zero();
+        }
+
+        if (is_signed<T>::value && rhs == static_cast<T>(-1))
+        {
+            return 0;
+        }
+
+        return static_cast<T>(lhs % rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T neg(T x) noexcept(is_nothrow)
+    {
+        return sub(static_cast<T>(0), x);
+    }
+};
+
+} // namespace detail
+
+namespace policy
+{
+
+// Throws std::overflow_error on overflow and std::domain_error on division by
+// zero. Floating-point arithmetic is unchecked.
+struct checked : detail::float_passthrough<detail::checking<detail::throwing_handler>>
+{
+};
+
+// Terminates the program with a trap instruction on overflow or division by
+// zero. Unlike checked, it needs no exception support, and the failure path
+// is a single instruction. Floating-point arithmetic is unchecked.
+struct trapping : detail::float_passthrough<detail::checking<detail::trapping_handler>>
+{
+};
+
+} // namespace policy
+
+// Checked Arithmetic
+//--------------------
+//
+// A value whose +, -, * and / throw std::overflow_error instead of wrapping or
+// invoking undefined behaviour. As with value<T>, operands are not promoted,
+// so `checked<std::uint8_t>` addition overflows above 255. Checked values do
+// not mix with unchecked values in expressions, but convert to and from them
+// explicitly.
+template<typename T>
+using checked = value<T, policy::checked>;
+
+template<typename T>
+constexpr checked<T> make_checked(T const& v) noexcept
+{
+    return checked<T>(v);
+}
+
+// A value whose arithmetic is checked like that of checked<T>, but which traps
+// instead of throwing.
+template<typename T>
+using trapping = value<T, policy::trapping>;
+
+} // namespace neo
+
+#endif // NEO_CHECKED_HPP
@@ -0,0 +1,268 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_COMPRESSED_PTR_HPP
+#define NEO_COMPRESSED_PTR_HPP
+
+#include <neo/ptr.hpp>
+#include <neo/traits.hpp>
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+
+namespace neo
+{
+
+// Arenas
+//--------
+//
+// A region of memory of at most 4 GiB, identified by `Tag`, whose base address
+// is registered at runtime, and which compressed pointers address by offset.
+// Every compressed pointer into the arena is relative to the base, so it must
+// not be changed while any of them are in use.
+template<typename Tag>
+class arena
+{
+private:
+    static char* s_base;
+
+public:
+    static constexpr std::uint64_t max_size = 0xffffffffu;
+
+    static void set_base(void* base) noexcept
+    {
+        s_base = static_cast<char*>(base);
+    }
+
+    static char* base() noexcept
+    {
+        return s_base;
+    }
+};
+
+template<typename Tag>
+char* arena<Tag>::s_base = nullptr;
+
+template<typename Tag>
+constexpr std::uint64_t arena<Tag>::max_size;
+
+// Compressed Pointers
+//---------------------
+//
+// A ptr<T> to an object in `Arena`, stored as a 32-bit offset from the base of
+// the arena, so it is half the size of a pointer on 64-bit platforms. `Arena`
+// is any class with a static function base(), such as arena<Tag>. The offset
+// is stored plus one, so that, like ptr<T>, a compressed pointer is null by
+// default, and null is represented by zero bits. Pointers assigned to it must
+// be null or point into the arena.
+template<typename T, typename Arena>
+class compressed_ptr
+{
+public:
+    using element_type = T;
+    using pointer = element_type*;
+    using arena_type = Arena;
+
+private:
+    std::uint32_t m_value;
+
+    static std::uint32_t compress(pointer value) noexcept
+    {
+        return value == nullptr ? 0u :
+            static_cast<std::uint32_t>(reinterpret_cast<char const volatile*>(value) - Arena::base() + 1);
+    }
+
+    // The address of the object, which must not be null, so no check is
+    // needed. The base is offset by one before the offset is added, so in a
+    // loop, that can be done once, and each address is a single addition.
+    pointer address() const noexcept
+    {
+        return reinterpret_cast<pointer>((reinterpret_cast<std::uintptr_t>(Arena::base()) - 1u) + m_value);
+    }
+
+    // Pointers which differ only in qualification have the same offset.
+    template<typename U>
+    static std::uint32_t convert(compressed_ptr<U, Arena> const& other) noexcept
+    {
+        return std::is_same<detail::remove_cv_t<U>, detail::remove_cv_t<T>>::value ?
+            other.raw() : compress(other.get());
+    }
+
+public:
+    constexpr compressed_ptr() noexcept :
+        compressed_ptr(nullptr)
+    {
+    }
+
+    constexpr compressed_ptr(std::nullptr_t) noexcept :
+        m_value()
+    {
+    }
+
+    compressed_ptr(undefined_t) noexcept
+    {
+    }
+
+    compressed_ptr(pointer value) noexcept :
+        m_value(compress(value))
+    {
+    }
+
+    compressed_ptr& operator=(pointer value) noexcept
+    {
+        m_value = compress(value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_convertible<U*, T*>::value>
+    >
+    compressed_ptr(compressed_ptr<U, Arena> const& other) noexcept :
+        m_value(convert(other))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_convertible<U*, T*>::value>
+    >
+    compressed_ptr& operator=(compressed_ptr<U, Arena> const& other) noexcept
+    {
+        m_value = convert(other);
+        return *this;
+    }
+
+    operator pointer() const noexcept
+    {
+        return get();
+    }
+
+    operator ptr<T>() const noexcept
+    {
+        return get();
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return m_value != 0u;
+    }
+
+    constexpr explicit operator value<bool>() const noexcept
+    {
+        return static_cast<bool>(*this);
+    }
+
+    element_type& operator*() const noexcept
+    {
+        return *address();
+    }
+
+    pointer operator->() const noexcept
+    {
+        return address();
+    }
+
+    pointer get() const noexcept
+    {
+        return m_value == 0u ? nullptr : address();
+    }
+
+    // The offset from the base of the arena, plus one, or zero if null.
+    constexpr std::uint32_t raw() const noexcept
+    {
+        return m_value;
+    }
+};
+
+// The null pointer is represented by all-zero bits.
+template<typename T, typename Arena>
+struct is_zero_initialized_by_default<compressed_ptr<T, Arena>> : std::true_type
+{
+};
+
+template<typename T1, typename T2, typename Arena, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator==(compressed_ptr<T1, Arena> const& lhs, compressed_ptr<T2, Arena> const& rhs) noexcept
+{
+    return lhs.get() == rhs.get();
+}
+
+template<typename T1, typename T2, typename Arena, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator!=(compressed_ptr<T1, Arena> const& lhs, compressed_ptr<T2, Arena> const& rhs) noexcept
+{
+    return lhs.get() != rhs.get();
+}
+
+template<typename T1, typename T2, typename Arena, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator<(compressed_ptr<T1, Arena> const& lhs, compressed_ptr<T2, Arena> const& rhs) noexcept
+{
+    return std::less<detail::common_type_t<T1*, T2*>>()(lhs.get(), rhs.get());
+}
+
+template<typename T1, typename T2, typename Arena, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator<=(compressed_ptr<T1, Arena> const& lhs, compressed_ptr<T2, Arena> const& rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+template<typename T1, typename T2, typename Arena, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator>(compressed_ptr<T1, Arena> const& lhs, compressed_ptr<T2, Arena> const& rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+template<typename T1, typename T2, typename Arena, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator>=(compressed_ptr<T1, Arena> const& lhs, compressed_ptr<T2, Arena> const& rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+template<typename T, typename Arena>
+std::ostream& operator<<(std::ostream& s, compressed_ptr<T, Arena> const& v)
+{
+    s << v.get();
+    return s;
+}
+
+template<typename Arena, typename T>
+compressed_ptr<T, Arena> make_compressed_ptr(T* object) noexcept
+{
+    return object;
+}
+
+} // namespace neo
+
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+
+namespace std
+{
+
+template<typename T, typename Arena>
+struct __is_bitwise_relocatable<neo::compressed_ptr<T, Arena>> :
+    neo::is_trivially_relocatable<neo::compressed_ptr<T, Arena>>
+{
+};
+
+} // namespace std
+
+#endif
+
+#endif // NEO_COMPRESSED_PTR_HPP
@@ -0,0 +1,252 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_CPU_HPP
+#define NEO_CPU_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define NEO_DETAIL_CPU_X86
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define NEO_DETAIL_CPU_X86
+#endif
+
+namespace neo
+{
+
+namespace cpu
+{
+
+// The instruction sets that Neo kernels are compiled for, in increasing order
+// of capability.
+enum class isa
+{
+    generic,
+    sse2,
+    avx2,
+    avx512
+};
+
+// The processor features detected with CPUID. A feature is only reported if
+// the operating system also saves the registers it uses.
+struct features
+{
+    bool sse2;
+    bool sse41;
+    bool avx;
+    bool avx2;
+    bool fma;
+    bool f16c;
+    bool bmi2;
+    bool avx512f;
+    bool avx512bw;
+    bool avx512dq;
+    bool avx512vl;
+};
+
+inline char const* name(isa i) noexcept
+{
+    switch (i)
+    {
+    case isa::sse2:
+        return "sse2";
+    case isa::avx2:
+        return "avx2";
+    case isa::avx512:
+        return "avx512";
+    default:
+        return "generic";
+    }
+}
+
+} // namespace cpu
+
+namespace detail
+{
+
+#if defined(NEO_DETAIL_CPU_X86)
+
+struct cpuid_result
+{
+    unsigned eax;
+    unsigned ebx;
+    unsigned ecx;
+    unsigned edx;
+};
+
+inline cpuid_result cpuid(unsigned leaf, unsigned subleaf) noexcept
+{
+    cpuid_result r = {};
+
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+    r.eax = static_cast<unsigned>(regs[0]);
+    r.ebx = static_cast<unsigned>(regs[1]);
+    r.ecx = static_cast<unsigned>(regs[2]);
+    r.edx = static_cast<unsigned>(regs[3]);
+#else
+    __get_cpuid_count(leaf, subleaf, &r.eax, &r.ebx, &r.ecx, &r.edx);
+#endif
+
+    return r;
+}
+
+// Returns the register state that the operating system saves (XCR0).
+inline unsigned long long xgetbv() noexcept
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax;
+    unsigned edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+
+inline bool bit(unsigned reg, int index) noexcept
+{
+    return ((reg >> index) & 1u) != 0;
+}
+
+#endif
+
+inline cpu::features detect_features() noexcept
+{
+    cpu::features f = {};
+
+#if defined(NEO_DETAIL_CPU_X86)
+    unsigned const max_leaf = cpuid(0, 0).eax;
+
+    if (max_leaf < 1)
+    {
+        return f;
+    }
+
+    cpuid_result const leaf1 = cpuid(1, 0);
+    cpuid_result const leaf7 = max_leaf >= 7 ? cpuid(7, 0) : cpuid_result();
+
+    unsigned long long const xcr0 = bit(leaf1.ecx, 27) ? xgetbv() : 0;
+    bool const avx_state = (xcr0 & 0x06) == 0x06;
+    bool const avx512_state = (xcr0 & 0xe6) == 0xe6;
+
+    f.sse2 = bit(leaf1.edx, 26);
+    f.sse41 = bit(leaf1.ecx, 19);
+    f.avx = avx_state && bit(leaf1.ecx, 28);
+    f.avx2 = f.avx && bit(leaf7.ebx, 5);
+    f.fma = f.avx && bit(leaf1.ecx, 12);
+    f.f16c = f.avx && bit(leaf1.ecx, 29);
+    f.bmi2 = bit(leaf7.ebx, 8);
+    f.avx512f = avx512_state && bit(leaf7.ebx, 16);
+    f.avx512dq = f.avx512f && bit(leaf7.ebx, 17);
+    f.avx512bw = f.avx512f && bit(leaf7.ebx, 30);
+    f.avx512vl = f.avx512f && bit(leaf7.ebx, 31);
+#endif
+
+    return f;
+}
+
+inline cpu::isa isa_of(cpu::features const& f) noexcept
+{
+    if (f.avx512f && f.avx512bw && f.avx512dq && f.avx512vl && f.avx2)
+    {
+        return cpu::isa::avx512;
+    }
+
+    if (f.avx2)
+    {
+        return cpu::isa::avx2;
+    }
+
+    if (f.sse2)
+    {
+        return cpu::isa::sse2;
+    }
+
+    return cpu::isa::generic;
+}
+
+// Parses an instruction set name, returning false if it is not recognized.
+inline bool parse_isa(char const* name, cpu::isa& result) noexcept
+{
+    for (int i = 0; i <= static_cast<int>(cpu::isa::avx512); ++i)
+    {
+        if (std::strcmp(name, cpu::name(static_cast<cpu::isa>(i))) == 0)
+        {
+            result = static_cast<cpu::isa>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Applies an override naming a lower instruction set, ignoring overrides which
+// are unrecognized or name an instruction set the processor lacks.
+inline cpu::isa override_isa(cpu::isa detected, char const* name) noexcept
+{
+    cpu::isa requested;
+
+    if (name && parse_isa(name, requested) && requested < detected)
+    {
+        return requested;
+    }
+
+    return detected;
+}
+
+inline cpu::isa select_isa(cpu::features const& f) noexcept
+{
+#if defined(_MSC_VER)
+    char* name = nullptr;
+    std::size_t size = 0;
+    _dupenv_s(&name, &size, "NEO_CPU_ISA");
+    cpu::isa const isa = override_isa(isa_of(f), name);
+    std::free(name);
+    return isa;
+#else
+    return override_isa(isa_of(f), std::getenv("NEO_CPU_ISA"));
+#endif
+}
+
+} // namespace detail
+
+namespace cpu
+{
+
+// Returns the features of the processor, detected on first call.
+inline features const& detected_features() noexcept
+{
+    static features const f = detail::detect_features();
+    return f;
+}
+
+// Returns the most capable instruction set the processor supports.
+inline isa detected_isa() noexcept
+{
+    return detail::isa_of(detected_features());
+}
+
+// Returns the instruction set that Neo kernels use. This is detected_isa(),
+// unless the NEO_CPU_ISA environment variable names a lower instruction set
+// ("generic", "sse2", "avx2" or "avx512"), which is useful for comparing
+// implementations. The variable is read once, on first call.
+inline isa selected_isa() noexcept
+{
+    static isa const i = detail::select_isa(detected_features());
+    return i;
+}
+
+} // namespace cpu
+
+} // namespace neo
+
+#endif // NEO_CPU_HPP
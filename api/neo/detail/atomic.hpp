@@ -0,0 +1,233 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_ATOMIC_HPP
+#define NEO_DETAIL_ATOMIC_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+// GCC and Clang can operate atomically on any suitably aligned object, which
+// is what std::atomic does internally, so these lower to the same
+// instructions (e.g. LOCK XADD for fetch_add). Elsewhere, the object is
+// accessed through a std::atomic of the same size.
+#if defined(__GNUC__) || defined(__clang__)
+#define NEO_DETAIL_ATOMIC_BUILTINS
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Atomic operations on an object of fundamental type T which was not declared
+// atomic. The object must be aligned to `required_alignment`.
+template<typename T>
+struct atomic_access
+{
+    static_assert(sizeof(T) <= 8, "atomic operations are only provided for types of at most 64 bits");
+
+    static constexpr std::size_t required_alignment = sizeof(T) > alignof(T) ? sizeof(T) : alignof(T);
+
+#if defined(NEO_DETAIL_ATOMIC_BUILTINS)
+
+    // The enumerators of std::memory_order have the values of the __ATOMIC
+    // constants.
+    static constexpr int to_builtin(std::memory_order order) noexcept
+    {
+        return static_cast<int>(order);
+    }
+
+    static T load(T const* object, std::memory_order order) noexcept
+    {
+        T result;
+        __atomic_load(object, &result, to_builtin(order));
+        return result;
+    }
+
+    static void store(T* object, T desired, std::memory_order order) noexcept
+    {
+        __atomic_store(object, &desired, to_builtin(order));
+    }
+
+    static T exchange(T* object, T desired, std::memory_order order) noexcept
+    {
+        T result;
+        __atomic_exchange(object, &desired, &result, to_builtin(order));
+        return result;
+    }
+
+    static bool compare_exchange_weak(T* object, T& expected, T desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return __atomic_compare_exchange(object, &expected, &desired, true, to_builtin(success), to_builtin(failure));
+    }
+
+    static bool compare_exchange_strong(T* object, T& expected, T desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return __atomic_compare_exchange(object, &expected, &desired, false, to_builtin(success), to_builtin(failure));
+    }
+
+    static T fetch_add(T* object, T arg, std::memory_order order) noexcept
+    {
+        return __atomic_fetch_add(object, arg, to_builtin(order));
+    }
+
+    static T fetch_sub(T* object, T arg, std::memory_order order) noexcept
+    {
+        return __atomic_fetch_sub(object, arg, to_builtin(order));
+    }
+
+    static T fetch_and(T* object, T arg, std::memory_order order) noexcept
+    {
+        return __atomic_fetch_and(object, arg, to_builtin(order));
+    }
+
+    static T fetch_or(T* object, T arg, std::memory_order order) noexcept
+    {
+        return __atomic_fetch_or(object, arg, to_builtin(order));
+    }
+
+    static T fetch_xor(T* object, T arg, std::memory_order order) noexcept
+    {
+        return __atomic_fetch_xor(object, arg, to_builtin(order));
+    }
+
+    static bool is_lock_free() noexcept
+    {
+        return __atomic_always_lock_free(sizeof(T), 0);
+    }
+
+#else
+
+    // std::atomic<T> has the size and representation of T on every platform
+    // where the builtins are not available.
+    static_assert(sizeof(std::atomic<T>) == sizeof(T), "std::atomic<T> must have the same size as T");
+
+    static std::atomic<T>* as_atomic(T* object) noexcept
+    {
+        return reinterpret_cast<std::atomic<T>*>(object);
+    }
+
+    static std::atomic<T> const* as_atomic(T const* object) noexcept
+    {
+        return reinterpret_cast<std::atomic<T> const*>(object);
+    }
+
+    static T load(T const* object, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->load(order);
+    }
+
+    static void store(T* object, T desired, std::memory_order order) noexcept
+    {
+        as_atomic(object)->store(desired, order);
+    }
+
+    static T exchange(T* object, T desired, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->exchange(desired, order);
+    }
+
+    static bool compare_exchange_weak(T* object, T& expected, T desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return as_atomic(object)->compare_exchange_weak(expected, desired, success, failure);
+    }
+
+    static bool compare_exchange_strong(T* object, T& expected, T desired,
+            std::memory_order success, std::memory_order failure) noexcept
+    {
+        return as_atomic(object)->compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    static T fetch_add(T* object, T arg, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->fetch_add(arg, order);
+    }
+
+    static T fetch_sub(T* object, T arg, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->fetch_sub(arg, order);
+    }
+
+    static T fetch_and(T* object, T arg, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->fetch_and(arg, order);
+    }
+
+    static T fetch_or(T* object, T arg, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->fetch_or(arg, order);
+    }
+
+    static T fetch_xor(T* object, T arg, std::memory_order order) noexcept
+    {
+        return as_atomic(object)->fetch_xor(arg, order);
+    }
+
+    static bool is_lock_free() noexcept
+    {
+        return std::atomic<T>().is_lock_free();
+    }
+
+#endif
+};
+
+template<typename T>
+constexpr std::size_t atomic_access<T>::required_alignment;
+
+// The failure order of a compare-exchange given a single order, as for
+// std::atomic.
+constexpr std::memory_order failure_order(std::memory_order order) noexcept
+{
+    return order == std::memory_order_acq_rel ? std::memory_order_acquire :
+        order == std::memory_order_release ? std::memory_order_relaxed :
+        order;
+}
+
+// Arithmetic is done by a single instruction if the policy wraps like the
+// hardware, and otherwise by applying the policy in a compare-exchange loop,
+// which leaves the object unchanged if the policy throws.
+template<typename Policy, typename T>
+T atomic_fetch_add(T* object, T arg, std::memory_order order, std::true_type) noexcept
+{
+    return atomic_access<T>::fetch_add(object, arg, order);
+}
+
+template<typename Policy, typename T>
+T atomic_fetch_add(T* object, T arg, std::memory_order order, std::false_type) noexcept(Policy::is_nothrow)
+{
+    T expected = atomic_access<T>::load(object, std::memory_order_relaxed);
+    while (!atomic_access<T>::compare_exchange_weak(object, expected, Policy::add(expected, arg), order, std::memory_order_relaxed))
+    {
+    }
+    return expected;
+}
+
+template<typename Policy, typename T>
+T atomic_fetch_sub(T* object, T arg, std::memory_order order, std::true_type) noexcept
+{
+    return atomic_access<T>::fetch_sub(object, arg, order);
+}
+
+template<typename Policy, typename T>
+T atomic_fetch_sub(T* object, T arg, std::memory_order order, std::false_type) noexcept(Policy::is_nothrow)
+{
+    T expected = atomic_access<T>::load(object, std::memory_order_relaxed);
+    while (!atomic_access<T>::compare_exchange_weak(object, expected, Policy::sub(expected, arg), order, std::memory_order_relaxed))
+    {
+    }
+    return expected;
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_ATOMIC_HPP
@@ -0,0 +1,128 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_ATOMIC_PTR_HPP
+#define NEO_DETAIL_ATOMIC_PTR_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// On x86-64, a pointer and its version are compared and exchanged together
+// with CMPXCHG16B. std::atomic of a 16-byte type does not use it unless
+// libatomic is linked (and then not always lock-free), so it is issued
+// directly. The first generation of x86-64 processors lacks it, so GCC and
+// Clang only use it when the target has it (with -mcx16, or an -march which
+// implies it), which they indicate by defining
+// __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16. MSVC has no such option, but 64-bit
+// Windows has required it since Windows 8.1.
+#if (defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)) || \
+    (defined(_M_X64) && defined(_MSC_VER) && !defined(__clang__))
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#define NEO_DETAIL_CMPXCHG16B
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+// A pointer and its version, as two 64-bit words, so there is no padding to
+// spoil a bitwise comparison.
+struct versioned_words
+{
+    std::uint64_t pointer;
+    std::uint64_t version;
+};
+
+#if defined(NEO_DETAIL_CMPXCHG16B)
+
+// The words are atomic individually, so either can be loaded without
+// locking, and together with CMPXCHG16B.
+struct alignas(16) atomic_versioned_words
+{
+    std::atomic<std::uint64_t> pointer;
+    std::atomic<std::uint64_t> version;
+
+    constexpr explicit atomic_versioned_words(versioned_words const& w) noexcept :
+        pointer(w.pointer),
+        version(w.version)
+    {
+    }
+
+    // The words are loaded one at a time, version first, so the result may
+    // pair a version with a later pointer. As every exchange increments the
+    // version, a compare_exchange() which expects such a pair always fails,
+    // and replaces it with a consistent one. The version is loaded with at
+    // least acquire order, so the pointer can never be the earlier one.
+    versioned_words load(std::memory_order order) const noexcept
+    {
+        std::uint64_t const v = version.load(order == std::memory_order_relaxed ? std::memory_order_acquire : order);
+        return { pointer.load(order), v };
+    }
+
+    // CMPXCHG16B is a full barrier, so every memory order is satisfied.
+    bool compare_exchange(versioned_words& expected, versioned_words const& desired) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return _InterlockedCompareExchange128(reinterpret_cast<long long volatile*>(this),
+                static_cast<long long>(desired.version), static_cast<long long>(desired.pointer),
+                reinterpret_cast<long long*>(&expected)) != 0;
+#else
+        bool result;
+        __asm__ __volatile__(
+            "lock cmpxchg16b %1\n\t"
+            "sete %0"
+            : "=q"(result), "+m"(*this), "+a"(expected.pointer), "+d"(expected.version)
+            : "b"(desired.pointer), "c"(desired.version)
+            : "memory", "cc");
+        return result;
+#endif
+    }
+
+    static constexpr bool is_lock_free() noexcept
+    {
+        return true;
+    }
+};
+
+#else
+
+// Elsewhere, std::atomic is used, which may need libatomic, and may lock.
+// libatomic uses CMPXCHG16B where the processor supports it.
+struct atomic_versioned_words
+{
+    std::atomic<versioned_words> words;
+
+    constexpr explicit atomic_versioned_words(versioned_words const& w) noexcept :
+        words(w)
+    {
+    }
+
+    versioned_words load(std::memory_order order) const noexcept
+    {
+        return words.load(order);
+    }
+
+    bool compare_exchange(versioned_words& expected, versioned_words const& desired) noexcept
+    {
+        return words.compare_exchange_strong(expected, desired);
+    }
+
+    bool is_lock_free() const noexcept
+    {
+        return words.is_lock_free();
+    }
+};
+
+#endif
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_ATOMIC_PTR_HPP
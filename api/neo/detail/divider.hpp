@@ -0,0 +1,246 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_DIVIDER_HPP
+#define NEO_DETAIL_DIVIDER_HPP
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<typename T>
+constexpr int floor_log2(T x) noexcept
+{
+    int result = 0;
+
+    while (x > 1u)
+    {
+        x = static_cast<T>(x >> 1);
+        ++result;
+    }
+
+    return result;
+}
+
+// Returns (`high` * 2^w) / `d` and assigns the remainder to `remainder`,
+// where w is the width of T. `high` must be less than `d`, so the quotient
+// fits in T.
+template<typename T, typename = enable_if_t<has_wide_product<T>::value>>
+constexpr T divide_wide(T high, T d, T& remainder) noexcept
+{
+    using W = wide_product_t<T>;
+
+    remainder = static_cast<T>((static_cast<W>(high) << (sizeof(T) * 8)) % d);
+    return static_cast<T>((static_cast<W>(high) << (sizeof(T) * 8)) / d);
+}
+
+// Without a wide type, the quotient is computed one bit at a time. This is
+// only done when a divider is constructed.
+template<typename T, typename = enable_if_t<!has_wide_product<T>::value>, typename = void>
+constexpr T divide_wide(T high, T d, T& remainder) noexcept
+{
+    T quotient = 0;
+
+    for (int i = 0; i < static_cast<int>(sizeof(T) * 8); ++i)
+    {
+        bool const carry = (high >> (sizeof(T) * 8 - 1)) != 0;
+        high = static_cast<T>(high << 1);
+        quotient = static_cast<T>(quotient << 1);
+
+        if (carry || high >= d)
+        {
+            high = static_cast<T>(high - d);
+            quotient = static_cast<T>(quotient | 1u);
+        }
+    }
+
+    remainder = high;
+    return quotient;
+}
+
+// How a numerator n is divided: by a shift alone, for powers of two, or by
+// shifting the high half of n times the magic number. For some divisors, the
+// magic number needs one more bit than T, and n is added to the high half to
+// make up for it.
+enum class division_path : unsigned char
+{
+    shift,
+    multiply,
+    multiply_add
+};
+
+// The constants of division by an unsigned divisor, found as in Granlund and
+// Montgomery's "Division by Invariant Integers using Multiplication".
+template<typename T>
+struct unsigned_division
+{
+    T magic;
+    T divisor;
+    int shift;
+    division_path path;
+
+    constexpr T divide(T n) const noexcept
+    {
+        if (path == division_path::shift)
+        {
+            return static_cast<T>(n >> shift);
+        }
+
+        T const high = mul_high(magic, n);
+
+        return path == division_path::multiply ?
+            static_cast<T>(high >> shift) :
+            static_cast<T>(static_cast<T>((static_cast<T>(n - high) >> 1) + high) >> shift);
+    }
+
+    constexpr T remainder(T n) const noexcept
+    {
+        return static_cast<T>(n - static_cast<T>(divide(n) * divisor));
+    }
+};
+
+// `d` must not be zero.
+template<typename T>
+constexpr unsigned_division<T> make_unsigned_division(T d) noexcept
+{
+    int const log2 = floor_log2(d);
+
+    if ((d & (d - 1u)) == 0)
+    {
+        return { 0, d, log2, division_path::shift };
+    }
+
+    // The magic number is 2^(w + log2) / d, rounded up, if its rounding error
+    // is small enough. Otherwise, it is 2^(w + log2 + 1) / d, rounded up,
+    // which needs one more bit than T, so its top bit is dropped.
+    T remainder = 0;
+    T magic = divide_wide(static_cast<T>(T(1u) << log2), d, remainder);
+    division_path path = division_path::multiply;
+
+    if (static_cast<T>(d - remainder) >= static_cast<T>(T(1u) << log2))
+    {
+        T const twice = static_cast<T>(remainder + remainder);
+        magic = static_cast<T>(magic + magic + (twice >= d || twice < remainder ? 1u : 0u));
+        path = division_path::multiply_add;
+    }
+
+    return { static_cast<T>(magic + 1u), d, log2, path };
+}
+
+// The constants of division by a signed divisor. Quotients are rounded
+// towards zero, as by the built-in division.
+template<typename T>
+struct signed_division
+{
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    T magic;
+    T divisor;
+    int shift;
+    division_path path;
+
+    constexpr T divide(T n) const noexcept
+    {
+        return path == division_path::shift ? divide_by_shift(n) : divide_by_multiply(n);
+    }
+
+    constexpr T remainder(T n) const noexcept
+    {
+        return static_cast<T>(static_cast<unsigned_type>(n) -
+                static_cast<unsigned_type>(static_cast<unsigned_type>(divide(n)) * static_cast<unsigned_type>(divisor)));
+    }
+
+private:
+    static constexpr T negate(T x) noexcept
+    {
+        return static_cast<T>(unsigned_type(0u) - static_cast<unsigned_type>(x));
+    }
+
+    // Negative numerators are biased by 2^shift - 1, so the arithmetic shift
+    // rounds towards zero.
+    constexpr T divide_by_shift(T n) const noexcept
+    {
+        T const bias = static_cast<T>(n < 0 ? (unsigned_type(1u) << shift) - 1u : 0u);
+        T const quotient = static_cast<T>(static_cast<T>(n + bias) >> shift);
+        return divisor < 0 ? negate(quotient) : quotient;
+    }
+
+    // The magic number has the sign of the divisor. Adding 1 to negative
+    // quotients turns the rounding down of the shift into rounding towards
+    // zero.
+    constexpr T divide_by_multiply(T n) const noexcept
+    {
+        unsigned_type high = static_cast<unsigned_type>(mul_high(magic, n));
+
+        if (path == division_path::multiply_add)
+        {
+            high = static_cast<unsigned_type>(high + static_cast<unsigned_type>(divisor < 0 ? negate(n) : n));
+        }
+
+        T const quotient = static_cast<T>(static_cast<T>(high) >> shift);
+        return static_cast<T>(quotient + (quotient < 0 ? 1 : 0));
+    }
+};
+
+// `d` must not be zero.
+template<typename T>
+constexpr signed_division<T> make_signed_division(T d) noexcept
+{
+    using U = typename std::make_unsigned<T>::type;
+
+    U const magnitude = d < 0 ? static_cast<U>(U(0u) - static_cast<U>(d)) : static_cast<U>(d);
+    int const log2 = floor_log2(magnitude);
+
+    if ((magnitude & (magnitude - 1u)) == 0)
+    {
+        return { 0, d, log2, division_path::shift };
+    }
+
+    // As for unsigned divisors, but with one bit fewer, for the sign.
+    U remainder = 0;
+    U magic = divide_wide(static_cast<U>(U(1u) << (log2 - 1)), magnitude, remainder);
+    int shift = log2 - 1;
+    division_path path = division_path::multiply;
+
+    if (static_cast<U>(magnitude - remainder) >= static_cast<U>(U(1u) << log2))
+    {
+        U const twice = static_cast<U>(remainder + remainder);
+        magic = static_cast<U>(magic + magic + (twice >= magnitude || twice < remainder ? 1u : 0u));
+        shift = log2;
+        path = division_path::multiply_add;
+    }
+
+    magic = static_cast<U>(magic + 1u);
+
+    return { static_cast<T>(d < 0 ? static_cast<U>(U(0u) - magic) : magic), d, shift, path };
+}
+
+template<typename T>
+using division_t = typename std::conditional<std::is_signed<T>::value, signed_division<T>, unsigned_division<T>>::type;
+
+template<typename T, typename = enable_if_t<std::is_unsigned<T>::value>>
+constexpr unsigned_division<T> make_division(T d) noexcept
+{
+    return make_unsigned_division(d);
+}
+
+template<typename T, typename = enable_if_t<std::is_signed<T>::value>, typename = void>
+constexpr signed_division<T> make_division(T d) noexcept
+{
+    return make_signed_division(d);
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_DIVIDER_HPP
@@ -0,0 +1,145 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_FIXED_HPP
+#define NEO_DETAIL_FIXED_HPP
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<typename T>
+constexpr T pow2(int n) noexcept
+{
+    return static_cast<T>(static_cast<std::uintmax_t>(1) << n);
+}
+
+// The 128 / 64-bit quotient of magnitudes, for compilers without 128-bit
+// integers.
+inline std::uint64_t portable_div_wide(std::uint64_t high, std::uint64_t low, std::uint64_t divisor) noexcept
+{
+    std::uint64_t quotient = 0;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        bool const carry = (high >> 63) != 0;
+        high = (high << 1) | (low >> 63);
+        low <<= 1;
+        quotient <<= 1;
+
+        if (carry || high >= divisor)
+        {
+            high -= divisor;
+            quotient |= 1u;
+        }
+    }
+
+    return quotient;
+}
+
+template<typename T>
+constexpr bool is_negative_value(T x) noexcept
+{
+    return std::is_signed<T>::value && x < static_cast<T>(0);
+}
+
+template<typename T>
+constexpr std::uint64_t magnitude_of(T x) noexcept
+{
+    return is_negative_value(x) ? 0u - static_cast<std::uint64_t>(x) : static_cast<std::uint64_t>(x);
+}
+
+// x * y / 2^FracBits, rounded towards negative infinity.
+template<int FracBits, typename T, typename = enable_if_t<has_wide_product<T>::value>>
+constexpr T fixed_mul(T x, T y) noexcept
+{
+    return static_cast<T>((static_cast<wide_product_t<T>>(x) * y) >> FracBits);
+}
+
+template<int FracBits, typename T, typename = enable_if_t<!has_wide_product<T>::value>, typename = void>
+T fixed_mul(T x, T y) noexcept
+{
+    std::uint64_t high;
+    std::uint64_t low;
+    portable_mul_wide(static_cast<portable_mul_t<T>>(x), static_cast<portable_mul_t<T>>(y), high, low);
+
+    if (FracBits == 0)
+    {
+        return static_cast<T>(low);
+    }
+
+    // The arithmetic shift of the 128-bit product.
+    return static_cast<T>((high << ((64 - FracBits) % 64)) | (low >> FracBits));
+}
+
+// x * 2^FracBits / y, rounded towards zero.
+template<int FracBits, typename T, typename = enable_if_t<has_wide_product<T>::value>>
+constexpr T fixed_div(T x, T y) noexcept
+{
+    return static_cast<T>(static_cast<wide_product_t<T>>(x) * pow2<wide_product_t<T>>(FracBits) / y);
+}
+
+template<int FracBits, typename T, typename = enable_if_t<!has_wide_product<T>::value>, typename = void>
+T fixed_div(T x, T y) noexcept
+{
+    std::uint64_t const magnitude = portable_div_wide(
+            FracBits == 0 ? 0u : magnitude_of(x) >> ((64 - FracBits) % 64),
+            magnitude_of(x) << FracBits,
+            magnitude_of(y));
+
+    return is_negative_value(x) != is_negative_value(y) ?
+        static_cast<T>(0u - magnitude) :
+        static_cast<T>(magnitude);
+}
+
+// The multiplier and shift with which x * m >> shift, rounded towards zero,
+// approximates x * 2^FracBits / d for every x of type T, to within one unit in
+// the last place, provided that the quotient is representable. The magnitude of
+// the multiplier has one more bit than the digits of T, so that it is as
+// precise as the largest quotient, and x * m fits in the product type, which
+// limits this to types of up to 32 bits.
+template<typename T>
+struct fixed_reciprocal
+{
+    wide_product_t<T> multiplier;
+    int shift;
+};
+
+template<int FracBits, typename T, typename = enable_if_t<sizeof(T) <= 4>>
+fixed_reciprocal<T> make_fixed_reciprocal(T d) noexcept
+{
+    using product = wide_product_t<T>;
+
+    std::uint64_t const magnitude = magnitude_of(d);
+    int log2 = 0;
+
+    while ((magnitude >> (log2 + 1)) != 0)
+    {
+        ++log2;
+    }
+
+    // Unsigned quotients have one more digit than signed quotients, so their
+    // multipliers need one more bit.
+    int const shift = std::numeric_limits<T>::digits - FracBits + log2;
+    product const m = static_cast<product>(
+            ((static_cast<std::uint64_t>(1) << (FracBits + shift)) + magnitude / 2) / magnitude);
+
+    return fixed_reciprocal<T>{is_negative_value(d) ? static_cast<product>(0 - m) : m, shift};
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_FIXED_HPP
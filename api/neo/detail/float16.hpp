@@ -0,0 +1,291 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_FLOAT16_HPP
+#define NEO_DETAIL_FLOAT16_HPP
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+// The 16-bit binary floating-point formats: IEEE 754 binary16, and bfloat16,
+// which has the exponent range of float and 7 mantissa bits.
+template<int ExpBits, int ManBits>
+struct binary16_format
+{
+    static constexpr int exponent_bits = ExpBits;
+    static constexpr int mantissa_bits = ManBits;
+    static constexpr int bias = (1 << (ExpBits - 1)) - 1;
+    static constexpr std::uint16_t sign_mask = 0x8000u;
+    static constexpr std::uint16_t infinity = ((1u << ExpBits) - 1) << ManBits;
+    static constexpr std::uint16_t quiet_bit = 1u << (ManBits - 1);
+};
+
+template<int ExpBits, int ManBits>
+constexpr int binary16_format<ExpBits, ManBits>::exponent_bits;
+
+template<int ExpBits, int ManBits>
+constexpr int binary16_format<ExpBits, ManBits>::mantissa_bits;
+
+template<int ExpBits, int ManBits>
+constexpr int binary16_format<ExpBits, ManBits>::bias;
+
+template<int ExpBits, int ManBits>
+constexpr std::uint16_t binary16_format<ExpBits, ManBits>::sign_mask;
+
+template<int ExpBits, int ManBits>
+constexpr std::uint16_t binary16_format<ExpBits, ManBits>::infinity;
+
+template<int ExpBits, int ManBits>
+constexpr std::uint16_t binary16_format<ExpBits, ManBits>::quiet_bit;
+
+using ieee_half_format = binary16_format<5, 10>;
+using bfloat16_format = binary16_format<8, 7>;
+
+inline std::uint32_t float_bits(float x) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+inline std::uint64_t float_bits(double x) noexcept
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+inline float float_from_bits(std::uint32_t bits) noexcept
+{
+    float x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+// Rounds `significand * 2^(exponent - 63)`, where the top bit of `significand`
+// is set, to the nearest value of `Format`, ties to even, and returns its
+// representation without the sign. Subnormal results keep fewer significand
+// bits, and results too large for the format round to infinity.
+template<typename Format>
+inline std::uint16_t round_to_binary16(int exponent, std::uint64_t significand) noexcept
+{
+    constexpr int man_bits = Format::mantissa_bits;
+
+    int const biased = exponent + Format::bias;
+    int const shift = 63 - man_bits + (biased < 1 ? 1 - biased : 0);
+
+    if (shift > 64)
+    {
+        return 0;
+    }
+
+    std::uint64_t const half = static_cast<std::uint64_t>(1) << (shift - 1);
+    std::uint64_t q = shift == 64 ? 0 : significand >> shift;
+    std::uint64_t const remainder = shift == 64 ? significand : significand & (half * 2 - 1);
+
+    if (remainder > half || (remainder == half && (q & 1) != 0))
+    {
+        ++q;
+    }
+
+    // `q` includes the implicit bit, so a carry out of the mantissa increments
+    // the exponent, and a subnormal can round up to the smallest normal value.
+    if (biased < 1)
+    {
+        return static_cast<std::uint16_t>(q);
+    }
+
+    std::uint64_t const bits = (static_cast<std::uint64_t>(biased - 1) << man_bits) + q;
+
+    return bits >= Format::infinity ? Format::infinity : static_cast<std::uint16_t>(bits);
+}
+
+// Converts the IEEE binary floating-point value with representation `bits`,
+// `SrcExpBits` exponent bits and `SrcManBits` mantissa bits, to `Format`. NaNs
+// are quieted and keep the high bits of their payload.
+template<typename Format, int SrcExpBits, int SrcManBits>
+inline std::uint16_t binary16_from_ieee(std::uint64_t bits) noexcept
+{
+    constexpr int src_bias = (1 << (SrcExpBits - 1)) - 1;
+    constexpr std::uint64_t src_exponent_max = (static_cast<std::uint64_t>(1) << SrcExpBits) - 1;
+    constexpr std::uint64_t src_implicit_bit = static_cast<std::uint64_t>(1) << SrcManBits;
+
+    std::uint16_t const sign = ((bits >> (SrcExpBits + SrcManBits)) & 1) != 0 ? Format::sign_mask : 0;
+    std::uint64_t const exponent = (bits >> SrcManBits) & src_exponent_max;
+    std::uint64_t const mantissa = bits & (src_implicit_bit - 1);
+
+    if (exponent == src_exponent_max)
+    {
+        return static_cast<std::uint16_t>(sign | Format::infinity | (mantissa == 0 ? 0 :
+                Format::quiet_bit | (mantissa >> (SrcManBits - Format::mantissa_bits))));
+    }
+
+    if (exponent == 0 && mantissa == 0)
+    {
+        return sign;
+    }
+
+    // Normalize the significand so that its top bit is set.
+    int e = (exponent == 0 ? 1 : static_cast<int>(exponent)) - src_bias;
+    std::uint64_t significand = (exponent == 0 ? mantissa : mantissa | src_implicit_bit) << (63 - SrcManBits);
+
+    while ((significand >> 63) == 0)
+    {
+        significand <<= 1;
+        --e;
+    }
+
+    return static_cast<std::uint16_t>(sign | round_to_binary16<Format>(e, significand));
+}
+
+template<typename Format>
+inline std::uint16_t binary16_from_float(float x) noexcept
+{
+    return binary16_from_ieee<Format, 8, 23>(float_bits(x));
+}
+
+// bfloat16 has the exponent range of float, so rounding is a matter of adding
+// to the bits that are discarded.
+template<>
+inline std::uint16_t binary16_from_float<bfloat16_format>(float x) noexcept
+{
+    std::uint32_t const bits = float_bits(x);
+
+    if ((bits & 0x7fffffffu) > 0x7f800000u)
+    {
+        return static_cast<std::uint16_t>((bits >> 16) | bfloat16_format::quiet_bit);
+    }
+
+    return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+}
+
+template<typename Format>
+inline std::uint16_t binary16_from_double(double x) noexcept
+{
+    return binary16_from_ieee<Format, 11, 52>(float_bits(x));
+}
+
+// Rounds `significand * 2^(exponent - 63)` to `Format`, where `significand`
+// need not be normalized.
+template<typename Format>
+inline std::uint16_t binary16_from_magnitude(bool negative, int exponent, std::uint64_t significand) noexcept
+{
+    if (significand == 0)
+    {
+        return 0;
+    }
+
+    while ((significand >> 63) == 0)
+    {
+        significand <<= 1;
+        --exponent;
+    }
+
+    return static_cast<std::uint16_t>((negative ? Format::sign_mask : 0) | round_to_binary16<Format>(exponent, significand));
+}
+
+template<typename Format, typename T, typename = enable_if_t<!is_int128<T>::value>>
+inline std::uint16_t binary16_from_integer(T x) noexcept
+{
+    bool const negative = std::is_signed<T>::value && x < T(0);
+
+    return binary16_from_magnitude<Format>(negative, 63, negative ?
+        0u - static_cast<std::uint64_t>(x) :
+        static_cast<std::uint64_t>(x));
+}
+
+#if defined(NEO_DETAIL_INT128)
+// The magnitude is shifted into 64 bits, and any bits shifted out are kept as
+// a sticky bit, so that it still rounds correctly.
+template<typename Format, typename T, typename = enable_if_t<is_int128<T>::value>, typename = void>
+inline std::uint16_t binary16_from_integer(T x) noexcept
+{
+    bool const negative = is_signed<T>::value && x < T(0);
+    uint128_t const magnitude = negative ? 0u - static_cast<uint128_t>(x) : static_cast<uint128_t>(x);
+    std::uint64_t const high = static_cast<std::uint64_t>(magnitude >> 64);
+
+    int shift = 0;
+
+    while (shift < 64 && (high >> shift) != 0)
+    {
+        ++shift;
+    }
+
+    uint128_t const discarded = magnitude & ((static_cast<uint128_t>(1) << shift) - 1);
+
+    return binary16_from_magnitude<Format>(negative, 63 + shift,
+        static_cast<std::uint64_t>(magnitude >> shift) | (discarded != 0 ? 1u : 0u));
+}
+#endif
+
+// Converts a numeric value to `Format`, rounding to nearest, ties to even.
+// long double is converted through double, so may be rounded twice.
+template<typename Format>
+inline std::uint16_t binary16_from(float x) noexcept
+{
+    return binary16_from_float<Format>(x);
+}
+
+template<typename Format>
+inline std::uint16_t binary16_from(double x) noexcept
+{
+    return binary16_from_double<Format>(x);
+}
+
+template<typename Format>
+inline std::uint16_t binary16_from(long double x) noexcept
+{
+    return binary16_from_double<Format>(static_cast<double>(x));
+}
+
+template<typename Format, typename T, typename = enable_if_t<is_integral<T>::value>>
+inline std::uint16_t binary16_from(T x) noexcept
+{
+    return binary16_from_integer<Format>(x);
+}
+
+// Conversions to float are exact.
+inline float float_from_binary16(ieee_half_format, std::uint16_t h) noexcept
+{
+    std::uint32_t const sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+    std::uint32_t const exponent = (h >> 10) & 0x1fu;
+    std::uint32_t const mantissa = h & 0x3ffu;
+
+    // NaNs are quieted, as by F16C.
+    if (exponent == 0x1f)
+    {
+        return float_from_bits(sign | 0x7f800000u | (mantissa == 0 ? 0 : 0x400000u | (mantissa << 13)));
+    }
+
+    if (exponent == 0)
+    {
+        // Subnormals are multiples of 2^-24.
+        return float_from_bits(sign | float_bits(static_cast<float>(mantissa) * 5.9604644775390625e-8f));
+    }
+
+    return float_from_bits(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+inline float float_from_binary16(bfloat16_format, std::uint16_t h) noexcept
+{
+    return float_from_bits(static_cast<std::uint32_t>(h) << 16);
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_FLOAT16_HPP
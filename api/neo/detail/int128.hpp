@@ -0,0 +1,309 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_INT128_HPP
+#define NEO_DETAIL_INT128_HPP
+
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SIZEOF_INT128__)
+#define NEO_DETAIL_INT128
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#define NEO_DETAIL_MULH
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+#if defined(NEO_DETAIL_INT128)
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+template<typename T>
+struct is_int128 : std::false_type
+{
+};
+
+#if defined(NEO_DETAIL_INT128)
+template<>
+struct is_int128<int128_t> : std::true_type
+{
+};
+
+template<>
+struct is_int128<uint128_t> : std::true_type
+{
+};
+#endif
+
+// The standard traits classify 128-bit integers only in GNU modes, so these
+// are used wherever a value<T> may hold one.
+template<typename T>
+struct is_integral : std::integral_constant<bool,
+        std::is_integral<T>::value || is_int128<typename std::remove_cv<T>::type>::value
+    >
+{
+};
+
+template<typename T>
+struct is_arithmetic : std::integral_constant<bool,
+        std::is_arithmetic<T>::value || is_integral<T>::value
+    >
+{
+};
+
+template<typename T>
+struct is_signed : std::integral_constant<bool,
+        std::is_signed<T>::value
+#if defined(NEO_DETAIL_INT128)
+        || std::is_same<typename std::remove_cv<T>::type, int128_t>::value
+#endif
+    >
+{
+};
+
+template<typename T>
+struct is_unsigned : std::integral_constant<bool,
+        is_integral<T>::value && !is_signed<T>::value
+    >
+{
+};
+
+template<typename T>
+struct make_unsigned : std::make_unsigned<T>
+{
+};
+
+#if defined(NEO_DETAIL_INT128)
+template<>
+struct make_unsigned<int128_t>
+{
+    using type = uint128_t;
+};
+
+template<>
+struct make_unsigned<uint128_t>
+{
+    using type = uint128_t;
+};
+#endif
+
+template<typename T>
+using make_unsigned_t = typename make_unsigned<T>::type;
+
+template<typename T>
+struct numeric_limits : std::numeric_limits<T>
+{
+};
+
+#if defined(NEO_DETAIL_INT128)
+template<>
+struct numeric_limits<int128_t>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = true;
+    static constexpr int digits = 127;
+    static constexpr int digits10 = 38;
+
+    static constexpr int128_t min() noexcept
+    {
+        return -max() - 1;
+    }
+
+    static constexpr int128_t lowest() noexcept
+    {
+        return min();
+    }
+
+    static constexpr int128_t max() noexcept
+    {
+        return static_cast<int128_t>(~static_cast<uint128_t>(0) >> 1);
+    }
+};
+
+template<>
+struct numeric_limits<uint128_t>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = false;
+    static constexpr bool is_integer = true;
+    static constexpr int digits = 128;
+    static constexpr int digits10 = 38;
+
+    static constexpr uint128_t min() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr uint128_t lowest() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr uint128_t max() noexcept
+    {
+        return ~static_cast<uint128_t>(0);
+    }
+};
+#endif
+
+template<std::size_t Size, bool Signed>
+struct sized_wide_product
+{
+};
+
+template<>
+struct sized_wide_product<1, true>
+{
+    using type = std::int16_t;
+};
+
+template<>
+struct sized_wide_product<1, false>
+{
+    using type = std::uint16_t;
+};
+
+template<>
+struct sized_wide_product<2, true>
+{
+    using type = std::int32_t;
+};
+
+template<>
+struct sized_wide_product<2, false>
+{
+    using type = std::uint32_t;
+};
+
+template<>
+struct sized_wide_product<4, true>
+{
+    using type = std::int64_t;
+};
+
+template<>
+struct sized_wide_product<4, false>
+{
+    using type = std::uint64_t;
+};
+
+#if defined(NEO_DETAIL_INT128)
+template<>
+struct sized_wide_product<8, true>
+{
+    using type = int128_t;
+};
+
+template<>
+struct sized_wide_product<8, false>
+{
+    using type = uint128_t;
+};
+#endif
+
+// Keyed on size and signedness rather than on the <cstdint> typedefs, so that
+// long and long long are both covered, whichever of them int64_t is.
+template<typename T, bool = is_integral<T>::value &&
+    !std::is_same<typename std::remove_cv<T>::type, bool>::value>
+struct wide_product
+{
+};
+
+template<typename T>
+struct wide_product<T, true> : sized_wide_product<sizeof(T), is_signed<T>::value>
+{
+};
+
+// The integer type, twice as wide as T, in which full products are computed.
+// 64-bit types have one only where the compiler provides 128-bit integers.
+template<typename T>
+using wide_product_t = typename wide_product<T>::type;
+
+template<typename T, typename = void>
+struct has_wide_product : std::false_type
+{
+};
+
+template<typename T>
+struct has_wide_product<T, void_t<wide_product_t<T>>> : std::true_type
+{
+};
+
+// The full 128-bit product of two 64-bit integers, as its high and low halves,
+// for compilers without 128-bit integers. The halves of a signed product are
+// its two's complement representation.
+inline void portable_mul_wide(std::uint64_t x, std::uint64_t y, std::uint64_t& high, std::uint64_t& low) noexcept
+{
+    std::uint64_t const x0 = x & 0xffffffffu;
+    std::uint64_t const x1 = x >> 32;
+    std::uint64_t const y0 = y & 0xffffffffu;
+    std::uint64_t const y1 = y >> 32;
+
+    std::uint64_t const p00 = x0 * y0;
+    std::uint64_t const p01 = x0 * y1;
+    std::uint64_t const p10 = x1 * y0;
+    std::uint64_t const p11 = x1 * y1;
+
+    std::uint64_t const middle = (p00 >> 32) + (p01 & 0xffffffffu) + (p10 & 0xffffffffu);
+
+    low = (middle << 32) | (p00 & 0xffffffffu);
+    high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+}
+
+inline void portable_mul_wide(std::int64_t x, std::int64_t y, std::uint64_t& high, std::uint64_t& low) noexcept
+{
+    portable_mul_wide(static_cast<std::uint64_t>(x), static_cast<std::uint64_t>(y), high, low);
+
+    // The signed product differs from the unsigned one in its high half.
+    high -= x < 0 ? static_cast<std::uint64_t>(y) : 0u;
+    high -= y < 0 ? static_cast<std::uint64_t>(x) : 0u;
+}
+
+template<typename T>
+using portable_mul_t = typename std::conditional<is_signed<T>::value, std::int64_t, std::uint64_t>::type;
+
+// The high half of the full product of two integers, computed in the wide
+// product type if there is one, and otherwise with a single instruction where
+// the compiler provides one.
+template<typename T, typename = enable_if_t<has_wide_product<T>::value>>
+constexpr T mul_high(T x, T y) noexcept
+{
+    return static_cast<T>((static_cast<wide_product_t<T>>(x) * y) >> (sizeof(T) * 8));
+}
+
+template<typename T, typename = enable_if_t<!has_wide_product<T>::value && sizeof(T) == 8>, typename = void>
+T mul_high(T x, T y) noexcept
+{
+#if defined(NEO_DETAIL_MULH)
+    return is_signed<T>::value ?
+        static_cast<T>(__mulh(static_cast<std::int64_t>(x), static_cast<std::int64_t>(y))) :
+        static_cast<T>(__umulh(static_cast<std::uint64_t>(x), static_cast<std::uint64_t>(y)));
+#else
+    std::uint64_t high;
+    std::uint64_t low;
+    portable_mul_wide(static_cast<portable_mul_t<T>>(x), static_cast<portable_mul_t<T>>(y), high, low);
+    return static_cast<T>(high);
+#endif
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_INT128_HPP
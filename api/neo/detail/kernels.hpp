@@ -0,0 +1,1183 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_KERNELS_HPP
+#define NEO_DETAIL_KERNELS_HPP
+
+#include <neo/cpu.hpp>
+
+#include <neo/detail/divider.hpp>
+#include <neo/detail/fixed.hpp>
+#include <neo/detail/float16.hpp>
+#include <neo/detail/mod_int.hpp>
+#include <neo/detail/overflow.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Kernels are compiled for each instruction set in cpu::isa using GCC vector
+// extensions and target attributes, and one is chosen at runtime.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_convertvector)
+#define NEO_DETAIL_KERNELS_X86
+#endif
+#endif
+#endif
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+#define NEO_DETAIL_ALWAYS_INLINE inline __attribute__((always_inline))
+#define NEO_DETAIL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define NEO_DETAIL_ALWAYS_INLINE inline
+#endif
+
+// The half-precision conversion intrinsics are called from functions which
+// enable F16C or AVX-512 with target attributes. GCC also declares the builtins
+// behind the saturating arithmetic intrinsics once <immintrin.h> is included,
+// and only checks that they are enabled where they are expanded, so they can
+// be called from code inlined into the kernels.
+#if defined(NEO_DETAIL_KERNELS_X86)
+#include <immintrin.h>
+#if !defined(__clang__)
+#define NEO_DETAIL_SATURATING_BUILTINS
+#endif
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+struct add_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        result = static_cast<T>(x + y);
+    }
+};
+
+struct sub_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        result = static_cast<T>(x - y);
+    }
+};
+
+struct mul_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        result = static_cast<T>(x * y);
+    }
+};
+
+// As with simd<T, N>, minimum and maximum return the second operand if
+// either is NaN.
+struct min_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        result = x < y ? x : y;
+    }
+};
+
+struct max_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        result = y < x ? x : y;
+    }
+};
+
+template<std::size_t Bytes>
+using vector_bytes = std::integral_constant<std::size_t, Bytes>;
+
+template<typename T, typename = enable_if_t<std::is_arithmetic<T>::value>>
+NEO_DETAIL_ALWAYS_INLINE void saturating_add_lanes(T const& x, T const& y, T& result) noexcept
+{
+    result = saturating_add(x, y);
+}
+
+template<typename T, typename = enable_if_t<std::is_arithmetic<T>::value>>
+NEO_DETAIL_ALWAYS_INLINE void saturating_sub_lanes(T const& x, T const& y, T& result) noexcept
+{
+    result = saturating_sub(x, y);
+}
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+
+template<typename T, std::size_t Bytes>
+struct vector_type
+{
+    typedef T type __attribute__((vector_size(Bytes)));
+};
+
+template<typename T, std::size_t Bytes>
+using vector_t = typename vector_type<T, Bytes>::type;
+
+// Loads the lanes at `p` into `result`, converting each from T to R. Vectors
+// are never passed by value, as vectors wider than the baseline instruction
+// set have a different calling convention in functions that enable them.
+template<typename R, std::size_t Bytes, typename T>
+NEO_DETAIL_ALWAYS_INLINE void load_lanes(T const* p, vector_t<R, Bytes>& result) noexcept
+{
+    vector_t<T, Bytes / sizeof(R) * sizeof(T)> v;
+    std::memcpy(&v, p, sizeof(v));
+
+    result = __builtin_convertvector(v, vector_t<R, Bytes>);
+}
+
+template<typename R, std::size_t Bytes>
+NEO_DETAIL_ALWAYS_INLINE void store_lanes(vector_t<R, Bytes> const& v, R* p) noexcept
+{
+    std::memcpy(p, &v, sizeof(v));
+}
+
+// Returns true if the representations of `x` and `y` differ. Vector
+// comparisons are avoided, as GCC lowers those wider than the baseline
+// instruction set to scalar code before they are inlined into the kernels.
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE bool differ(V const& x, V const& y) noexcept
+{
+    std::uint64_t wx[sizeof(V) / 8];
+    std::uint64_t wy[sizeof(V) / 8];
+    std::memcpy(wx, &x, sizeof(V));
+    std::memcpy(wy, &y, sizeof(V));
+
+    std::uint64_t any = 0;
+
+    for (std::size_t i = 0; i < sizeof(V) / 8; ++i)
+    {
+        any |= wx[i] ^ wy[i];
+    }
+
+    return any != 0;
+}
+
+template<typename R, std::size_t Bytes>
+NEO_DETAIL_ALWAYS_INLINE R reduce_lanes(vector_t<R, Bytes> const& v) noexcept
+{
+    R sum = R();
+
+    for (std::size_t i = 0; i < Bytes / sizeof(R); ++i)
+    {
+        sum = static_cast<R>(sum + v[i]);
+    }
+
+    return sum;
+}
+
+template<typename V>
+using vector_lane_t = typename std::remove_cv<typename std::remove_reference<
+    decltype(std::declval<V&>()[0])>::type>::type;
+
+// Saturating addition and subtraction of vectors select between the wrapped
+// result and the limit with lane masks. Unsigned lanes are masked by a
+// comparison with the operands; signed lanes overflow if the result has the
+// wrong sign, and saturate towards the sign of the first operand. As in the
+// kernels, `result` may be the same vector as `x`.
+
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE void saturating_add_vector(V const& x, V const& y, V& result, std::false_type) noexcept
+{
+    V const sum = x + y;
+    result = sum | reinterpret_cast<V>(sum < x);
+}
+
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE void saturating_sub_vector(V const& x, V const& y, V& result, std::false_type) noexcept
+{
+    V const difference = x - y;
+    result = difference & reinterpret_cast<V>(y <= x);
+}
+
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE void saturate_signed(V const& x, V const& wrapped, V const& overflow, V& result) noexcept
+{
+    using lane = vector_lane_t<V>;
+
+    constexpr int shift = static_cast<int>(sizeof(lane) * 8 - 1);
+    V const mask = overflow >> shift;
+    V const limit = (x >> shift) ^ std::numeric_limits<lane>::max();
+
+    result = (wrapped & ~mask) | (limit & mask);
+}
+
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE void saturating_add_vector(V const& x, V const& y, V& result, std::true_type) noexcept
+{
+    using unsigned_vector = vector_t<typename std::make_unsigned<vector_lane_t<V>>::type, sizeof(V)>;
+
+    V const sum = reinterpret_cast<V>(reinterpret_cast<unsigned_vector>(x) + reinterpret_cast<unsigned_vector>(y));
+    saturate_signed(x, sum, (x ^ sum) & (y ^ sum), result);
+}
+
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE void saturating_sub_vector(V const& x, V const& y, V& result, std::true_type) noexcept
+{
+    using unsigned_vector = vector_t<typename std::make_unsigned<vector_lane_t<V>>::type, sizeof(V)>;
+
+    V const difference = reinterpret_cast<V>(reinterpret_cast<unsigned_vector>(x) - reinterpret_cast<unsigned_vector>(y));
+    saturate_signed(x, difference, (x ^ y) & (x ^ difference), result);
+}
+
+template<typename V, typename = enable_if_t<!std::is_arithmetic<V>::value>, typename = void>
+NEO_DETAIL_ALWAYS_INLINE void saturating_add_lanes(V const& x, V const& y, V& result) noexcept
+{
+    saturating_add_vector(x, y, result, std::is_signed<vector_lane_t<V>>());
+}
+
+template<typename V, typename = enable_if_t<!std::is_arithmetic<V>::value>, typename = void>
+NEO_DETAIL_ALWAYS_INLINE void saturating_sub_lanes(V const& x, V const& y, V& result) noexcept
+{
+    saturating_sub_vector(x, y, result, std::is_signed<vector_lane_t<V>>());
+}
+
+#if defined(NEO_DETAIL_SATURATING_BUILTINS)
+
+// Vectors of 8- and 16-bit lanes use the saturating instructions (paddus,
+// padds, psubus and psubs). The 64-byte builtins take a merge source and mask.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+#define NEO_DETAIL_SATURATING_BUILTIN(name, lane, builtin_lane, bytes, call) \
+    NEO_DETAIL_ALWAYS_INLINE void name( \
+            vector_t<lane, bytes> const& x, vector_t<lane, bytes> const& y, vector_t<lane, bytes>& result) noexcept \
+    { \
+        using builtin_vector = vector_t<builtin_lane, bytes>; \
+        builtin_vector const bx = reinterpret_cast<builtin_vector>(x); \
+        builtin_vector const by = reinterpret_cast<builtin_vector>(y); \
+        result = reinterpret_cast<vector_t<lane, bytes>>(call); \
+    }
+
+#define NEO_DETAIL_SATURATING_BUILTINS_FOR(name, lane, builtin_lane, builtin) \
+    NEO_DETAIL_SATURATING_BUILTIN(name, lane, builtin_lane, 16, builtin##128(bx, by)) \
+    NEO_DETAIL_SATURATING_BUILTIN(name, lane, builtin_lane, 32, builtin##256(bx, by)) \
+    NEO_DETAIL_SATURATING_BUILTIN(name, lane, builtin_lane, 64, builtin##512_mask(bx, by, bx, -1))
+
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_add_lanes, std::uint8_t, char, __builtin_ia32_paddusb)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_add_lanes, std::int8_t, char, __builtin_ia32_paddsb)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_add_lanes, std::uint16_t, short, __builtin_ia32_paddusw)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_add_lanes, std::int16_t, short, __builtin_ia32_paddsw)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_sub_lanes, std::uint8_t, char, __builtin_ia32_psubusb)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_sub_lanes, std::int8_t, char, __builtin_ia32_psubsb)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_sub_lanes, std::uint16_t, short, __builtin_ia32_psubusw)
+NEO_DETAIL_SATURATING_BUILTINS_FOR(saturating_sub_lanes, std::int16_t, short, __builtin_ia32_psubsw)
+
+#undef NEO_DETAIL_SATURATING_BUILTINS_FOR
+#undef NEO_DETAIL_SATURATING_BUILTIN
+
+#pragma GCC diagnostic pop
+
+#endif
+
+#endif
+
+// Saturating addition and subtraction, for spans of saturating values.
+struct saturating_add_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        saturating_add_lanes(x, y, result);
+    }
+};
+
+struct saturating_sub_op
+{
+    template<typename T>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        saturating_sub_lanes(x, y, result);
+    }
+};
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+
+// Fixed-point multiplication of vectors computes the full products in lanes
+// twice as wide. There are no vectors of 128-bit lanes, so 64-bit lanes are
+// multiplied one at a time.
+template<int FracBits, typename V>
+NEO_DETAIL_ALWAYS_INLINE void fixed_mul_vector(V const& x, V const& y, V& result, std::true_type) noexcept
+{
+    using wide_vector = vector_t<wide_product_t<vector_lane_t<V>>, sizeof(V) * 2>;
+
+    wide_vector const product = __builtin_convertvector(x, wide_vector) * __builtin_convertvector(y, wide_vector);
+    result = __builtin_convertvector(product >> FracBits, V);
+}
+
+template<int FracBits, typename V>
+NEO_DETAIL_ALWAYS_INLINE void fixed_mul_vector(V const& x, V const& y, V& result, std::false_type) noexcept
+{
+    V product = x;
+
+    for (std::size_t i = 0; i < sizeof(V) / sizeof(x[0]); ++i)
+    {
+        product[i] = fixed_mul<FracBits>(x[i], y[i]);
+    }
+
+    result = product;
+}
+
+#endif
+
+// Multiplication of fixed-point values with `FracBits` fractional bits, for
+// spans of fixed values.
+template<int FracBits>
+struct fixed_mul_op
+{
+    template<typename T, typename = enable_if_t<std::is_arithmetic<T>::value>>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(T const& x, T const& y, T& result) const noexcept
+    {
+        result = fixed_mul<FracBits>(x, y);
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<typename V, typename = enable_if_t<!std::is_arithmetic<V>::value>, typename = void>
+    NEO_DETAIL_ALWAYS_INLINE void operator()(V const& x, V const& y, V& result) const noexcept
+    {
+        fixed_mul_vector<FracBits>(x, y, result, std::integral_constant<bool, sizeof(x[0]) <= 4>());
+    }
+#endif
+};
+
+// Each kernel implements run<Bytes>, which processes as many elements as it
+// can in vectors of `Bytes` bytes with blocks(), and finishes one element at a
+// time. run<0> is plain scalar code.
+
+template<typename R, typename Op>
+struct transform_kernel
+{
+    template<typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, T const*, U const*, R*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes, typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, T const* a, U const* b, R* out, std::size_t count) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(R);
+        std::size_t i = 0;
+
+        vector_t<R, Bytes> x;
+        vector_t<R, Bytes> y;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<R, Bytes>(a + i, x);
+            load_lanes<R, Bytes>(b + i, y);
+            Op()(x, y, x);
+            store_lanes<R, Bytes>(x, out + i);
+        }
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes, typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE void run(T const* a, U const* b, R* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, b, out, count); i < count; ++i)
+        {
+            Op()(static_cast<R>(a[i]), static_cast<R>(b[i]), out[i]);
+        }
+    }
+};
+
+template<typename R>
+struct sum_kernel
+{
+    template<typename T>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, T const*, std::size_t, R&) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes, typename T>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, T const* a, std::size_t count, R& sum) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(R);
+        std::size_t i = 0;
+
+        // Independent accumulators hide the latency of each addition.
+        vector_t<R, Bytes> acc0 = {};
+        vector_t<R, Bytes> acc1 = {};
+        vector_t<R, Bytes> acc2 = {};
+        vector_t<R, Bytes> acc3 = {};
+        vector_t<R, Bytes> x;
+
+        for (; i + 4 * lanes <= count; i += 4 * lanes)
+        {
+            load_lanes<R, Bytes>(a + i, x);
+            acc0 += x;
+            load_lanes<R, Bytes>(a + i + lanes, x);
+            acc1 += x;
+            load_lanes<R, Bytes>(a + i + 2 * lanes, x);
+            acc2 += x;
+            load_lanes<R, Bytes>(a + i + 3 * lanes, x);
+            acc3 += x;
+        }
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<R, Bytes>(a + i, x);
+            acc0 += x;
+        }
+
+        sum = reduce_lanes<R, Bytes>((acc0 + acc1) + (acc2 + acc3));
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes, typename T>
+    static NEO_DETAIL_ALWAYS_INLINE R run(T const* a, std::size_t count) noexcept
+    {
+        R sum = R();
+
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, count, sum); i < count; ++i)
+        {
+            sum = static_cast<R>(sum + static_cast<R>(a[i]));
+        }
+
+        return sum;
+    }
+};
+
+template<typename R>
+struct dot_kernel
+{
+    template<typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, T const*, U const*, std::size_t, R&) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes, typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, T const* a, U const* b, std::size_t count, R& sum) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(R);
+        std::size_t i = 0;
+
+        vector_t<R, Bytes> acc0 = {};
+        vector_t<R, Bytes> acc1 = {};
+        vector_t<R, Bytes> x;
+        vector_t<R, Bytes> y;
+
+        for (; i + 2 * lanes <= count; i += 2 * lanes)
+        {
+            load_lanes<R, Bytes>(a + i, x);
+            load_lanes<R, Bytes>(b + i, y);
+            acc0 += x * y;
+            load_lanes<R, Bytes>(a + i + lanes, x);
+            load_lanes<R, Bytes>(b + i + lanes, y);
+            acc1 += x * y;
+        }
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<R, Bytes>(a + i, x);
+            load_lanes<R, Bytes>(b + i, y);
+            acc0 += x * y;
+        }
+
+        sum = reduce_lanes<R, Bytes>(acc0 + acc1);
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes, typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE R run(T const* a, U const* b, std::size_t count) noexcept
+    {
+        R sum = R();
+
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, b, count, sum); i < count; ++i)
+        {
+            sum = static_cast<R>(sum + static_cast<R>(a[i]) * static_cast<R>(b[i]));
+        }
+
+        return sum;
+    }
+};
+
+// Assigns `x >> shift`, rounded towards zero rather than negative infinity, to
+// `result`, which may be the same as `x`.
+template<int Bits, typename P>
+NEO_DETAIL_ALWAYS_INLINE void truncating_shift(P const& x, int shift, P& result, std::true_type) noexcept
+{
+    P const sign = x >> (Bits - 1);
+    result = ((((x ^ sign) - sign) >> shift) ^ sign) - sign;
+}
+
+template<int Bits, typename P>
+NEO_DETAIL_ALWAYS_INLINE void truncating_shift(P const& x, int shift, P& result, std::false_type) noexcept
+{
+    result = x >> shift;
+}
+
+// Assigns `a[i] * multiplier >> shift`, computed in the product type of R and
+// rounded towards zero, to each `out[i]`, dividing by a fixed-point value
+// through its reciprocal.
+template<typename R>
+struct reciprocal_kernel
+{
+    using product = wide_product_t<R>;
+    using is_signed = std::is_signed<R>;
+
+    static constexpr int product_bits = static_cast<int>(sizeof(product) * 8);
+
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, R const*, product, int, R*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, R const* a, product multiplier, int shift, R* out, std::size_t count) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(R);
+        std::size_t i = 0;
+
+        vector_t<product, Bytes * 2> x;
+        vector_t<R, Bytes> y;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<product, Bytes * 2>(a + i, x);
+            x *= multiplier;
+            truncating_shift<product_bits>(x, shift, x, is_signed());
+            y = __builtin_convertvector(x, vector_t<R, Bytes>);
+            store_lanes<R, Bytes>(y, out + i);
+        }
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE void run(R const* a, product multiplier, int shift, R* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, multiplier, shift, out, count); i < count; ++i)
+        {
+            product x = static_cast<product>(static_cast<product>(a[i]) * multiplier);
+            truncating_shift<product_bits>(x, shift, x, is_signed());
+            out[i] = static_cast<R>(x);
+        }
+    }
+};
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+
+// Multiplies the low halves of 64-bit lanes. GCC does not recognize the
+// masked multiplication as pmuludq, so the builtins are used where they are
+// available.
+template<typename W>
+NEO_DETAIL_ALWAYS_INLINE void mul_low_halves(W const& x, W const& y, W& result) noexcept
+{
+    result = (x & 0xffffffffu) * (y & 0xffffffffu);
+}
+
+#if defined(NEO_DETAIL_SATURATING_BUILTINS)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+NEO_DETAIL_ALWAYS_INLINE void mul_low_halves(
+        vector_t<std::uint64_t, 16> const& x, vector_t<std::uint64_t, 16> const& y, vector_t<std::uint64_t, 16>& result) noexcept
+{
+    using halves = vector_t<int, 16>;
+    result = reinterpret_cast<vector_t<std::uint64_t, 16>>(
+            __builtin_ia32_pmuludq128(reinterpret_cast<halves>(x), reinterpret_cast<halves>(y)));
+}
+
+NEO_DETAIL_ALWAYS_INLINE void mul_low_halves(
+        vector_t<std::uint64_t, 32> const& x, vector_t<std::uint64_t, 32> const& y, vector_t<std::uint64_t, 32>& result) noexcept
+{
+    using halves = vector_t<int, 32>;
+    result = reinterpret_cast<vector_t<std::uint64_t, 32>>(
+            __builtin_ia32_pmuludq256(reinterpret_cast<halves>(x), reinterpret_cast<halves>(y)));
+}
+
+NEO_DETAIL_ALWAYS_INLINE void mul_low_halves(
+        vector_t<std::uint64_t, 64> const& x, vector_t<std::uint64_t, 64> const& y, vector_t<std::uint64_t, 64>& result) noexcept
+{
+    using halves = vector_t<int, 64>;
+    using products = vector_t<long long, 64>;
+    result = reinterpret_cast<vector_t<std::uint64_t, 64>>(
+            __builtin_ia32_pmuludq512_mask(reinterpret_cast<halves>(x), reinterpret_cast<halves>(y), products(), -1));
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+// Montgomery reduction of 64-bit lanes, each less than `modulus` * 2^32, as
+// montgomery<std::uint32_t>::reduce() does. `modulus` and `inverse` are
+// broadcast to every lane. The difference of the high words is negative
+// exactly when its high half is all ones, so that half masks the modulus, and
+// no vector comparison is needed.
+template<typename W>
+NEO_DETAIL_ALWAYS_INLINE void montgomery_reduce_lanes(W const& x, W const& modulus, W const& inverse, W& result) noexcept
+{
+    W m;
+    mul_low_halves(x, inverse, m);
+    mul_low_halves(m, modulus, m);
+
+    W const difference = (x >> 32) - (m >> 32);
+    result = (difference + ((difference >> 32) & modulus)) & 0xffffffffu;
+}
+
+#endif
+
+// Assigns the Montgomery product of `a[i]` and `b[i]` modulo 32-bit `m` to
+// each `out[i]`. If `Plain` is true, the elements are ordinary residues
+// rather than representations, and each product is reduced a second time,
+// with R^2 mod `m`, to cancel the factor of R^-1.
+template<bool Plain>
+struct montgomery_kernel
+{
+    using R = std::uint32_t;
+
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, R const*, R const*, montgomery<R>, R*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, R const* a, R const* b, montgomery<R> m, R* out, std::size_t count) noexcept
+    {
+        // The lanes are widened to 64 bits, so each vector holds half as many
+        // residues, and the products fit the widths of the target.
+        constexpr std::size_t lanes = Bytes / sizeof(std::uint64_t);
+        std::size_t i = 0;
+
+        using wide_vector = vector_t<std::uint64_t, Bytes>;
+
+        wide_vector const modulus = wide_vector() + m.modulus;
+        wide_vector const inverse = wide_vector() + m.inverse;
+        wide_vector const r_squared = wide_vector() + m.r_squared;
+
+        wide_vector x;
+        wide_vector y;
+        vector_t<R, Bytes / 2> z;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<std::uint64_t, Bytes>(a + i, x);
+            load_lanes<std::uint64_t, Bytes>(b + i, y);
+            mul_low_halves(x, y, x);
+            montgomery_reduce_lanes(x, modulus, inverse, x);
+
+            if (Plain)
+            {
+                mul_low_halves(x, r_squared, x);
+                montgomery_reduce_lanes(x, modulus, inverse, x);
+            }
+
+            z = __builtin_convertvector(x, vector_t<R, Bytes / 2>);
+            store_lanes<R, Bytes / 2>(z, out + i);
+        }
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE void run(R const* a, R const* b, montgomery<R> m, R* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, b, m, out, count); i < count; ++i)
+        {
+            out[i] = Plain ? m.mul(m.mul(a[i], b[i]), m.r_squared) : m.mul(a[i], b[i]);
+        }
+    }
+};
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+
+// The high halves of the products of T lanes held in 64-bit lanes. 64-bit
+// products are assembled from four products of 32-bit halves, as there is no
+// instruction for them.
+template<typename T, typename W>
+NEO_DETAIL_ALWAYS_INLINE void mul_high_lanes(W const& x, W const& y, W& result) noexcept
+{
+    if (sizeof(T) == 4)
+    {
+        mul_low_halves(x, y, result);
+        result >>= 32;
+    }
+    else
+    {
+        W const x_high = x >> 32;
+        W const y_high = y >> 32;
+
+        W low;
+        W low_high;
+        W high_low;
+        W high;
+        mul_low_halves(x, y, low);
+        mul_low_halves(x, y_high, low_high);
+        mul_low_halves(x_high, y, high_low);
+        mul_low_halves(x_high, y_high, high);
+
+        W const middle = high_low + (low >> 32);
+        result = high + (middle >> 32) + (((middle & 0xffffffffu) + low_high) >> 32);
+    }
+}
+
+#endif
+
+// Assigns the quotients (or remainders) of unsigned 32- or 64-bit lanes
+// divided by a divider, as unsigned_division<T>::divide() does. Each vector
+// loop follows one division path, chosen before the loop.
+template<typename T, bool Remainder>
+struct divide_kernel
+{
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, T const*, unsigned_division<T>, T*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes, division_path Path>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t path_blocks(T const* a, unsigned_division<T> d, T* out, std::size_t count) noexcept
+    {
+        // The lanes are widened to 64 bits, as for montgomery_kernel.
+        constexpr std::size_t lanes = Bytes / sizeof(std::uint64_t);
+        std::size_t i = 0;
+
+        using wide_vector = vector_t<std::uint64_t, Bytes>;
+
+        wide_vector const magic = wide_vector() + d.magic;
+        wide_vector const divisor = wide_vector() + d.divisor;
+
+        wide_vector x;
+        wide_vector q;
+        vector_t<T, lanes * sizeof(T)> z;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<std::uint64_t, Bytes>(a + i, x);
+
+            if (Path == division_path::shift)
+            {
+                q = x >> d.shift;
+            }
+            else
+            {
+                mul_high_lanes<T>(x, magic, q);
+
+                if (Path == division_path::multiply_add)
+                {
+                    q = ((x - q) >> 1) + q;
+                }
+
+                q >>= d.shift;
+            }
+
+            if (Remainder)
+            {
+                wide_vector product;
+
+                if (sizeof(T) == 4)
+                {
+                    mul_low_halves(q, divisor, product);
+                }
+                else
+                {
+                    product = q * divisor;
+                }
+
+                q = x - product;
+            }
+
+            z = __builtin_convertvector(q, vector_t<T, lanes * sizeof(T)>);
+            store_lanes<T, lanes * sizeof(T)>(z, out + i);
+        }
+
+        return i;
+    }
+
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, T const* a, unsigned_division<T> d, T* out, std::size_t count) noexcept
+    {
+        return d.path == division_path::shift ? path_blocks<Bytes, division_path::shift>(a, d, out, count) :
+            d.path == division_path::multiply ? path_blocks<Bytes, division_path::multiply>(a, d, out, count) :
+            path_blocks<Bytes, division_path::multiply_add>(a, d, out, count);
+    }
+#endif
+
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE void run(T const* a, unsigned_division<T> d, T* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, d, out, count); i < count; ++i)
+        {
+            out[i] = Remainder ? d.remainder(a[i]) : d.divide(a[i]);
+        }
+    }
+};
+
+// Rounds the bits of float lanes to bfloat16, as binary16_from_float() does,
+// but selects NaN lanes with an arithmetic mask rather than a comparison.
+template<typename V>
+NEO_DETAIL_ALWAYS_INLINE void bfloat16_round_lanes(V const& bits, V& result) noexcept
+{
+    V const nan = (0x7f800000u - (bits & 0x7fffffffu)) >> 31;
+    V const rounded = (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16;
+    V const quiet = (bits >> 16) | 0x40u;
+
+    result = (rounded & (nan - 1u)) | (quiet & (0u - nan));
+}
+
+// Converts bfloat16 values, given as their representations, to float. This is
+// a shift of each representation into the high half of a float.
+struct bfloat16_widen_kernel
+{
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, std::uint16_t const*, float*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(float);
+        std::size_t i = 0;
+
+        vector_t<std::uint32_t, Bytes> x;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<std::uint32_t, Bytes>(a + i, x);
+            x <<= 16;
+            std::memcpy(out + i, &x, sizeof(x));
+        }
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE void run(std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, out, count); i < count; ++i)
+        {
+            out[i] = float_from_binary16(bfloat16_format(), a[i]);
+        }
+    }
+};
+
+// Converts float values to the representations of bfloat16 values, rounding
+// to nearest, ties to even.
+struct bfloat16_narrow_kernel
+{
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, float const*, std::uint16_t*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(float);
+        std::size_t i = 0;
+
+        vector_t<std::uint32_t, Bytes> x;
+        vector_t<std::uint16_t, Bytes / 2> y;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            std::memcpy(&x, a + i, sizeof(x));
+            bfloat16_round_lanes(x, x);
+            y = __builtin_convertvector(x, vector_t<std::uint16_t, Bytes / 2>);
+            store_lanes<std::uint16_t, Bytes / 2>(y, out + i);
+        }
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes>
+    static NEO_DETAIL_ALWAYS_INLINE void run(float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = blocks(vector_bytes<Bytes>(), a, out, count); i < count; ++i)
+        {
+            out[i] = binary16_from_float<bfloat16_format>(a[i]);
+        }
+    }
+};
+
+// Finds the first index at which one element is less than the other, as
+// std::lexicographical_compare would. Vectors are skipped while their lanes
+// are identical; floating-point lanes which differ only in representation,
+// such as 0.0 and -0.0, are then compared one at a time.
+template<typename R>
+struct mismatch_kernel
+{
+    template<typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<0>, T const*, U const*, std::size_t) noexcept
+    {
+        return 0;
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<std::size_t Bytes, typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t blocks(vector_bytes<Bytes>, T const* a, U const* b, std::size_t count) noexcept
+    {
+        constexpr std::size_t lanes = Bytes / sizeof(R);
+        std::size_t i = 0;
+
+        vector_t<R, Bytes> x;
+        vector_t<R, Bytes> y;
+
+        for (; i + lanes <= count; i += lanes)
+        {
+            load_lanes<R, Bytes>(a + i, x);
+            load_lanes<R, Bytes>(b + i, y);
+
+            if (differ(x, y))
+            {
+                break;
+            }
+        }
+
+        return i;
+    }
+#endif
+
+    template<std::size_t Bytes, typename T, typename U>
+    static NEO_DETAIL_ALWAYS_INLINE std::size_t run(T const* a, U const* b, std::size_t count) noexcept
+    {
+        std::size_t i = blocks(vector_bytes<Bytes>(), a, b, count);
+
+        for (; i < count; ++i)
+        {
+            R const x = static_cast<R>(a[i]);
+            R const y = static_cast<R>(b[i]);
+
+            if (x < y || y < x)
+            {
+                break;
+            }
+        }
+
+        return i;
+    }
+};
+
+// Calls Kernel::run with the widest vectors that cpu::selected_isa() allows.
+// Each instantiation looks up its implementation in a table indexed by
+// instruction set once, on first use, and then calls it through a pointer.
+template<typename Kernel>
+struct dispatch
+{
+    template<typename... Args>
+    using result_t = decltype(Kernel::template run<0>(std::declval<Args>()...));
+
+    template<typename... Args>
+    using function = result_t<Args...> (*)(Args...);
+
+    template<typename... Args>
+    static result_t<Args...> generic(Args... args) noexcept
+    {
+        return Kernel::template run<0>(args...);
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    template<typename... Args>
+    NEO_DETAIL_TARGET("sse2")
+    static result_t<Args...> sse2(Args... args) noexcept
+    {
+        return Kernel::template run<16>(args...);
+    }
+
+    template<typename... Args>
+    NEO_DETAIL_TARGET("avx2")
+    static result_t<Args...> avx2(Args... args) noexcept
+    {
+        return Kernel::template run<32>(args...);
+    }
+
+    template<typename... Args>
+    NEO_DETAIL_TARGET("avx512f,avx512bw,avx512dq,avx512vl")
+    static result_t<Args...> avx512(Args... args) noexcept
+    {
+        return Kernel::template run<64>(args...);
+    }
+#endif
+
+    // Returns the implementation for `isa`, which the processor must support.
+    template<typename... Args>
+    static function<Args...> select(cpu::isa isa) noexcept
+    {
+#if defined(NEO_DETAIL_KERNELS_X86)
+        static function<Args...> const table[] = {
+            &generic<Args...>,
+            &sse2<Args...>,
+            &avx2<Args...>,
+            &avx512<Args...>
+        };
+
+        return table[static_cast<int>(isa)];
+#else
+        static_cast<void>(isa);
+        return &generic<Args...>;
+#endif
+    }
+
+    template<typename... Args>
+    static result_t<Args...> call(Args... args) noexcept
+    {
+        static function<Args...> const f = select<Args...>(cpu::selected_isa());
+        return f(args...);
+    }
+};
+
+// Conversions between float and IEEE half precision. The instructions belong
+// to F16C, an extension of AVX which no instruction set in cpu::isa implies,
+// and to AVX-512F, so the kernels are chosen by f16c_dispatch rather than
+// dispatch. The AVX-512 conversions are the zero-masked forms, as GCC warns
+// that the merge source of the unmasked forms is uninitialized.
+struct float16_widen_kernel
+{
+    static void generic(std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = float_from_binary16(ieee_half_format(), a[i]);
+        }
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    NEO_DETAIL_TARGET("avx,f16c")
+    static void f16c(std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        std::size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(x));
+        }
+
+        generic(a + i, out + i, count - i);
+    }
+
+    NEO_DETAIL_TARGET("avx512f")
+    static void avx512(std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        std::size_t i = 0;
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i));
+            _mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(0xffff, x));
+        }
+
+        generic(a + i, out + i, count - i);
+    }
+#endif
+};
+
+struct float16_narrow_kernel
+{
+    static void generic(float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = binary16_from_float<ieee_half_format>(a[i]);
+        }
+    }
+
+#if defined(NEO_DETAIL_KERNELS_X86)
+    NEO_DETAIL_TARGET("avx,f16c")
+    static void f16c(float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        std::size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i const x = _mm256_cvtps_ph(_mm256_loadu_ps(a + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), x);
+        }
+
+        generic(a + i, out + i, count - i);
+    }
+
+    NEO_DETAIL_TARGET("avx512f")
+    static void avx512(float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        std::size_t i = 0;
+
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i const x = _mm512_maskz_cvtps_ph(0xffff, _mm512_loadu_ps(a + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+        }
+
+        generic(a + i, out + i, count - i);
+    }
+#endif
+};
+
+// Calls the AVX-512 implementation of Kernel if cpu::selected_isa() allows it,
+// or the F16C implementation if AVX2 is allowed and the processor has F16C.
+template<typename Kernel>
+struct f16c_dispatch
+{
+    using function = decltype(&Kernel::generic);
+
+    static function select(cpu::isa isa, cpu::features const& features) noexcept
+    {
+#if defined(NEO_DETAIL_KERNELS_X86)
+        if (isa >= cpu::isa::avx512)
+        {
+            return &Kernel::avx512;
+        }
+
+        if (isa >= cpu::isa::avx2 && features.f16c)
+        {
+            return &Kernel::f16c;
+        }
+#else
+        static_cast<void>(isa);
+        static_cast<void>(features);
+#endif
+
+        return &Kernel::generic;
+    }
+
+    template<typename... Args>
+    static void call(Args... args) noexcept
+    {
+        static function const f = select(cpu::selected_isa(), cpu::detected_features());
+        f(args...);
+    }
+};
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_KERNELS_HPP
@@ -0,0 +1,134 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_MOD_INT_HPP
+#define NEO_DETAIL_MOD_INT_HPP
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+// The storage type of residues modulo `Modulus`.
+template<std::uint64_t Modulus>
+using mod_storage_t = typename std::conditional<(Modulus <= 0xffffffffu), std::uint32_t, std::uint64_t>::type;
+
+// The inverse of an odd `n` modulo 2^w. Each Newton step doubles the number
+// of correct low bits, and `n` is its own inverse modulo 8.
+template<typename T>
+constexpr T inverse_mod_word(T n) noexcept
+{
+    T x = n;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        x = static_cast<T>(x * static_cast<T>(2u - static_cast<T>(n * x)));
+    }
+
+    return x;
+}
+
+// 2^(2w) mod `n`, computed by doubling, so no wider division is needed.
+template<typename T>
+constexpr T r_squared_mod(T n) noexcept
+{
+    T x = static_cast<T>(static_cast<T>(0u - n) % n);
+
+    for (int i = 0; i < static_cast<int>(sizeof(T) * 8); ++i)
+    {
+        x = x >= n - x ? static_cast<T>(x - (n - x)) : static_cast<T>(x + x);
+    }
+
+    return x;
+}
+
+// The constants of Montgomery arithmetic modulo an odd `modulus` less than
+// R = 2^w, where w is the width of T. A residue x is represented by xR mod
+// `modulus`, so that products can be reduced with multiplications and shifts
+// rather than division.
+template<typename T>
+struct montgomery
+{
+    T modulus;
+    T inverse;
+    T r_squared;
+
+    constexpr explicit montgomery(T n) noexcept :
+        modulus(n),
+        inverse(inverse_mod_word(n)),
+        r_squared(r_squared_mod(n))
+    {
+    }
+
+    // Returns tR^-1 mod `modulus` for t = high * R + low less than
+    // `modulus` * R. m = low * `inverse` gives m * `modulus` the same low word
+    // as t, so t - m * `modulus` is a multiple of R, and the difference of the
+    // high words is in (-`modulus`, `modulus`). Every modulus less than R
+    // works, as there are no carries.
+    constexpr T reduce(T high, T low) const noexcept
+    {
+        T const h = mul_high(static_cast<T>(low * inverse), modulus);
+        return high >= h ? static_cast<T>(high - h) : static_cast<T>(high - h + modulus);
+    }
+
+    // xyR^-1 mod `modulus`, which is the representation of the product of the
+    // residues represented by `x` and `y`.
+    constexpr T mul(T x, T y) const noexcept
+    {
+        return reduce(mul_high(x, y), static_cast<T>(x * y));
+    }
+
+    constexpr T add(T x, T y) const noexcept
+    {
+        return x >= modulus - y ? static_cast<T>(x - (modulus - y)) : static_cast<T>(x + y);
+    }
+
+    constexpr T sub(T x, T y) const noexcept
+    {
+        return x >= y ? static_cast<T>(x - y) : static_cast<T>(x - y + modulus);
+    }
+
+    // The representation of `x`, which need not be reduced.
+    constexpr T to_montgomery(T x) const noexcept
+    {
+        return mul(static_cast<T>(x % modulus), r_squared);
+    }
+
+    constexpr T from_montgomery(T x) const noexcept
+    {
+        return reduce(0u, x);
+    }
+
+    // The representation of x^e, for the representation `x`.
+    constexpr T pow(T x, std::uint64_t e) const noexcept
+    {
+        T result = to_montgomery(1u);
+
+        for (; e != 0; e >>= 1)
+        {
+            if ((e & 1u) != 0)
+            {
+                result = mul(result, x);
+            }
+
+            x = mul(x, x);
+        }
+
+        return result;
+    }
+};
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_MOD_INT_HPP
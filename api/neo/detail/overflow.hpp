@@ -0,0 +1,183 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_OVERFLOW_HPP
+#define NEO_DETAIL_OVERFLOW_HPP
+
+#include <neo/detail/int128.hpp>
+
+#include <limits>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define NEO_DETAIL_OVERFLOW_BUILTINS
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Portable overflow checks, used where the compiler lacks the overflow
+// builtins. Each stores the wrapped result and returns true on overflow.
+
+template<typename T>
+bool portable_add_overflow(T lhs, T rhs, T& result) noexcept
+{
+    using unsigned_type = make_unsigned_t<T>;
+
+    result = static_cast<T>(static_cast<unsigned_type>(static_cast<unsigned_type>(lhs) + static_cast<unsigned_type>(rhs)));
+
+    return is_signed<T>::value ?
+        ((lhs ^ result) & (rhs ^ result)) < 0 :
+        result < lhs;
+}
+
+template<typename T>
+bool portable_sub_overflow(T lhs, T rhs, T& result) noexcept
+{
+    using unsigned_type = make_unsigned_t<T>;
+
+    result = static_cast<T>(static_cast<unsigned_type>(static_cast<unsigned_type>(lhs) - static_cast<unsigned_type>(rhs)));
+
+    return is_signed<T>::value ?
+        ((lhs ^ rhs) & (lhs ^ result)) < 0 :
+        lhs < rhs;
+}
+
+// Types narrower than long long are multiplied in long long and range checked.
+template<typename T>
+bool portable_mul_overflow(T lhs, T rhs, T& result, std::true_type) noexcept
+{
+    using wide_type = typename std::conditional<is_signed<T>::value,
+        long long, unsigned long long>::type;
+
+    wide_type const product = static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs);
+    result = static_cast<T>(product);
+
+    return product < static_cast<wide_type>(numeric_limits<T>::min()) ||
+        product > static_cast<wide_type>(numeric_limits<T>::max());
+}
+
+// Wider types multiply with wraparound, then check that dividing the result
+// recovers the operand.
+template<typename T>
+bool portable_mul_overflow(T lhs, T rhs, T& result, std::false_type) noexcept
+{
+    using unsigned_type = make_unsigned_t<T>;
+
+    result = static_cast<T>(static_cast<unsigned_type>(lhs) * static_cast<unsigned_type>(rhs));
+
+    if (rhs == 0)
+    {
+        return false;
+    }
+
+    if (is_signed<T>::value && rhs == static_cast<T>(-1))
+    {
+        return lhs == numeric_limits<T>::min();
+    }
+
+    return result / rhs != lhs;
+}
+
+template<typename T>
+bool portable_mul_overflow(T lhs, T rhs, T& result) noexcept
+{
+    return portable_mul_overflow(lhs, rhs, result,
+            std::integral_constant<bool, (sizeof(T) < sizeof(long long))>());
+}
+
+template<typename T>
+bool add_overflow(T lhs, T rhs, T& result) noexcept
+{
+#if defined(NEO_DETAIL_OVERFLOW_BUILTINS)
+    return __builtin_add_overflow(lhs, rhs, &result);
+#else
+    return portable_add_overflow(lhs, rhs, result);
+#endif
+}
+
+template<typename T>
+bool sub_overflow(T lhs, T rhs, T& result) noexcept
+{
+#if defined(NEO_DETAIL_OVERFLOW_BUILTINS)
+    return __builtin_sub_overflow(lhs, rhs, &result);
+#else
+    return portable_sub_overflow(lhs, rhs, result);
+#endif
+}
+
+template<typename T>
+bool mul_overflow(T lhs, T rhs, T& result) noexcept
+{
+#if defined(NEO_DETAIL_OVERFLOW_BUILTINS)
+    return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+    return portable_mul_overflow(lhs, rhs, result);
+#endif
+}
+
+// Saturating arithmetic. Each computes the wrapped result and the limit it
+// saturates to, then selects between them with a mask rather than a
+// conditional, which compilers tend to turn back into a branch.
+
+template<typename T>
+T select(bool condition, T if_true, T if_false) noexcept
+{
+    using unsigned_type = make_unsigned_t<T>;
+
+    unsigned_type const mask = static_cast<unsigned_type>(0u - static_cast<unsigned_type>(condition));
+
+    return static_cast<T>((static_cast<unsigned_type>(if_true) & mask) |
+            (static_cast<unsigned_type>(if_false) & static_cast<unsigned_type>(~mask)));
+}
+
+// Returns the minimum of T if `negative` is true, and the maximum otherwise.
+template<typename T>
+T saturation_limit(bool negative) noexcept
+{
+    using unsigned_type = make_unsigned_t<T>;
+
+    return static_cast<T>(static_cast<unsigned_type>(numeric_limits<T>::max()) +
+            static_cast<unsigned_type>(is_signed<T>::value && negative));
+}
+
+template<typename T>
+T saturating_add(T lhs, T rhs) noexcept
+{
+    T result;
+    bool const overflow = add_overflow(lhs, rhs, result);
+    T const limit = saturation_limit<T>(lhs < 0);
+
+    return select(overflow, limit, result);
+}
+
+template<typename T>
+T saturating_sub(T lhs, T rhs) noexcept
+{
+    T result;
+    bool const overflow = sub_overflow(lhs, rhs, result);
+    T const limit = is_signed<T>::value ? saturation_limit<T>(lhs < 0) : T(0);
+
+    return select(overflow, limit, result);
+}
+
+template<typename T>
+T saturating_mul(T lhs, T rhs) noexcept
+{
+    T result;
+    bool const overflow = mul_overflow(lhs, rhs, result);
+    T const limit = saturation_limit<T>((lhs < 0) != (rhs < 0));
+
+    return select(overflow, limit, result);
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_OVERFLOW_HPP
@@ -0,0 +1,100 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_PAGES_HPP
+#define NEO_DETAIL_PAGES_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#define NEO_DETAIL_PAGES_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define NEO_DETAIL_PAGES_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef NEO_DETAIL_PAGES_NOMINMAX
+#undef NOMINMAX
+#undef NEO_DETAIL_PAGES_NOMINMAX
+#endif
+#ifdef NEO_DETAIL_PAGES_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef NEO_DETAIL_PAGES_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <sys/mman.h>
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Allocations of at least this many bytes are mapped directly from the
+// operating system, which always supplies zero-filled pages. Those pages are
+// only faulted in when first touched, so a large zeroed allocation costs
+// nothing up front.
+constexpr std::size_t page_allocation_threshold = 128 * 1024;
+
+inline void* allocate_pages(std::size_t bytes)
+{
+#if defined(_WIN32)
+    return ::VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+#endif
+}
+
+inline void deallocate_pages(void* p, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    (void)bytes;
+    ::VirtualFree(p, 0, MEM_RELEASE);
+#else
+    ::munmap(p, bytes);
+#endif
+}
+
+// Allocates `bytes` bytes of storage, suitably aligned for any fundamental
+// type. If `zeroed` is true, the storage is filled with zero bytes.
+inline void* allocate(std::size_t bytes, bool zeroed)
+{
+    void* p = bytes >= page_allocation_threshold ?
+        allocate_pages(bytes) :
+        zeroed ? std::calloc(bytes, 1) : std::malloc(bytes);
+
+    if (!p && bytes != 0)
+    {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+// Deallocates storage returned by allocate(bytes, zeroed).
+inline void deallocate(void* p, std::size_t bytes) noexcept
+{
+    if (bytes >= page_allocation_threshold)
+    {
+        deallocate_pages(p, bytes);
+    }
+    else
+    {
+        std::free(p);
+    }
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_PAGES_HPP
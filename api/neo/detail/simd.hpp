@@ -0,0 +1,299 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_SIMD_HPP
+#define NEO_DETAIL_SIMD_HPP
+
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Instruction sets enabled at compile time
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NEO_DETAIL_SIMD_SSE2
+#endif
+#if defined(NEO_DETAIL_SIMD_SSE2) && (defined(__SSE4_1__) || defined(__AVX__))
+#define NEO_DETAIL_SIMD_SSE41
+#endif
+#if defined(NEO_DETAIL_SIMD_SSE2) && defined(__AVX__)
+#define NEO_DETAIL_SIMD_AVX
+#endif
+#if defined(NEO_DETAIL_SIMD_SSE2) && defined(__AVX2__)
+#define NEO_DETAIL_SIMD_AVX2
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define NEO_DETAIL_SIMD_NEON
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+// The sizes in bytes of the widest integer and floating-point vector registers
+// enabled at compile time. AVX widens only the floating-point registers;
+// 32-byte integer operations need AVX2.
+#if defined(NEO_DETAIL_SIMD_AVX2)
+constexpr std::size_t simd_integer_register_size = 32;
+#else
+constexpr std::size_t simd_integer_register_size = 16;
+#endif
+
+#if defined(NEO_DETAIL_SIMD_AVX)
+constexpr std::size_t simd_float_register_size = 32;
+#else
+constexpr std::size_t simd_float_register_size = 16;
+#endif
+
+// The size in bytes of the widest vector register which holds lanes of T.
+template<typename T>
+struct simd_register_size : std::integral_constant<std::size_t,
+        std::is_floating_point<T>::value ? simd_float_register_size : simd_integer_register_size
+    >
+{
+};
+
+template<std::size_t Size>
+using size_tag = std::integral_constant<std::size_t, Size>;
+
+template<std::size_t Size, bool Signed>
+struct integer;
+
+template<> struct integer<1, true> { using type = std::int8_t; };
+template<> struct integer<2, true> { using type = std::int16_t; };
+template<> struct integer<4, true> { using type = std::int32_t; };
+template<> struct integer<8, true> { using type = std::int64_t; };
+template<> struct integer<1, false> { using type = std::uint8_t; };
+template<> struct integer<2, false> { using type = std::uint16_t; };
+template<> struct integer<4, false> { using type = std::uint32_t; };
+template<> struct integer<8, false> { using type = std::uint64_t; };
+
+template<std::size_t Size, bool Signed>
+using integer_t = typename integer<Size, Signed>::type;
+
+// The type in which simd_generic does the arithmetic of lanes of type T.
+// Integer lanes are computed in an unsigned type at least as wide as
+// unsigned int, so that they wrap as the vector instructions do, rather than
+// overflowing after promotion to int.
+template<typename T, bool = std::is_integral<T>::value>
+struct simd_arithmetic
+{
+    using type = T;
+};
+
+template<typename T>
+struct simd_arithmetic<T, true>
+{
+    using type = common_type_t<integer_t<sizeof(T), false>, unsigned>;
+};
+
+template<typename T>
+using simd_arithmetic_t = typename simd_arithmetic<T>::type;
+
+template<typename T, std::size_t N>
+struct simd_array
+{
+    T lanes[N];
+};
+
+// Implements each operation on N lanes of T held in Register one lane at a
+// time, which compilers are often able to vectorize by themselves. Backends
+// derive from this and hide the operations they implement natively.
+template<typename T, std::size_t N, typename Register>
+struct simd_generic
+{
+    static_assert(sizeof(Register) == sizeof(T) * N, "register size does not match lanes");
+
+    using type = Register;
+    using arithmetic = simd_arithmetic_t<T>;
+
+    static constexpr int lane_bits = static_cast<int>(sizeof(T) * 8);
+
+    static Register load(T const* p) noexcept
+    {
+        Register r;
+        std::memcpy(&r, p, sizeof(r));
+        return r;
+    }
+
+    static void store(Register const& r, T* p) noexcept
+    {
+        std::memcpy(p, &r, sizeof(r));
+    }
+
+    static Register broadcast(T x) noexcept
+    {
+        T lanes[N];
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            lanes[i] = x;
+        }
+
+        return load(lanes);
+    }
+
+    template<typename F>
+    static Register map(Register const& a, F f) noexcept
+    {
+        T x[N];
+        store(a, x);
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            x[i] = static_cast<T>(f(x[i]));
+        }
+
+        return load(x);
+    }
+
+    template<typename F>
+    static Register map(Register const& a, Register const& b, F f) noexcept
+    {
+        T x[N];
+        T y[N];
+        store(a, x);
+        store(b, y);
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            x[i] = static_cast<T>(f(x[i], y[i]));
+        }
+
+        return load(x);
+    }
+
+    template<typename Compare>
+    static void compare(Register const& a, Register const& b, bool* result, Compare c) noexcept
+    {
+        T x[N];
+        T y[N];
+        store(a, x);
+        store(b, y);
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            result[i] = c(x[i], y[i]);
+        }
+    }
+
+    static Register add(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return static_cast<arithmetic>(x) + static_cast<arithmetic>(y); });
+    }
+
+    static Register sub(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return static_cast<arithmetic>(x) - static_cast<arithmetic>(y); });
+    }
+
+    static Register mul(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return static_cast<arithmetic>(x) * static_cast<arithmetic>(y); });
+    }
+
+    static Register div(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return x / y; });
+    }
+
+    static Register mod(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return x % y; });
+    }
+
+    // Matches the semantics of the SSE min and max instructions, which
+    // return the second operand if either is NaN.
+    static Register min(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return x < y ? x : y; });
+    }
+
+    static Register max(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return y < x ? x : y; });
+    }
+
+    static Register neg(Register const& a, std::true_type) noexcept
+    {
+        return map(a, [](T x) { return static_cast<arithmetic>(0) - static_cast<arithmetic>(x); });
+    }
+
+    static Register neg(Register const& a, std::false_type) noexcept
+    {
+        return map(a, [](T x) { return -x; });
+    }
+
+    static Register neg(Register const& a) noexcept
+    {
+        return neg(a, std::is_integral<T>());
+    }
+
+    static Register bit_and(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return x & y; });
+    }
+
+    static Register bit_or(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return x | y; });
+    }
+
+    static Register bit_xor(Register const& a, Register const& b) noexcept
+    {
+        return map(a, b, [](T x, T y) { return x ^ y; });
+    }
+
+    static Register bit_not(Register const& a) noexcept
+    {
+        return map(a, [](T x) { return ~x; });
+    }
+
+    // Shifts by a negative count, or by at least the width of a lane, give 0,
+    // as the vector shift instructions do, which treat the count as unsigned.
+    // Shifts are only defined for unsigned lanes.
+    static Register shift_left(Register const& a, int count) noexcept
+    {
+        bool const in_range = static_cast<unsigned>(count) < static_cast<unsigned>(lane_bits);
+        return map(a, [=](T x) { return in_range ? static_cast<arithmetic>(x) << count : 0u; });
+    }
+
+    static Register shift_right(Register const& a, int count) noexcept
+    {
+        bool const in_range = static_cast<unsigned>(count) < static_cast<unsigned>(lane_bits);
+        return map(a, [=](T x) { return in_range ? static_cast<arithmetic>(x) >> count : 0u; });
+    }
+
+    static T reduce_add(Register const& a) noexcept
+    {
+        T x[N];
+        store(a, x);
+
+        arithmetic sum = arithmetic();
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            sum = static_cast<arithmetic>(sum + static_cast<arithmetic>(x[i]));
+        }
+
+        return static_cast<T>(sum);
+    }
+};
+
+// The implementation of simd<T, N>. Backends specialize this for the lane
+// types and register sizes they support.
+template<typename T, std::size_t N, typename = void>
+struct simd_impl : simd_generic<T, N, simd_array<T, N>>
+{
+};
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_SIMD_HPP
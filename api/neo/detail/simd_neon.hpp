@@ -0,0 +1,161 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_SIMD_NEON_HPP
+#define NEO_DETAIL_SIMD_NEON_HPP
+
+#include <neo/detail/simd.hpp>
+
+#if defined(NEO_DETAIL_SIMD_NEON)
+
+#include <arm_neon.h>
+
+namespace neo
+{
+
+namespace detail
+{
+
+namespace neon
+{
+
+// 128-bit registers, one type per lane type. Operations are overloaded on the
+// register type.
+template<std::size_t Size, bool Signed, bool Float>
+struct register_type
+{
+};
+
+#define NEO_DETAIL_SIMD_NEON_REGISTER(Size, Signed, Float, Register) \
+    template<> \
+    struct register_type<Size, Signed, Float> \
+    { \
+        using type = Register; \
+    };
+
+#define NEO_DETAIL_SIMD_NEON_ARITHMETIC(Register, suffix) \
+    inline Register add(Register a, Register b) noexcept { return vaddq_##suffix(a, b); } \
+    inline Register sub(Register a, Register b) noexcept { return vsubq_##suffix(a, b); } \
+    inline Register mul(Register a, Register b) noexcept { return vmulq_##suffix(a, b); }
+
+#define NEO_DETAIL_SIMD_NEON_MIN_MAX(Register, suffix) \
+    inline Register min(Register a, Register b) noexcept { return vminq_##suffix(a, b); } \
+    inline Register max(Register a, Register b) noexcept { return vmaxq_##suffix(a, b); }
+
+// vminq and vmaxq return NaN if either operand is NaN, so floating-point
+// minimum and maximum select lanes explicitly to match the generic semantics.
+#define NEO_DETAIL_SIMD_NEON_FLOAT_MIN_MAX(Register, suffix) \
+    inline Register min(Register a, Register b) noexcept { return vbslq_##suffix(vcltq_##suffix(a, b), a, b); } \
+    inline Register max(Register a, Register b) noexcept { return vbslq_##suffix(vcltq_##suffix(b, a), a, b); }
+
+#define NEO_DETAIL_SIMD_NEON_BITWISE(Register, suffix) \
+    inline Register bit_and(Register a, Register b) noexcept { return vandq_##suffix(a, b); } \
+    inline Register bit_or(Register a, Register b) noexcept { return vorrq_##suffix(a, b); } \
+    inline Register bit_xor(Register a, Register b) noexcept { return veorq_##suffix(a, b); } \
+    inline Register bit_not(Register a) noexcept { return vmvnq_##suffix(a); }
+
+NEO_DETAIL_SIMD_NEON_REGISTER(1, true, false, int8x16_t)
+NEO_DETAIL_SIMD_NEON_REGISTER(2, true, false, int16x8_t)
+NEO_DETAIL_SIMD_NEON_REGISTER(4, true, false, int32x4_t)
+NEO_DETAIL_SIMD_NEON_REGISTER(1, false, false, uint8x16_t)
+NEO_DETAIL_SIMD_NEON_REGISTER(2, false, false, uint16x8_t)
+NEO_DETAIL_SIMD_NEON_REGISTER(4, false, false, uint32x4_t)
+NEO_DETAIL_SIMD_NEON_REGISTER(4, true, true, float32x4_t)
+
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(int8x16_t, s8)
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(int16x8_t, s16)
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(int32x4_t, s32)
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(uint8x16_t, u8)
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(uint16x8_t, u16)
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(uint32x4_t, u32)
+NEO_DETAIL_SIMD_NEON_ARITHMETIC(float32x4_t, f32)
+
+NEO_DETAIL_SIMD_NEON_MIN_MAX(int8x16_t, s8)
+NEO_DETAIL_SIMD_NEON_MIN_MAX(int16x8_t, s16)
+NEO_DETAIL_SIMD_NEON_MIN_MAX(int32x4_t, s32)
+NEO_DETAIL_SIMD_NEON_MIN_MAX(uint8x16_t, u8)
+NEO_DETAIL_SIMD_NEON_MIN_MAX(uint16x8_t, u16)
+NEO_DETAIL_SIMD_NEON_MIN_MAX(uint32x4_t, u32)
+NEO_DETAIL_SIMD_NEON_FLOAT_MIN_MAX(float32x4_t, f32)
+
+NEO_DETAIL_SIMD_NEON_BITWISE(uint8x16_t, u8)
+NEO_DETAIL_SIMD_NEON_BITWISE(uint16x8_t, u16)
+NEO_DETAIL_SIMD_NEON_BITWISE(uint32x4_t, u32)
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+NEO_DETAIL_SIMD_NEON_REGISTER(8, true, true, float64x2_t)
+
+inline float64x2_t add(float64x2_t a, float64x2_t b) noexcept { return vaddq_f64(a, b); }
+inline float64x2_t sub(float64x2_t a, float64x2_t b) noexcept { return vsubq_f64(a, b); }
+inline float64x2_t mul(float64x2_t a, float64x2_t b) noexcept { return vmulq_f64(a, b); }
+
+NEO_DETAIL_SIMD_NEON_FLOAT_MIN_MAX(float64x2_t, f64)
+#endif
+
+#undef NEO_DETAIL_SIMD_NEON_REGISTER
+#undef NEO_DETAIL_SIMD_NEON_ARITHMETIC
+#undef NEO_DETAIL_SIMD_NEON_MIN_MAX
+#undef NEO_DETAIL_SIMD_NEON_FLOAT_MIN_MAX
+#undef NEO_DETAIL_SIMD_NEON_BITWISE
+
+template<typename T>
+using register_for = register_type<sizeof(T), std::is_signed<T>::value, std::is_floating_point<T>::value>;
+
+template<typename T, std::size_t N, typename = void>
+struct has_register : std::false_type
+{
+};
+
+template<typename T, std::size_t N>
+struct has_register<T, N, enable_if_t<
+    sizeof(T) * N == 16 &&
+    sizeof(typename register_for<T>::type) != 0>
+> : std::true_type
+{
+};
+
+} // namespace neon
+
+// Bitwise operations are only defined for unsigned lanes, which is where
+// NEON provides them; signed lanes inherit the generic versions, which are
+// never instantiated.
+template<typename T, std::size_t N, bool =
+    std::is_integral<T>::value && std::is_unsigned<T>::value
+>
+struct simd_neon :
+    simd_generic<T, N, typename neon::register_for<T>::type>
+{
+    using type = typename neon::register_for<T>::type;
+
+    static type add(type a, type b) noexcept { return neon::add(a, b); }
+    static type sub(type a, type b) noexcept { return neon::sub(a, b); }
+    static type mul(type a, type b) noexcept { return neon::mul(a, b); }
+    static type min(type a, type b) noexcept { return neon::min(a, b); }
+    static type max(type a, type b) noexcept { return neon::max(a, b); }
+};
+
+template<typename T, std::size_t N>
+struct simd_neon<T, N, true> : simd_neon<T, N, false>
+{
+    using type = typename neon::register_for<T>::type;
+
+    static type bit_and(type a, type b) noexcept { return neon::bit_and(a, b); }
+    static type bit_or(type a, type b) noexcept { return neon::bit_or(a, b); }
+    static type bit_xor(type a, type b) noexcept { return neon::bit_xor(a, b); }
+    static type bit_not(type a) noexcept { return neon::bit_not(a); }
+};
+
+template<typename T, std::size_t N>
+struct simd_impl<T, N, enable_if_t<neon::has_register<T, N>::value>> : simd_neon<T, N>
+{
+};
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_SIMD_NEON
+
+#endif // NEO_DETAIL_SIMD_NEON_HPP
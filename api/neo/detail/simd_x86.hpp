@@ -0,0 +1,317 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_SIMD_X86_HPP
+#define NEO_DETAIL_SIMD_X86_HPP
+
+#include <neo/detail/simd.hpp>
+
+#if defined(NEO_DETAIL_SIMD_SSE2)
+
+#include <emmintrin.h>
+#if defined(NEO_DETAIL_SIMD_SSE41)
+#include <smmintrin.h>
+#endif
+#if defined(NEO_DETAIL_SIMD_AVX)
+#include <immintrin.h>
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+namespace x86
+{
+
+template<std::size_t Size, bool Signed>
+struct lane
+{
+};
+
+// Integer Registers
+//-------------------
+//
+// Operations are overloaded on the register type and the lane size (and
+// signedness where it matters). Combinations without an instruction fall back
+// to the generic lane-wise implementation.
+
+template<typename Register, std::size_t Size, bool Signed = false>
+using generic = simd_generic<integer_t<Size, Signed>, sizeof(Register) / Size, Register>;
+
+inline __m128i add(__m128i a, __m128i b, size_tag<1>) noexcept { return _mm_add_epi8(a, b); }
+inline __m128i add(__m128i a, __m128i b, size_tag<2>) noexcept { return _mm_add_epi16(a, b); }
+inline __m128i add(__m128i a, __m128i b, size_tag<4>) noexcept { return _mm_add_epi32(a, b); }
+inline __m128i add(__m128i a, __m128i b, size_tag<8>) noexcept { return _mm_add_epi64(a, b); }
+
+inline __m128i sub(__m128i a, __m128i b, size_tag<1>) noexcept { return _mm_sub_epi8(a, b); }
+inline __m128i sub(__m128i a, __m128i b, size_tag<2>) noexcept { return _mm_sub_epi16(a, b); }
+inline __m128i sub(__m128i a, __m128i b, size_tag<4>) noexcept { return _mm_sub_epi32(a, b); }
+inline __m128i sub(__m128i a, __m128i b, size_tag<8>) noexcept { return _mm_sub_epi64(a, b); }
+
+template<typename Register, std::size_t Size>
+Register mul(Register a, Register b, size_tag<Size>) noexcept
+{
+    return generic<Register, Size>::mul(a, b);
+}
+
+inline __m128i mul(__m128i a, __m128i b, size_tag<2>) noexcept { return _mm_mullo_epi16(a, b); }
+#if defined(NEO_DETAIL_SIMD_SSE41)
+inline __m128i mul(__m128i a, __m128i b, size_tag<4>) noexcept { return _mm_mullo_epi32(a, b); }
+#endif
+
+template<typename Register, std::size_t Size, bool Signed>
+Register min(Register a, Register b, lane<Size, Signed>) noexcept
+{
+    return generic<Register, Size, Signed>::min(a, b);
+}
+
+template<typename Register, std::size_t Size, bool Signed>
+Register max(Register a, Register b, lane<Size, Signed>) noexcept
+{
+    return generic<Register, Size, Signed>::max(a, b);
+}
+
+inline __m128i min(__m128i a, __m128i b, lane<1, false>) noexcept { return _mm_min_epu8(a, b); }
+inline __m128i min(__m128i a, __m128i b, lane<2, true>) noexcept { return _mm_min_epi16(a, b); }
+inline __m128i max(__m128i a, __m128i b, lane<1, false>) noexcept { return _mm_max_epu8(a, b); }
+inline __m128i max(__m128i a, __m128i b, lane<2, true>) noexcept { return _mm_max_epi16(a, b); }
+#if defined(NEO_DETAIL_SIMD_SSE41)
+inline __m128i min(__m128i a, __m128i b, lane<1, true>) noexcept { return _mm_min_epi8(a, b); }
+inline __m128i min(__m128i a, __m128i b, lane<2, false>) noexcept { return _mm_min_epu16(a, b); }
+inline __m128i min(__m128i a, __m128i b, lane<4, true>) noexcept { return _mm_min_epi32(a, b); }
+inline __m128i min(__m128i a, __m128i b, lane<4, false>) noexcept { return _mm_min_epu32(a, b); }
+inline __m128i max(__m128i a, __m128i b, lane<1, true>) noexcept { return _mm_max_epi8(a, b); }
+inline __m128i max(__m128i a, __m128i b, lane<2, false>) noexcept { return _mm_max_epu16(a, b); }
+inline __m128i max(__m128i a, __m128i b, lane<4, true>) noexcept { return _mm_max_epi32(a, b); }
+inline __m128i max(__m128i a, __m128i b, lane<4, false>) noexcept { return _mm_max_epu32(a, b); }
+#endif
+
+inline __m128i bit_and(__m128i a, __m128i b) noexcept { return _mm_and_si128(a, b); }
+inline __m128i bit_or(__m128i a, __m128i b) noexcept { return _mm_or_si128(a, b); }
+inline __m128i bit_xor(__m128i a, __m128i b) noexcept { return _mm_xor_si128(a, b); }
+inline __m128i bit_not(__m128i a) noexcept { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+
+// Bitwise operations are only defined for unsigned lanes, so right shifts
+// are always logical.
+template<typename Register, std::size_t Size>
+Register shift_left(Register a, int count, size_tag<Size>) noexcept
+{
+    return generic<Register, Size>::shift_left(a, count);
+}
+
+template<typename Register, std::size_t Size>
+Register shift_right(Register a, int count, size_tag<Size>) noexcept
+{
+    return generic<Register, Size>::shift_right(a, count);
+}
+
+inline __m128i shift_left(__m128i a, int count, size_tag<2>) noexcept { return _mm_sll_epi16(a, _mm_cvtsi32_si128(count)); }
+inline __m128i shift_left(__m128i a, int count, size_tag<4>) noexcept { return _mm_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+inline __m128i shift_left(__m128i a, int count, size_tag<8>) noexcept { return _mm_sll_epi64(a, _mm_cvtsi32_si128(count)); }
+inline __m128i shift_right(__m128i a, int count, size_tag<2>) noexcept { return _mm_srl_epi16(a, _mm_cvtsi32_si128(count)); }
+inline __m128i shift_right(__m128i a, int count, size_tag<4>) noexcept { return _mm_srl_epi32(a, _mm_cvtsi32_si128(count)); }
+inline __m128i shift_right(__m128i a, int count, size_tag<8>) noexcept { return _mm_srl_epi64(a, _mm_cvtsi32_si128(count)); }
+
+#if defined(NEO_DETAIL_SIMD_AVX2)
+
+inline __m256i add(__m256i a, __m256i b, size_tag<1>) noexcept { return _mm256_add_epi8(a, b); }
+inline __m256i add(__m256i a, __m256i b, size_tag<2>) noexcept { return _mm256_add_epi16(a, b); }
+inline __m256i add(__m256i a, __m256i b, size_tag<4>) noexcept { return _mm256_add_epi32(a, b); }
+inline __m256i add(__m256i a, __m256i b, size_tag<8>) noexcept { return _mm256_add_epi64(a, b); }
+
+inline __m256i sub(__m256i a, __m256i b, size_tag<1>) noexcept { return _mm256_sub_epi8(a, b); }
+inline __m256i sub(__m256i a, __m256i b, size_tag<2>) noexcept { return _mm256_sub_epi16(a, b); }
+inline __m256i sub(__m256i a, __m256i b, size_tag<4>) noexcept { return _mm256_sub_epi32(a, b); }
+inline __m256i sub(__m256i a, __m256i b, size_tag<8>) noexcept { return _mm256_sub_epi64(a, b); }
+
+inline __m256i mul(__m256i a, __m256i b, size_tag<2>) noexcept { return _mm256_mullo_epi16(a, b); }
+inline __m256i mul(__m256i a, __m256i b, size_tag<4>) noexcept { return _mm256_mullo_epi32(a, b); }
+
+inline __m256i min(__m256i a, __m256i b, lane<1, true>) noexcept { return _mm256_min_epi8(a, b); }
+inline __m256i min(__m256i a, __m256i b, lane<1, false>) noexcept { return _mm256_min_epu8(a, b); }
+inline __m256i min(__m256i a, __m256i b, lane<2, true>) noexcept { return _mm256_min_epi16(a, b); }
+inline __m256i min(__m256i a, __m256i b, lane<2, false>) noexcept { return _mm256_min_epu16(a, b); }
+inline __m256i min(__m256i a, __m256i b, lane<4, true>) noexcept { return _mm256_min_epi32(a, b); }
+inline __m256i min(__m256i a, __m256i b, lane<4, false>) noexcept { return _mm256_min_epu32(a, b); }
+inline __m256i max(__m256i a, __m256i b, lane<1, true>) noexcept { return _mm256_max_epi8(a, b); }
+inline __m256i max(__m256i a, __m256i b, lane<1, false>) noexcept { return _mm256_max_epu8(a, b); }
+inline __m256i max(__m256i a, __m256i b, lane<2, true>) noexcept { return _mm256_max_epi16(a, b); }
+inline __m256i max(__m256i a, __m256i b, lane<2, false>) noexcept { return _mm256_max_epu16(a, b); }
+inline __m256i max(__m256i a, __m256i b, lane<4, true>) noexcept { return _mm256_max_epi32(a, b); }
+inline __m256i max(__m256i a, __m256i b, lane<4, false>) noexcept { return _mm256_max_epu32(a, b); }
+
+inline __m256i bit_and(__m256i a, __m256i b) noexcept { return _mm256_and_si256(a, b); }
+inline __m256i bit_or(__m256i a, __m256i b) noexcept { return _mm256_or_si256(a, b); }
+inline __m256i bit_xor(__m256i a, __m256i b) noexcept { return _mm256_xor_si256(a, b); }
+inline __m256i bit_not(__m256i a) noexcept { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+
+inline __m256i shift_left(__m256i a, int count, size_tag<2>) noexcept { return _mm256_sll_epi16(a, _mm_cvtsi32_si128(count)); }
+inline __m256i shift_left(__m256i a, int count, size_tag<4>) noexcept { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+inline __m256i shift_left(__m256i a, int count, size_tag<8>) noexcept { return _mm256_sll_epi64(a, _mm_cvtsi32_si128(count)); }
+inline __m256i shift_right(__m256i a, int count, size_tag<2>) noexcept { return _mm256_srl_epi16(a, _mm_cvtsi32_si128(count)); }
+inline __m256i shift_right(__m256i a, int count, size_tag<4>) noexcept { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(count)); }
+inline __m256i shift_right(__m256i a, int count, size_tag<8>) noexcept { return _mm256_srl_epi64(a, _mm_cvtsi32_si128(count)); }
+
+#endif
+
+// Floating-Point Registers
+//--------------------------
+
+inline __m128 add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+inline __m128 sub(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+inline __m128 mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+inline __m128 div(__m128 a, __m128 b) noexcept { return _mm_div_ps(a, b); }
+inline __m128 min(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+inline __m128 max(__m128 a, __m128 b) noexcept { return _mm_max_ps(a, b); }
+
+inline __m128d add(__m128d a, __m128d b) noexcept { return _mm_add_pd(a, b); }
+inline __m128d sub(__m128d a, __m128d b) noexcept { return _mm_sub_pd(a, b); }
+inline __m128d mul(__m128d a, __m128d b) noexcept { return _mm_mul_pd(a, b); }
+inline __m128d div(__m128d a, __m128d b) noexcept { return _mm_div_pd(a, b); }
+inline __m128d min(__m128d a, __m128d b) noexcept { return _mm_min_pd(a, b); }
+inline __m128d max(__m128d a, __m128d b) noexcept { return _mm_max_pd(a, b); }
+
+#if defined(NEO_DETAIL_SIMD_AVX)
+
+inline __m256 add(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+inline __m256 sub(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+inline __m256 mul(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+inline __m256 div(__m256 a, __m256 b) noexcept { return _mm256_div_ps(a, b); }
+inline __m256 min(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+inline __m256 max(__m256 a, __m256 b) noexcept { return _mm256_max_ps(a, b); }
+
+inline __m256d add(__m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+inline __m256d sub(__m256d a, __m256d b) noexcept { return _mm256_sub_pd(a, b); }
+inline __m256d mul(__m256d a, __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+inline __m256d div(__m256d a, __m256d b) noexcept { return _mm256_div_pd(a, b); }
+inline __m256d min(__m256d a, __m256d b) noexcept { return _mm256_min_pd(a, b); }
+inline __m256d max(__m256d a, __m256d b) noexcept { return _mm256_max_pd(a, b); }
+
+#endif
+
+// Register Selection
+//--------------------
+
+template<std::size_t Size>
+struct integer_register
+{
+};
+
+template<>
+struct integer_register<16>
+{
+    using type = __m128i;
+};
+
+#if defined(NEO_DETAIL_SIMD_AVX2)
+template<>
+struct integer_register<32>
+{
+    using type = __m256i;
+};
+#endif
+
+template<typename T, std::size_t Size>
+struct float_register
+{
+};
+
+template<>
+struct float_register<float, 16>
+{
+    using type = __m128;
+};
+
+template<>
+struct float_register<double, 16>
+{
+    using type = __m128d;
+};
+
+#if defined(NEO_DETAIL_SIMD_AVX)
+template<>
+struct float_register<float, 32>
+{
+    using type = __m256;
+};
+
+template<>
+struct float_register<double, 32>
+{
+    using type = __m256d;
+};
+#endif
+
+template<typename T, std::size_t N, typename = void>
+struct has_integer_register : std::false_type
+{
+};
+
+template<typename T, std::size_t N>
+struct has_integer_register<T, N, enable_if_t<
+    std::is_integral<T>::value && sizeof(T) <= 8 &&
+    sizeof(typename integer_register<sizeof(T) * N>::type) != 0>
+> : std::true_type
+{
+};
+
+template<typename T, std::size_t N, typename = void>
+struct has_float_register : std::false_type
+{
+};
+
+template<typename T, std::size_t N>
+struct has_float_register<T, N, enable_if_t<
+    sizeof(typename float_register<T, sizeof(T) * N>::type) != 0>
+> : std::true_type
+{
+};
+
+} // namespace x86
+
+template<typename T, std::size_t N>
+struct simd_impl<T, N, enable_if_t<x86::has_integer_register<T, N>::value>> :
+    simd_generic<T, N, typename x86::integer_register<sizeof(T) * N>::type>
+{
+    using type = typename x86::integer_register<sizeof(T) * N>::type;
+    using size = size_tag<sizeof(T)>;
+    using lane = x86::lane<sizeof(T), std::is_signed<T>::value>;
+
+    static type add(type a, type b) noexcept { return x86::add(a, b, size()); }
+    static type sub(type a, type b) noexcept { return x86::sub(a, b, size()); }
+    static type mul(type a, type b) noexcept { return x86::mul(a, b, size()); }
+    static type min(type a, type b) noexcept { return x86::min(a, b, lane()); }
+    static type max(type a, type b) noexcept { return x86::max(a, b, lane()); }
+    static type bit_and(type a, type b) noexcept { return x86::bit_and(a, b); }
+    static type bit_or(type a, type b) noexcept { return x86::bit_or(a, b); }
+    static type bit_xor(type a, type b) noexcept { return x86::bit_xor(a, b); }
+    static type bit_not(type a) noexcept { return x86::bit_not(a); }
+    static type shift_left(type a, int count) noexcept { return x86::shift_left(a, count, size()); }
+    static type shift_right(type a, int count) noexcept { return x86::shift_right(a, count, size()); }
+};
+
+template<typename T, std::size_t N>
+struct simd_impl<T, N, enable_if_t<x86::has_float_register<T, N>::value>> :
+    simd_generic<T, N, typename x86::float_register<T, sizeof(T) * N>::type>
+{
+    using type = typename x86::float_register<T, sizeof(T) * N>::type;
+
+    static type add(type a, type b) noexcept { return x86::add(a, b); }
+    static type sub(type a, type b) noexcept { return x86::sub(a, b); }
+    static type mul(type a, type b) noexcept { return x86::mul(a, b); }
+    static type div(type a, type b) noexcept { return x86::div(a, b); }
+    static type min(type a, type b) noexcept { return x86::min(a, b); }
+    static type max(type a, type b) noexcept { return x86::max(a, b); }
+};
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_SIMD_SSE2
+
+#endif // NEO_DETAIL_SIMD_X86_HPP
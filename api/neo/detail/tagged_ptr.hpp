@@ -0,0 +1,113 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_TAGGED_PTR_HPP
+#define NEO_DETAIL_TAGGED_PTR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// x86-64 addresses are 48 bits wide, sign-extended to 64, so the upper 16
+// bits of a pointer can be recovered from bit 47. Other platforms may use the
+// upper bits for their own tags (e.g. AArch64 with memory tagging), so only
+// the alignment bits are used there.
+#if defined(__x86_64__) || defined(_M_X64)
+#define NEO_DETAIL_POINTER_HIGH_BITS 16
+#else
+#define NEO_DETAIL_POINTER_HIGH_BITS 0
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<std::size_t N>
+struct log2_size : std::integral_constant<std::size_t, 1 + log2_size<N / 2>::value>
+{
+};
+
+template<>
+struct log2_size<1> : std::integral_constant<std::size_t, 0>
+{
+};
+
+template<typename T>
+struct pointer_alignment : std::integral_constant<std::size_t, alignof(T)>
+{
+};
+
+template<typename T>
+struct pointer_alignment<T const> : pointer_alignment<T>
+{
+};
+
+template<typename T>
+struct pointer_alignment<T volatile> : pointer_alignment<T>
+{
+};
+
+template<typename T>
+struct pointer_alignment<T const volatile> : pointer_alignment<T>
+{
+};
+
+template<>
+struct pointer_alignment<void> : std::integral_constant<std::size_t, 1>
+{
+};
+
+// Where `Bits` tag bits are stored in a pointer to T: in the low bits, which
+// are zero because of the alignment of T, and then in the high bits. This is
+// only used in member functions, so that T may be incomplete where a tagged
+// pointer to it is declared.
+template<typename T, std::size_t Bits>
+struct tagged_layout
+{
+    static constexpr std::size_t alignment_bits = log2_size<pointer_alignment<T>::value>::value;
+    static constexpr std::size_t low_bits = Bits < alignment_bits ? Bits : alignment_bits;
+    static constexpr std::size_t high_bits = Bits - low_bits;
+    static constexpr std::size_t width = sizeof(std::uintptr_t) * 8;
+
+    static_assert(high_bits <= NEO_DETAIL_POINTER_HIGH_BITS,
+            "tagged_ptr has more tag bits than the alignment of T and the platform leave free");
+
+    static constexpr std::uintptr_t low_mask = (std::uintptr_t(1) << low_bits) - 1u;
+    static constexpr std::uintptr_t tag_mask = Bits == width ? ~std::uintptr_t(0) : (std::uintptr_t(1) << Bits) - 1u;
+
+    static std::uintptr_t pack(T* p, std::uintptr_t tag) noexcept
+    {
+        std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(p);
+        tag &= tag_mask;
+
+        return high_bits == 0 ?
+            address | tag :
+            ((address & (~std::uintptr_t(0) >> high_bits)) | (tag & low_mask) | ((tag >> low_bits) << (width - high_bits)));
+    }
+
+    // The high bits of the address are restored by sign extension.
+    static T* pointer(std::uintptr_t bits) noexcept
+    {
+        bits &= ~low_mask;
+
+        return reinterpret_cast<T*>(high_bits == 0 ? bits :
+            static_cast<std::uintptr_t>(static_cast<std::intptr_t>(bits << high_bits) >> high_bits));
+    }
+
+    static std::uintptr_t tag(std::uintptr_t bits) noexcept
+    {
+        return high_bits == 0 ?
+            bits & low_mask :
+            (bits & low_mask) | ((bits >> (width - high_bits)) << low_bits);
+    }
+};
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_TAGGED_PTR_HPP
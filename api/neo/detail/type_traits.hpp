@@ -23,6 +23,16 @@ using enable_if_t = typename std::enable_if<B, T>::type;
 template<typename... Ts>
 using common_type_t = typename std::common_type<Ts...>::type;
 
+template<typename T>
+struct identity
+{
+    using type = T;
+};
+
+// Prevents deduction of T from an argument.
+template<typename T>
+using identity_t = typename identity<T>::type;
+
 } // namespace detail
 
 } // namespace neo
@@ -0,0 +1,278 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DETAIL_WIDE_UINT_HPP
+#define NEO_DETAIL_WIDE_UINT_HPP
+
+#include <neo/detail/int128.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+// On x86-64, carries are propagated with the add-with-carry intrinsics, which
+// compile to chains of ADC and SBB instructions. Where BMI2 is enabled at
+// compile time, limb products use MULX, which leaves the flags of those chains
+// intact.
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
+#define NEO_DETAIL_ADDCARRY
+#if defined(__BMI2__)
+#define NEO_DETAIL_MULX
+#endif
+#endif
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Limbs are 64-bit words stored least significant first.
+
+// Assigns the low word of `x + y + carry` to `out`, and returns the carry out.
+inline unsigned char add_carry(unsigned char carry, std::uint64_t x, std::uint64_t y, std::uint64_t& out) noexcept
+{
+#if defined(NEO_DETAIL_ADDCARRY)
+    unsigned long long result;
+    carry = _addcarry_u64(carry, x, y, &result);
+    out = result;
+    return carry;
+#else
+    std::uint64_t const sum = x + y;
+    std::uint64_t const result = sum + carry;
+    out = result;
+    return static_cast<unsigned char>((sum < x) | (result < sum));
+#endif
+}
+
+// Assigns the low word of `x - y - borrow` to `out`, and returns the borrow
+// out.
+inline unsigned char sub_borrow(unsigned char borrow, std::uint64_t x, std::uint64_t y, std::uint64_t& out) noexcept
+{
+#if defined(NEO_DETAIL_ADDCARRY)
+    unsigned long long result;
+    borrow = _subborrow_u64(borrow, x, y, &result);
+    out = result;
+    return borrow;
+#else
+    std::uint64_t const difference = x - y;
+    std::uint64_t const result = difference - borrow;
+    out = result;
+    return static_cast<unsigned char>((x < y) | (difference < borrow));
+#endif
+}
+
+inline void mul_wide(std::uint64_t x, std::uint64_t y, std::uint64_t& high, std::uint64_t& low) noexcept
+{
+#if defined(NEO_DETAIL_MULX)
+    unsigned long long h;
+    low = _mulx_u64(x, y, &h);
+    high = h;
+#elif defined(NEO_DETAIL_INT128)
+    uint128_t const product = static_cast<uint128_t>(x) * y;
+    high = static_cast<std::uint64_t>(product >> 64);
+    low = static_cast<std::uint64_t>(product);
+#elif defined(NEO_DETAIL_MULH)
+    unsigned long long h;
+    low = _umul128(x, y, &h);
+    high = h;
+#else
+    portable_mul_wide(x, y, high, low);
+#endif
+}
+
+// The `i`th limb of an integer, sign extended.
+template<typename U>
+constexpr std::uint64_t limb_of(U x, std::size_t i) noexcept
+{
+    return i * 8 < sizeof(U) ?
+        static_cast<std::uint64_t>(x >> (i * 64 % (sizeof(U) * 8))) :
+        static_cast<std::uint64_t>(is_signed<U>::value ? x >> (sizeof(U) * 8 - 1) : 0);
+}
+
+// The carry chains are unrolled by recursion, so that the limbs of small
+// integers can be kept in registers at any optimization level.
+template<std::size_t I, std::size_t N>
+struct carry_chain
+{
+    static unsigned char add(unsigned char carry, std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y) noexcept
+    {
+        carry = add_carry(carry, x[I], y[I], out[I]);
+        return carry_chain<I + 1, N>::add(carry, out, x, y);
+    }
+
+    static unsigned char sub(unsigned char borrow, std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y) noexcept
+    {
+        borrow = sub_borrow(borrow, x[I], y[I], out[I]);
+        return carry_chain<I + 1, N>::sub(borrow, out, x, y);
+    }
+};
+
+template<std::size_t N>
+struct carry_chain<N, N>
+{
+    static unsigned char add(unsigned char carry, std::uint64_t*, std::uint64_t const*, std::uint64_t const*) noexcept
+    {
+        return carry;
+    }
+
+    static unsigned char sub(unsigned char borrow, std::uint64_t*, std::uint64_t const*, std::uint64_t const*) noexcept
+    {
+        return borrow;
+    }
+};
+
+template<std::size_t N>
+unsigned char limbs_add(std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y) noexcept
+{
+    return carry_chain<0, N>::add(0, out, x, y);
+}
+
+template<std::size_t N>
+unsigned char limbs_sub(std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y) noexcept
+{
+    return carry_chain<0, N>::sub(0, out, x, y);
+}
+
+// One row of a product: adds `x * y[I]`, shifted by I limbs, to `out`, and
+// returns the carry out of limb `I + N`. x[J] * y[I] + out[I + J] + carry is
+// less than 2^128, so each step carries a single limb.
+template<std::size_t N, std::size_t M, std::size_t I, std::size_t J, bool = (J < N && I + J < M)>
+struct product_row
+{
+    static std::uint64_t run(std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y, std::uint64_t carry) noexcept
+    {
+        std::uint64_t high;
+        std::uint64_t low;
+        mul_wide(x[J], y[I], high, low);
+
+        high += add_carry(0, low, carry, low);
+        high += add_carry(0, out[I + J], low, out[I + J]);
+        return product_row<N, M, I, J + 1>::run(out, x, y, high);
+    }
+};
+
+template<std::size_t N, std::size_t M, std::size_t I, std::size_t J>
+struct product_row<N, M, I, J, false>
+{
+    static std::uint64_t run(std::uint64_t*, std::uint64_t const*, std::uint64_t const*, std::uint64_t carry) noexcept
+    {
+        return carry;
+    }
+};
+
+template<std::size_t N, std::size_t M, std::size_t I, bool = (I < N && I < M)>
+struct product_rows
+{
+    static void run(std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y) noexcept
+    {
+        std::uint64_t const carry = product_row<N, M, I, 0>::run(out, x, y, 0);
+
+        if (I + N < M)
+        {
+            out[(I + N) % M] = carry;
+        }
+
+        product_rows<N, M, I + 1>::run(out, x, y);
+    }
+};
+
+template<std::size_t N, std::size_t M, std::size_t I>
+struct product_rows<N, M, I, false>
+{
+    static void run(std::uint64_t*, std::uint64_t const*, std::uint64_t const*) noexcept
+    {
+    }
+};
+
+// Assigns the low M limbs of the product of two N-limb integers to `out`,
+// which must not overlap `x` or `y`. Products of limbs are accumulated a row
+// at a time, and products which only affect discarded limbs are skipped.
+template<std::size_t N, std::size_t M>
+void limbs_mul(std::uint64_t* out, std::uint64_t const* x, std::uint64_t const* y) noexcept
+{
+    for (std::size_t i = 0; i < M; ++i)
+    {
+        out[i] = 0;
+    }
+
+    product_rows<N, M, 0>::run(out, x, y);
+}
+
+template<std::size_t N>
+constexpr void limbs_shl(std::uint64_t* out, std::uint64_t const* x, std::size_t count) noexcept
+{
+    std::size_t const words = count / 64;
+    unsigned const bits = count % 64;
+
+    for (std::size_t i = N; i-- > 0;)
+    {
+        std::uint64_t const high = i >= words ? x[i - words] : 0u;
+        std::uint64_t const low = i >= words + 1 ? x[i - words - 1] : 0u;
+
+        out[i] = bits == 0 ? high : (high << bits) | (low >> (64 - bits));
+    }
+}
+
+template<std::size_t N>
+constexpr void limbs_shr(std::uint64_t* out, std::uint64_t const* x, std::size_t count) noexcept
+{
+    std::size_t const words = count / 64;
+    unsigned const bits = count % 64;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        std::uint64_t const low = i + words < N ? x[i + words] : 0u;
+        std::uint64_t const high = i + words + 1 < N ? x[i + words + 1] : 0u;
+
+        out[i] = bits == 0 ? low : (low >> bits) | (high << (64 - bits));
+    }
+}
+
+// Returns a negative number, zero or a positive number if `x` is less than,
+// equal to or greater than `y`.
+template<std::size_t N>
+constexpr int limbs_compare(std::uint64_t const* x, std::uint64_t const* y) noexcept
+{
+    for (std::size_t i = N; i-- > 0;)
+    {
+        if (x[i] != y[i])
+        {
+            return x[i] < y[i] ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+// Divides `x` in place by a divisor of up to 32 bits, and returns the
+// remainder. Each limb is divided in 32-bit halves, so no wider division is
+// needed.
+template<std::size_t N>
+std::uint32_t limbs_divmod_small(std::uint64_t* x, std::uint32_t divisor) noexcept
+{
+    std::uint64_t remainder = 0;
+
+    for (std::size_t i = N; i-- > 0;)
+    {
+        std::uint64_t const high = (remainder << 32) | (x[i] >> 32);
+        std::uint64_t const low = ((high % divisor) << 32) | (x[i] & 0xffffffffu);
+
+        x[i] = ((high / divisor) << 32) | (low / divisor);
+        remainder = low % divisor;
+    }
+
+    return static_cast<std::uint32_t>(remainder);
+}
+
+} // namespace detail
+
+} // namespace neo
+
+#endif // NEO_DETAIL_WIDE_UINT_HPP
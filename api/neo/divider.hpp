@@ -0,0 +1,149 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DIVIDER_HPP
+#define NEO_DIVIDER_HPP
+
+#include <neo/algorithm.hpp>
+#include <neo/span.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/divider.hpp>
+#include <neo/detail/kernels.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Quotients and remainders of spans of unsigned 32- and 64-bit integers use
+// the vector kernel, and the others are divided one at a time.
+template<bool Remainder, typename T, typename Division>
+void divide_lanes(T const* a, Division d, T* out, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Remainder ? d.remainder(a[i]) : d.divide(a[i]);
+    }
+}
+
+template<bool Remainder>
+void divide_lanes(std::uint32_t const* a, unsigned_division<std::uint32_t> d, std::uint32_t* out, std::size_t count) noexcept
+{
+    dispatch<divide_kernel<std::uint32_t, Remainder>>::call(a, d, out, count);
+}
+
+template<bool Remainder>
+void divide_lanes(std::uint64_t const* a, unsigned_division<std::uint64_t> d, std::uint64_t* out, std::size_t count) noexcept
+{
+    dispatch<divide_kernel<std::uint64_t, Remainder>>::call(a, d, out, count);
+}
+
+} // namespace detail
+
+// Dividers
+//----------
+//
+// Division by a divisor which is only known at runtime, but is used for many
+// divisions. The divisor is turned into a magic number and shift on
+// construction, so each division is a multiplication, an addition and a
+// shift or two, rather than a division instruction. Quotients and remainders
+// are the same as those of the built-in operators.
+template<typename T>
+class divider;
+
+template<typename T>
+class divider<value<T>>
+{
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 8,
+            "divider must divide an integer of at most 64 bits");
+
+private:
+    detail::division_t<T> m_division;
+
+    static T checked(T d)
+    {
+        if (d == 0)
+        {
+            throw std::invalid_argument("neo::divider: divisor must not be zero");
+        }
+
+        return d;
+    }
+
+public:
+    // Throws std::invalid_argument if `d` is zero.
+    explicit divider(value<T> const& d) :
+        m_division(detail::make_division(checked(d.get())))
+    {
+    }
+
+    value<T> get() const noexcept
+    {
+        return m_division.divisor;
+    }
+
+    detail::division_t<T> const& constants() const noexcept
+    {
+        return m_division;
+    }
+
+    value<T> quotient(value<T> const& x) const noexcept
+    {
+        return m_division.divide(x.get());
+    }
+
+    value<T> remainder(value<T> const& x) const noexcept
+    {
+        return m_division.remainder(x.get());
+    }
+};
+
+template<typename T>
+value<T> operator/(value<T> const& lhs, divider<value<T>> const& rhs) noexcept
+{
+    return rhs.quotient(lhs);
+}
+
+template<typename T>
+value<T> operator%(value<T> const& lhs, divider<value<T>> const& rhs) noexcept
+{
+    return rhs.remainder(lhs);
+}
+
+// Divider Span Kernels
+//----------------------
+//
+// `a` and `out` must have the same size, and may be the same range.
+
+// Assigns `a[i] / d` to each `out[i]`. Unsigned 32- and 64-bit elements are
+// divided in vectors.
+template<typename A, typename T, typename = detail::enable_if_t<
+    std::is_same<detail::remove_cv_t<A>, value<T>>::value>
+>
+void transform_div(span<A> a, span<value<T>> out, divider<value<T>> const& d) noexcept
+{
+    detail::divide_lanes<false>(detail::lanes(a.data()), d.constants(), detail::lanes(out.data()), out.size());
+}
+
+// Assigns `a[i] % d` to each `out[i]`.
+template<typename A, typename T, typename = detail::enable_if_t<
+    std::is_same<detail::remove_cv_t<A>, value<T>>::value>
+>
+void transform_mod(span<A> a, span<value<T>> out, divider<value<T>> const& d) noexcept
+{
+    detail::divide_lanes<true>(detail::lanes(a.data()), d.constants(), detail::lanes(out.data()), out.size());
+}
+
+} // namespace neo
+
+#endif // NEO_DIVIDER_HPP
@@ -0,0 +1,252 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_DYNARRAY_HPP
+#define NEO_DYNARRAY_HPP
+
+#include <neo/memory.hpp>
+#include <neo/traits.hpp>
+#include <neo/undefined.hpp>
+
+#include <neo/detail/pages.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace neo
+{
+
+// An array whose size is fixed on construction. Large arrays of types which
+// are zero-initialized by default are mapped directly from zero-filled pages,
+// so no constructor loop runs, and memory is only committed when touched.
+template<typename T>
+class dynarray
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+            "over-aligned types are not supported");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+    using pointer = value_type*;
+    using const_pointer = value_type const*;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+
+private:
+    pointer m_data;
+    size_type m_size;
+
+    static pointer allocate(size_type count, bool zeroed)
+    {
+        if (count > std::numeric_limits<size_type>::max() / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+
+        return static_cast<pointer>(detail::allocate(count * sizeof(T), zeroed));
+    }
+
+    // Constructs each element in [m_data, m_data + m_size) with `construct`,
+    // destroying the constructed elements and releasing the storage if one
+    // throws.
+    template<typename Construct>
+    void construct_each(Construct construct)
+    {
+        size_type i = 0;
+
+        try
+        {
+            for (; i < m_size; ++i)
+            {
+                construct(m_data + i, i);
+            }
+        }
+        catch (...)
+        {
+            destroy(m_data, m_data + i);
+            detail::deallocate(m_data, m_size * sizeof(T));
+            throw;
+        }
+    }
+
+    static void destroy(pointer first, pointer last) noexcept
+    {
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            for (; first != last; ++first)
+            {
+                first->~T();
+            }
+        }
+    }
+
+    void construct_default(std::true_type)
+    {
+        m_data = allocate(m_size, true);
+    }
+
+    void construct_default(std::false_type)
+    {
+        m_data = allocate(m_size, false);
+        construct_each([](pointer p, size_type) { ::new (static_cast<void*>(p)) T(); });
+    }
+
+public:
+    dynarray() noexcept :
+        m_data(),
+        m_size()
+    {
+    }
+
+    explicit dynarray(size_type count) :
+        m_data(),
+        m_size(count)
+    {
+        construct_default(is_zero_initialized_by_default<T>());
+    }
+
+    dynarray(size_type count, undefined_t) :
+        m_data(allocate(count, false)),
+        m_size(count)
+    {
+        construct_each([](pointer p, size_type) { detail::construct_undefined(p); });
+    }
+
+    dynarray(size_type count, value_type const& value) :
+        m_data(allocate(count, false)),
+        m_size(count)
+    {
+        construct_each([&](pointer p, size_type) { ::new (static_cast<void*>(p)) T(value); });
+    }
+
+    dynarray(std::initializer_list<value_type> values) :
+        m_data(allocate(values.size(), false)),
+        m_size(values.size())
+    {
+        construct_each([&](pointer p, size_type i) { ::new (static_cast<void*>(p)) T(values.begin()[i]); });
+    }
+
+    dynarray(dynarray const& other) :
+        m_data(allocate(other.m_size, false)),
+        m_size(other.m_size)
+    {
+        construct_each([&](pointer p, size_type i) { ::new (static_cast<void*>(p)) T(other.m_data[i]); });
+    }
+
+    dynarray(dynarray&& other) noexcept :
+        m_data(other.m_data),
+        m_size(other.m_size)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+
+    dynarray& operator=(dynarray other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~dynarray()
+    {
+        destroy(m_data, m_data + m_size);
+        detail::deallocate(m_data, m_size * sizeof(T));
+    }
+
+    void swap(dynarray& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+    }
+
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    pointer data() noexcept
+    {
+        return m_data;
+    }
+
+    const_pointer data() const noexcept
+    {
+        return m_data;
+    }
+
+    reference operator[](size_type i) noexcept
+    {
+        return m_data[i];
+    }
+
+    const_reference operator[](size_type i) const noexcept
+    {
+        return m_data[i];
+    }
+
+    reference front() noexcept
+    {
+        return m_data[0];
+    }
+
+    const_reference front() const noexcept
+    {
+        return m_data[0];
+    }
+
+    reference back() noexcept
+    {
+        return m_data[m_size - 1];
+    }
+
+    const_reference back() const noexcept
+    {
+        return m_data[m_size - 1];
+    }
+
+    iterator begin() noexcept
+    {
+        return m_data;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    iterator end() noexcept
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+};
+
+template<typename T>
+void swap(dynarray<T>& lhs, dynarray<T>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace neo
+
+#endif // NEO_DYNARRAY_HPP
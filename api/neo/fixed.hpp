@@ -0,0 +1,571 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_FIXED_HPP
+#define NEO_FIXED_HPP
+
+#include <neo/span.hpp>
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/fixed.hpp>
+#include <neo/detail/kernels.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace neo
+{
+
+template<typename T, int FracBits>
+class fixed;
+
+namespace detail
+{
+
+template<typename T>
+struct is_fixed : std::false_type
+{
+};
+
+template<typename T, int FracBits>
+struct is_fixed<fixed<T, FracBits>> : std::true_type
+{
+};
+
+template<typename T, int FracBits>
+struct integer_bits : std::integral_constant<int,
+        std::numeric_limits<T>::digits - FracBits
+    >
+{
+};
+
+// A conversion between fixed-point formats is safe if neither integer nor
+// fractional bits are lost.
+template<typename T1, int F1, typename T2, int F2>
+struct is_fixed_safely_convertible : std::integral_constant<bool,
+        are_similar<T1, T2>::value &&
+        F2 >= F1 &&
+        integer_bits<T2, F2>::value >= integer_bits<T1, F1>::value
+    >
+{
+};
+
+// An integer converts safely if it fits in the integer bits.
+template<typename U, typename T, int FracBits, bool =
+    std::is_integral<U>::value && !is_same<U, bool>::value
+>
+struct is_integer_safely_fixed : std::integral_constant<bool,
+        are_similar<U, T>::value &&
+        std::numeric_limits<U>::digits <= integer_bits<T, FracBits>::value
+    >
+{
+};
+
+template<typename U, typename T, int FracBits>
+struct is_integer_safely_fixed<U, T, FracBits, false> : std::false_type
+{
+};
+
+template<typename T1, int F1, typename T2, int F2>
+struct are_fixed_combinable : std::integral_constant<bool,
+        is_fixed_safely_convertible<T1, F1, T2, F2>::value ||
+        is_fixed_safely_convertible<T2, F2, T1, F1>::value
+    >
+{
+};
+
+template<typename T1, int F1, typename T2, int F2, bool =
+    is_fixed_safely_convertible<T1, F1, T2, F2>::value
+>
+struct fixed_wider
+{
+    using type = fixed<T1, F1>;
+};
+
+template<typename T1, int F1, typename T2, int F2>
+struct fixed_wider<T1, F1, T2, F2, true>
+{
+    using type = fixed<T2, F2>;
+};
+
+template<typename T1, int F1, typename T2, int F2>
+using fixed_wider_t = typename fixed_wider<T1, F1, T2, F2>::type;
+
+// The representation of `raw`, which has `From` fractional bits, with `To`
+// fractional bits. Fractional bits are discarded by an arithmetic shift,
+// rounding towards negative infinity.
+template<typename R, int To, int From, typename U>
+constexpr R rescale(U raw) noexcept
+{
+    return To >= From ?
+        static_cast<R>(static_cast<R>(raw) * pow2<R>((To - From) % 64)) :
+        static_cast<R>(raw >> ((From - To) % 64));
+}
+
+// Rounds to the nearest integer, and half-way cases away from zero.
+template<typename T, typename U>
+constexpr T round_to(U x) noexcept
+{
+    return static_cast<T>(x < U(0) ? x - U(0.5) : x + U(0.5));
+}
+
+template<typename A, typename B>
+struct are_fixed_spans : std::integral_constant<bool,
+        is_fixed<remove_cv_t<A>>::value &&
+        is_same<A, B>::value
+    >
+{
+};
+
+template<typename T, int FracBits>
+T const* lanes(fixed<T, FracBits> const* p) noexcept
+{
+    return reinterpret_cast<T const*>(p);
+}
+
+template<typename T, int FracBits>
+T* lanes(fixed<T, FracBits>* p) noexcept
+{
+    return reinterpret_cast<T*>(p);
+}
+
+template<typename T, int FracBits>
+void fixed_div_lanes(T const* a, T d, T* out, std::size_t count, std::true_type) noexcept
+{
+    fixed_reciprocal<T> const r = make_fixed_reciprocal<FracBits>(d);
+
+    dispatch<reciprocal_kernel<T>>::call(a, r.multiplier, r.shift, out, count);
+}
+
+template<typename T, int FracBits>
+void fixed_div_lanes(T const* a, T d, T* out, std::size_t count, std::false_type) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = fixed_div<FracBits>(a[i], d);
+    }
+}
+
+} // namespace detail
+
+// Fixed-Point Values
+//--------------------
+//
+// A binary fixed-point number stored as an integer of type `T`, of which the
+// low `FracBits` bits are the fractional part, so arithmetic is exact and
+// deterministic across platforms. As with value<T>, conversions which could
+// lose integer or fractional bits must be explicit, and values with different
+// signedness cannot be mixed. Products and quotients are computed in an
+// integer twice as wide as `T`, so that intermediate results do not overflow.
+// Products and conversions to fewer fractional bits round towards negative
+// infinity, and quotients round towards zero.
+template<typename T, int FracBits>
+class fixed
+{
+    static_assert(std::is_integral<T>::value && !detail::is_same<T, bool>::value,
+            "fixed must be stored in an integral type");
+    static_assert(FracBits >= 0 && FracBits < std::numeric_limits<T>::digits,
+            "fixed must have fewer fractional bits than its storage type");
+
+public:
+    using value_type = T;
+
+    static constexpr int frac_bits = FracBits;
+    static constexpr int int_bits = detail::integer_bits<T, FracBits>::value;
+
+private:
+    value<T> m_value;
+
+    struct raw_tag
+    {
+    };
+
+    constexpr fixed(raw_tag, T raw) noexcept :
+        m_value(raw)
+    {
+    }
+
+public:
+    constexpr fixed() noexcept :
+        m_value()
+    {
+    }
+
+    fixed(undefined_t) noexcept :
+        m_value(undefined)
+    {
+    }
+
+    template<typename U, int F, typename = detail::enable_if_t<
+        detail::is_fixed_safely_convertible<U, F, T, FracBits>::value>
+    >
+    constexpr fixed(fixed<U, F> const& other) noexcept :
+        m_value(detail::rescale<T, FracBits, F>(other.raw().get()))
+    {
+    }
+
+    template<typename U, int F, typename = detail::enable_if_t<
+        !detail::is_fixed_safely_convertible<U, F, T, FracBits>::value>,
+        typename = void
+    >
+    constexpr explicit fixed(fixed<U, F> const& other) noexcept :
+        m_value(detail::rescale<T, FracBits, F>(other.raw().get()))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integer_safely_fixed<U, T, FracBits>::value>
+    >
+    constexpr fixed(U const& x) noexcept :
+        m_value(detail::rescale<T, FracBits, 0>(x))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value &&
+        !detail::is_integer_safely_fixed<U, T, FracBits>::value>,
+        typename = void
+    >
+    constexpr explicit fixed(U const& x) noexcept :
+        m_value(detail::rescale<T, FracBits, 0>(x))
+    {
+    }
+
+    // Floating-point values are rounded to the nearest representable value.
+    template<typename U, typename = detail::enable_if_t<
+        std::is_floating_point<U>::value>,
+        typename = void, typename = void
+    >
+    constexpr explicit fixed(U const& x) noexcept :
+        m_value(detail::round_to<T>(x * detail::pow2<U>(FracBits)))
+    {
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_integer_safely_fixed<U, T, FracBits>::value>
+    >
+    constexpr fixed(value<U, Policy> const& x) noexcept :
+        fixed(x.get())
+    {
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value &&
+        !detail::is_integer_safely_fixed<U, T, FracBits>::value>,
+        typename = void
+    >
+    constexpr explicit fixed(value<U, Policy> const& x) noexcept :
+        fixed(x.get())
+    {
+    }
+
+    // Conversions to integers round towards zero.
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value && !detail::is_same<U, bool>::value>
+    >
+    constexpr explicit operator U() const noexcept
+    {
+        return static_cast<U>(m_value.get() / detail::pow2<T>(FracBits));
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_floating_point<U>::value>,
+        typename = void
+    >
+    constexpr explicit operator U() const noexcept
+    {
+        return static_cast<U>(m_value.get()) / detail::pow2<U>(FracBits);
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    constexpr explicit operator value<U, Policy>() const noexcept
+    {
+        return static_cast<U>(*this);
+    }
+
+    // The representation, which is the value multiplied by 2^FracBits.
+    constexpr value<T> raw() const noexcept
+    {
+        return m_value;
+    }
+
+    static constexpr fixed from_raw(value<T> const& raw) noexcept
+    {
+        return fixed(raw_tag(), raw.get());
+    }
+
+    constexpr fixed operator+() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr fixed operator-() const noexcept
+    {
+        return from_raw(-m_value);
+    }
+
+    template<typename U, int F, typename = detail::enable_if_t<
+        detail::is_fixed_safely_convertible<U, F, T, FracBits>::value>
+    >
+    fixed& operator+=(fixed<U, F> const& rhs) noexcept
+    {
+        m_value += fixed(rhs).m_value;
+        return *this;
+    }
+
+    template<typename U, int F, typename = detail::enable_if_t<
+        detail::is_fixed_safely_convertible<U, F, T, FracBits>::value>
+    >
+    fixed& operator-=(fixed<U, F> const& rhs) noexcept
+    {
+        m_value -= fixed(rhs).m_value;
+        return *this;
+    }
+
+    template<typename U, int F, typename = detail::enable_if_t<
+        detail::is_fixed_safely_convertible<U, F, T, FracBits>::value>
+    >
+    fixed& operator*=(fixed<U, F> const& rhs) noexcept
+    {
+        m_value = detail::fixed_mul<FracBits>(m_value.get(), fixed(rhs).m_value.get());
+        return *this;
+    }
+
+    template<typename U, int F, typename = detail::enable_if_t<
+        detail::is_fixed_safely_convertible<U, F, T, FracBits>::value>
+    >
+    fixed& operator/=(fixed<U, F> const& rhs) noexcept
+    {
+        m_value = detail::fixed_div<FracBits>(m_value.get(), fixed(rhs).m_value.get());
+        return *this;
+    }
+
+    // Multiplication and division by integers scale the representation.
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value &&
+        detail::is_safely_convertible<U, T>::value>
+    >
+    fixed& operator*=(U const& rhs) noexcept
+    {
+        m_value *= rhs;
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value &&
+        detail::is_safely_convertible<U, T>::value>
+    >
+    fixed& operator/=(U const& rhs) noexcept
+    {
+        m_value /= rhs;
+        return *this;
+    }
+};
+
+template<typename T, int FracBits>
+constexpr int fixed<T, FracBits>::frac_bits;
+
+template<typename T, int FracBits>
+constexpr int fixed<T, FracBits>::int_bits;
+
+// fixed - fixed
+//---------------
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr value<bool> operator==(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result(lhs).raw() == result(rhs).raw();
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr value<bool> operator!=(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result(lhs).raw() != result(rhs).raw();
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr value<bool> operator<(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result(lhs).raw() < result(rhs).raw();
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr value<bool> operator<=(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result(lhs).raw() <= result(rhs).raw();
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr value<bool> operator>(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result(lhs).raw() > result(rhs).raw();
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr value<bool> operator>=(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result(lhs).raw() >= result(rhs).raw();
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr detail::fixed_wider_t<T1, F1, T2, F2> operator+(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result::from_raw(result(lhs).raw() + result(rhs).raw());
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr detail::fixed_wider_t<T1, F1, T2, F2> operator-(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result::from_raw(result(lhs).raw() - result(rhs).raw());
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr detail::fixed_wider_t<T1, F1, T2, F2> operator*(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result::from_raw(detail::fixed_mul<result::frac_bits>(result(lhs).raw().get(), result(rhs).raw().get()));
+}
+
+template<typename T1, int F1, typename T2, int F2, typename = detail::enable_if_t<
+    detail::are_fixed_combinable<T1, F1, T2, F2>::value>
+>
+constexpr detail::fixed_wider_t<T1, F1, T2, F2> operator/(fixed<T1, F1> const& lhs, fixed<T2, F2> const& rhs) noexcept
+{
+    using result = detail::fixed_wider_t<T1, F1, T2, F2>;
+    return result::from_raw(detail::fixed_div<result::frac_bits>(result(lhs).raw().get(), result(rhs).raw().get()));
+}
+
+// fixed - integer
+//-----------------
+
+template<typename T, int F, typename U, typename = detail::enable_if_t<
+    std::is_integral<U>::value &&
+    detail::is_safely_convertible<U, T>::value>
+>
+constexpr fixed<T, F> operator*(fixed<T, F> const& lhs, U const& rhs) noexcept
+{
+    return fixed<T, F>::from_raw(lhs.raw() * rhs);
+}
+
+template<typename T, int F, typename U, typename = detail::enable_if_t<
+    std::is_integral<U>::value &&
+    detail::is_safely_convertible<U, T>::value>
+>
+constexpr fixed<T, F> operator*(U const& lhs, fixed<T, F> const& rhs) noexcept
+{
+    return fixed<T, F>::from_raw(lhs * rhs.raw());
+}
+
+template<typename T, int F, typename U, typename = detail::enable_if_t<
+    std::is_integral<U>::value &&
+    detail::is_safely_convertible<U, T>::value>
+>
+constexpr fixed<T, F> operator/(fixed<T, F> const& lhs, U const& rhs) noexcept
+{
+    return fixed<T, F>::from_raw(lhs.raw() / rhs);
+}
+
+// IOStream
+//----------
+
+template<typename T, int F>
+std::ostream& operator<<(std::ostream& s, fixed<T, F> const& x)
+{
+    s << static_cast<long double>(x);
+    return s;
+}
+
+// Fixed-Point Span Kernels
+//--------------------------
+//
+// As in algorithm.hpp, `a`, `b` and `out` must have the same size, and `out`
+// may be the same range as `a` or `b`. All spans have the same format.
+
+// Assigns `a[i] + b[i]` to each `out[i]`.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_fixed_spans<A, B>::value>
+>
+void transform_add(span<A> a, span<B> b, span<detail::remove_cv_t<A>> out) noexcept
+{
+    using kernel = detail::transform_kernel<typename detail::remove_cv_t<A>::value_type, detail::add_op>;
+
+    detail::dispatch<kernel>::call(detail::lanes(a.data()), detail::lanes(b.data()), detail::lanes(out.data()), out.size());
+}
+
+// Assigns `a[i] - b[i]` to each `out[i]`.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_fixed_spans<A, B>::value>
+>
+void transform_sub(span<A> a, span<B> b, span<detail::remove_cv_t<A>> out) noexcept
+{
+    using kernel = detail::transform_kernel<typename detail::remove_cv_t<A>::value_type, detail::sub_op>;
+
+    detail::dispatch<kernel>::call(detail::lanes(a.data()), detail::lanes(b.data()), detail::lanes(out.data()), out.size());
+}
+
+// Assigns `a[i] * b[i]` to each `out[i]`. Products are computed in lanes twice
+// as wide as the representation.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_fixed_spans<A, B>::value>
+>
+void transform_mul(span<A> a, span<B> b, span<detail::remove_cv_t<A>> out) noexcept
+{
+    using result = detail::remove_cv_t<A>;
+    using kernel = detail::transform_kernel<typename result::value_type, detail::fixed_mul_op<result::frac_bits>>;
+
+    detail::dispatch<kernel>::call(detail::lanes(a.data()), detail::lanes(b.data()), detail::lanes(out.data()), out.size());
+}
+
+// Assigns `a[i] / d` to each `out[i]`. For representations of up to 32 bits,
+// each element is multiplied by the reciprocal of `d`, which is computed once,
+// so results may differ from `a[i] / d` in the last place. `d` must not be
+// zero.
+template<typename A, typename = detail::enable_if_t<
+    detail::is_fixed<detail::remove_cv_t<A>>::value>
+>
+void transform_div(span<A> a, detail::remove_cv_t<A> d, span<detail::remove_cv_t<A>> out) noexcept
+{
+    using result = detail::remove_cv_t<A>;
+    using lane = typename result::value_type;
+
+    detail::fixed_div_lanes<lane, result::frac_bits>(detail::lanes(a.data()), d.raw().get(), detail::lanes(out.data()), out.size(),
+            std::integral_constant<bool, sizeof(lane) <= 4>());
+}
+
+} // namespace neo
+
+#endif // NEO_FIXED_HPP
@@ -0,0 +1,534 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_FLOAT16_HPP
+#define NEO_FLOAT16_HPP
+
+#include <neo/algorithm.hpp>
+#include <neo/span.hpp>
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/float16.hpp>
+#include <neo/detail/kernels.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+namespace neo
+{
+
+template<typename Format>
+class basic_float16;
+
+namespace detail
+{
+
+template<typename T>
+struct is_float16 : std::false_type
+{
+};
+
+template<typename Format>
+struct is_float16<basic_float16<Format>> : std::true_type
+{
+};
+
+// The value type to which a half-precision operand is promoted when mixed with
+// an operand of type `U`: float_, with the policy of `U` if it is a value.
+template<typename U>
+struct float16_promotion
+{
+    using policy_type = policy::unchecked;
+    using type = value<float>;
+};
+
+template<typename U, typename Policy>
+struct float16_promotion<value<U, Policy>>
+{
+    using policy_type = Policy;
+    using type = value<float, Policy>;
+};
+
+template<typename U>
+using float16_promotion_t = typename float16_promotion<U>::type;
+
+// Every half-precision value is exactly representable as a float, so
+// conversions to floating-point types are safe, and conversions from them are
+// not.
+template<typename Format>
+struct is_safely_convertible<basic_float16<Format>, float, false> : std::true_type
+{
+};
+
+template<typename Format>
+struct is_safely_convertible<basic_float16<Format>, double, false> : std::true_type
+{
+};
+
+template<typename Format>
+struct is_safely_convertible<basic_float16<Format>, long double, false> : std::true_type
+{
+};
+
+template<typename Format>
+std::uint16_t const* lanes(basic_float16<Format> const* p) noexcept
+{
+    return reinterpret_cast<std::uint16_t const*>(p);
+}
+
+template<typename Format>
+std::uint16_t* lanes(basic_float16<Format>* p) noexcept
+{
+    return reinterpret_cast<std::uint16_t*>(p);
+}
+
+// The span conversion kernels of each format. IEEE half precision uses F16C or
+// AVX-512 where available, and bfloat16 uses integer vector instructions.
+template<typename Format>
+struct float16_kernels;
+
+template<>
+struct float16_kernels<ieee_half_format>
+{
+    static void widen(std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        f16c_dispatch<float16_widen_kernel>::call(a, out, count);
+    }
+
+    static void narrow(float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        f16c_dispatch<float16_narrow_kernel>::call(a, out, count);
+    }
+};
+
+template<>
+struct float16_kernels<bfloat16_format>
+{
+    static void widen(std::uint16_t const* a, float* out, std::size_t count) noexcept
+    {
+        dispatch<bfloat16_widen_kernel>::call(a, out, count);
+    }
+
+    static void narrow(float const* a, std::uint16_t* out, std::size_t count) noexcept
+    {
+        dispatch<bfloat16_narrow_kernel>::call(a, out, count);
+    }
+};
+
+} // namespace detail
+
+// Half-Precision Values
+//-----------------------
+//
+// A 16-bit binary floating-point number, for storing large arrays of values
+// in half the memory of float. `float16` is IEEE 754 binary16, and `bfloat16`
+// has the exponent range of float with 8 bits of precision. These are storage
+// formats: every value converts implicitly to float and float_, and arithmetic
+// and comparisons are done in float_, following its conversion rules, so
+// `h * 2.0f` is a float_ and `h * 2.0` a double_. As with float_, functions
+// overloaded for each floating-point type, such as std::sqrt, need an explicit
+// conversion. Conversions from wider types must be explicit, and round to
+// nearest, ties to even. Conversions are done in software, except for the span
+// conversions below.
+template<typename Format>
+class basic_float16
+{
+public:
+    using format_type = Format;
+
+private:
+    std::uint16_t m_bits;
+
+    struct bits_tag
+    {
+    };
+
+    constexpr basic_float16(bits_tag, std::uint16_t bits) noexcept :
+        m_bits(bits)
+    {
+    }
+
+public:
+    constexpr basic_float16() noexcept :
+        m_bits()
+    {
+    }
+
+    basic_float16(undefined_t) noexcept
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    explicit basic_float16(U const& x) noexcept :
+        m_bits(detail::binary16_from<Format>(x))
+    {
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_numeric<U>::value>
+    >
+    explicit basic_float16(value<U, Policy> const& x) noexcept :
+        basic_float16(x.get())
+    {
+    }
+
+    template<typename F, typename = detail::enable_if_t<
+        !std::is_same<F, Format>::value>
+    >
+    explicit basic_float16(basic_float16<F> const& other) noexcept :
+        basic_float16(static_cast<float>(other))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<basic_float16, U>::value>
+    >
+    operator U() const noexcept
+    {
+        return static_cast<U>(detail::float_from_binary16(Format(), m_bits));
+    }
+
+    // Conversions to integers round towards zero.
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value && !detail::is_same<U, bool>::value>,
+        typename = void
+    >
+    explicit operator U() const noexcept
+    {
+        return static_cast<U>(detail::float_from_binary16(Format(), m_bits));
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        std::is_integral<U>::value && !detail::is_same<U, bool>::value>
+    >
+    explicit operator value<U, Policy>() const noexcept
+    {
+        return static_cast<U>(*this);
+    }
+
+    // The representation: the sign, exponent and mantissa bits.
+    constexpr value<std::uint16_t> bits() const noexcept
+    {
+        return m_bits;
+    }
+
+    static constexpr basic_float16 from_bits(value<std::uint16_t> const& bits) noexcept
+    {
+        return basic_float16(bits_tag(), bits.get());
+    }
+
+    constexpr basic_float16 operator+() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr basic_float16 operator-() const noexcept
+    {
+        return basic_float16(bits_tag(), static_cast<std::uint16_t>(m_bits ^ 0x8000u));
+    }
+};
+
+using float16 = basic_float16<detail::ieee_half_format>;
+using bfloat16 = basic_float16<detail::bfloat16_format>;
+
+// basic_float16 - basic_float16
+//-------------------------------
+//
+// Values are compared and combined as floats, so NaN compares unequal to
+// everything.
+
+template<typename Format>
+value<bool> operator==(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) == static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<bool> operator!=(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) != static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<bool> operator<(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) < static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<bool> operator<=(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) <= static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<bool> operator>(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) > static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<bool> operator>=(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) >= static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<float> operator+(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) + static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<float> operator-(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) - static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<float> operator*(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) * static_cast<float>(rhs);
+}
+
+template<typename Format>
+value<float> operator/(basic_float16<Format> const& lhs, basic_float16<Format> const& rhs) noexcept
+{
+    return static_cast<float>(lhs) / static_cast<float>(rhs);
+}
+
+// basic_float16 - U
+//-------------------
+//
+// The half-precision operand is promoted to float_, so `U` may be any type
+// that can be mixed with float_.
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator==(basic_float16<Format> const& lhs, U const& rhs) noexcept ->
+    decltype(detail::float16_promotion_t<U>(lhs) == rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) == rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator!=(basic_float16<Format> const& lhs, U const& rhs) noexcept ->
+    decltype(detail::float16_promotion_t<U>(lhs) != rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) != rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator<(basic_float16<Format> const& lhs, U const& rhs) noexcept ->
+    decltype(detail::float16_promotion_t<U>(lhs) < rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) < rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator<=(basic_float16<Format> const& lhs, U const& rhs) noexcept ->
+    decltype(detail::float16_promotion_t<U>(lhs) <= rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) <= rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator>(basic_float16<Format> const& lhs, U const& rhs) noexcept ->
+    decltype(detail::float16_promotion_t<U>(lhs) > rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) > rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator>=(basic_float16<Format> const& lhs, U const& rhs) noexcept ->
+    decltype(detail::float16_promotion_t<U>(lhs) >= rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) >= rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator+(basic_float16<Format> const& lhs, U const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(detail::float16_promotion_t<U>(lhs) + rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) + rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator-(basic_float16<Format> const& lhs, U const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(detail::float16_promotion_t<U>(lhs) - rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) - rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator*(basic_float16<Format> const& lhs, U const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(detail::float16_promotion_t<U>(lhs) * rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) * rhs;
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator/(basic_float16<Format> const& lhs, U const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(detail::float16_promotion_t<U>(lhs) / rhs)
+{
+    return detail::float16_promotion_t<U>(lhs) / rhs;
+}
+
+// U - basic_float16
+//-------------------
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator==(U const& lhs, basic_float16<Format> const& rhs) noexcept ->
+    decltype(lhs == detail::float16_promotion_t<U>(rhs))
+{
+    return lhs == detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator!=(U const& lhs, basic_float16<Format> const& rhs) noexcept ->
+    decltype(lhs != detail::float16_promotion_t<U>(rhs))
+{
+    return lhs != detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator<(U const& lhs, basic_float16<Format> const& rhs) noexcept ->
+    decltype(lhs < detail::float16_promotion_t<U>(rhs))
+{
+    return lhs < detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator<=(U const& lhs, basic_float16<Format> const& rhs) noexcept ->
+    decltype(lhs <= detail::float16_promotion_t<U>(rhs))
+{
+    return lhs <= detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator>(U const& lhs, basic_float16<Format> const& rhs) noexcept ->
+    decltype(lhs > detail::float16_promotion_t<U>(rhs))
+{
+    return lhs > detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator>=(U const& lhs, basic_float16<Format> const& rhs) noexcept ->
+    decltype(lhs >= detail::float16_promotion_t<U>(rhs))
+{
+    return lhs >= detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator+(U const& lhs, basic_float16<Format> const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(lhs + detail::float16_promotion_t<U>(rhs))
+{
+    return lhs + detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator-(U const& lhs, basic_float16<Format> const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(lhs - detail::float16_promotion_t<U>(rhs))
+{
+    return lhs - detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator*(U const& lhs, basic_float16<Format> const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(lhs * detail::float16_promotion_t<U>(rhs))
+{
+    return lhs * detail::float16_promotion_t<U>(rhs);
+}
+
+template<typename Format, typename U, typename = detail::enable_if_t<
+    !detail::is_float16<U>::value>
+>
+auto operator/(U const& lhs, basic_float16<Format> const& rhs) noexcept(detail::float16_promotion<U>::policy_type::is_nothrow) ->
+    decltype(lhs / detail::float16_promotion_t<U>(rhs))
+{
+    return lhs / detail::float16_promotion_t<U>(rhs);
+}
+
+// IOStream
+//----------
+
+template<typename Format>
+std::ostream& operator<<(std::ostream& s, basic_float16<Format> const& x)
+{
+    s << static_cast<float>(x);
+    return s;
+}
+
+// Half-Precision Span Conversions
+//---------------------------------
+//
+// `a` and `out` must have the same size, and must not overlap.
+
+// Assigns `a[i]` to each `out[i]`, which is exact.
+template<typename A, typename Policy, typename = detail::enable_if_t<
+    detail::is_float16<detail::remove_cv_t<A>>::value>
+>
+void convert(span<A> a, span<value<float, Policy>> out) noexcept
+{
+    using format = typename detail::remove_cv_t<A>::format_type;
+
+    detail::float16_kernels<format>::widen(detail::lanes(a.data()), detail::lanes(out.data()), out.size());
+}
+
+// Assigns `a[i]`, rounded to nearest, ties to even, to each `out[i]`.
+template<typename A, typename Format, typename = detail::enable_if_t<
+    std::is_same<detail::span_lane_t<A>, float>::value>
+>
+void convert(span<A> a, span<basic_float16<Format>> out) noexcept
+{
+    detail::float16_kernels<Format>::narrow(detail::lanes(a.data()), detail::lanes(out.data()), out.size());
+}
+
+} // namespace neo
+
+#endif // NEO_FLOAT16_HPP
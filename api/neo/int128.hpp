@@ -0,0 +1,120 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_INT128_HPP
+#define NEO_INT128_HPP
+
+#include <neo/stdint.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <ostream>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<typename T>
+struct has_mul_high : std::integral_constant<bool,
+        is_integral<T>::value && !is_same<T, bool>::value &&
+        (has_wide_product<T>::value || sizeof(T) == 8)
+    >
+{
+};
+
+} // namespace detail
+
+// Wide Products
+//---------------
+//
+// Hashing and fixed-point arithmetic often need the bits of a product that do
+// not fit in its operands. For 64-bit operands, these compile to a single
+// multiply instruction on x86-64 with GCC, Clang and MSVC.
+
+// Returns the high half of the full product of `x` and `y`, which is
+// `x * y >> bits` computed without overflow, where `bits` is the width of T.
+template<typename T, typename Policy, typename = detail::enable_if_t<
+    detail::has_mul_high<T>::value>
+>
+value<T, Policy> mul_high(value<T, Policy> const& x, value<T, Policy> const& y) noexcept
+{
+    return detail::mul_high(x.get(), y.get());
+}
+
+// Returns the full product of `x` and `y`, in an integer twice as wide as T.
+// For 64-bit operands, this requires a compiler with 128-bit integers.
+template<typename T, typename Policy, typename = detail::enable_if_t<
+    detail::has_wide_product<T>::value>
+>
+constexpr value<detail::wide_product_t<T>, Policy> full_product(value<T, Policy> const& x, value<T, Policy> const& y) noexcept
+{
+    return static_cast<detail::wide_product_t<T>>(static_cast<detail::wide_product_t<T>>(x.get()) * y.get());
+}
+
+#if defined(NEO_DETAIL_INT128)
+
+// IOStream
+//----------
+//
+// The standard streams have no operators for 128-bit integers, so these are
+// written in decimal.
+
+namespace detail
+{
+
+// Writes `magnitude` in decimal, preceded by '-' if `negative` is true, to the
+// end of `buffer`, and returns the start of the string. The sign is part of the
+// string so that the stream's width applies to the number as a whole.
+inline char const* format_int128(uint128_t magnitude, bool negative, char (&buffer)[41]) noexcept
+{
+    char* p = buffer + sizeof(buffer);
+
+    *--p = '\0';
+
+    do
+    {
+        *--p = static_cast<char>('0' + static_cast<int>(magnitude % 10));
+        magnitude /= 10;
+    }
+    while (magnitude != 0);
+
+    if (negative)
+    {
+        *--p = '-';
+    }
+
+    return p;
+}
+
+} // namespace detail
+
+template<typename Policy>
+std::ostream& operator<<(std::ostream& s, value<detail::uint128_t, Policy> const& v)
+{
+    char buffer[41];
+    return s << detail::format_int128(v.get(), false, buffer);
+}
+
+template<typename Policy>
+std::ostream& operator<<(std::ostream& s, value<detail::int128_t, Policy> const& v)
+{
+    detail::uint128_t const magnitude = v.get() < 0 ?
+        0u - static_cast<detail::uint128_t>(v.get()) :
+        static_cast<detail::uint128_t>(v.get());
+
+    char buffer[41];
+    return s << detail::format_int128(magnitude, v.get() < 0, buffer);
+}
+
+#endif
+
+} // namespace neo
+
+#endif // NEO_INT128_HPP
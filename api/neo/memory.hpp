@@ -0,0 +1,348 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_MEMORY_HPP
+#define NEO_MEMORY_HPP
+
+#include <neo/traits.hpp>
+#include <neo/undefined.hpp>
+
+#include <neo/detail/type_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<typename T>
+void construct_undefined(T* p, std::true_type) noexcept
+{
+    ::new (static_cast<void*>(p)) T(undefined);
+}
+
+template<typename T>
+void construct_undefined(T* p, std::false_type)
+{
+    ::new (static_cast<void*>(p)) T;
+}
+
+// Constructs an undefined T at p, or default-initializes it if T cannot be
+// constructed from neo::undefined.
+template<typename T>
+void construct_undefined(T* p) noexcept(
+    std::is_constructible<T, undefined_t>::value ||
+    std::is_nothrow_default_constructible<T>::value)
+{
+    construct_undefined(p, std::is_constructible<T, undefined_t>());
+}
+
+} // namespace detail
+
+// An allocator adaptor whose argumentless construct() leaves Neo objects
+// undefined instead of zero-initializing them. Objects which cannot be
+// constructed from neo::undefined are default-initialized instead.
+template<typename T, typename Allocator = std::allocator<T>>
+class undefined_allocator : public Allocator
+{
+private:
+    using traits = std::allocator_traits<Allocator>;
+
+public:
+    template<typename U>
+    struct rebind
+    {
+        using other = undefined_allocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    using Allocator::Allocator;
+
+    undefined_allocator() = default;
+
+    template<typename U, typename A>
+    undefined_allocator(undefined_allocator<U, A> const& other) noexcept :
+        Allocator(static_cast<A const&>(other))
+    {
+    }
+
+    template<typename U>
+    void construct(U* p) noexcept(noexcept(detail::construct_undefined(p)))
+    {
+        detail::construct_undefined(p);
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        traits::construct(static_cast<Allocator&>(*this), p, std::forward<Args>(args)...);
+    }
+};
+
+namespace detail
+{
+
+template<typename T>
+void destroy_n(T* first, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        first[i].~T();
+    }
+}
+
+// Returns true if every byte of `value` is equal, storing that byte in `byte`.
+template<typename T>
+bool is_byte_splat(T const& value, unsigned char& byte) noexcept
+{
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, std::addressof(value), sizeof(T));
+    byte = bytes[0];
+
+    return std::all_of(bytes + 1, bytes + sizeof(T), [&](unsigned char b) { return b == byte; });
+}
+
+// Calls `construct` on each of the `count` objects at `first`, destroying the
+// constructed objects if one throws.
+template<typename T, typename Construct>
+T* construct_n(T* first, std::size_t count, Construct construct)
+{
+    std::size_t i = 0;
+
+    try
+    {
+        for (; i < count; ++i)
+        {
+            construct(first + i);
+        }
+    }
+    catch (...)
+    {
+        destroy_n(first, i);
+        throw;
+    }
+
+    return first + count;
+}
+
+template<typename T>
+T* zero_n(T* first, std::size_t count) noexcept
+{
+    if (count != 0)
+    {
+        std::memset(static_cast<void*>(first), 0, count * sizeof(T));
+    }
+
+    return first + count;
+}
+
+template<typename T>
+T* uninitialized_default_construct_n(T* first, std::size_t count, std::true_type) noexcept
+{
+    return zero_n(first, count);
+}
+
+template<typename T>
+T* uninitialized_default_construct_n(T* first, std::size_t count, std::false_type)
+{
+    return construct_n(first, count, [](T* p) { ::new (static_cast<void*>(p)) T; });
+}
+
+template<typename T>
+T* uninitialized_value_construct_n(T* first, std::size_t count, std::true_type) noexcept
+{
+    return zero_n(first, count);
+}
+
+template<typename T>
+T* uninitialized_value_construct_n(T* first, std::size_t count, std::false_type)
+{
+    return construct_n(first, count, [](T* p) { ::new (static_cast<void*>(p)) T(); });
+}
+
+template<typename T>
+T* fill_n(T* first, std::size_t count, T const& value, std::true_type) noexcept
+{
+    unsigned char byte;
+
+    if (count != 0 && is_byte_splat(value, byte))
+    {
+        std::memset(static_cast<void*>(first), byte, count * sizeof(T));
+    }
+    else
+    {
+        // `value` may live in the destination range
+        T const copy = value;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::memcpy(static_cast<void*>(first + i), std::addressof(copy), sizeof(T));
+        }
+    }
+
+    return first + count;
+}
+
+template<typename T>
+T* fill_n(T* first, std::size_t count, T const& value, std::false_type)
+{
+    return std::fill_n(first, count, value);
+}
+
+template<typename T>
+T* uninitialized_fill_n(T* first, std::size_t count, T const& value, std::false_type)
+{
+    return std::uninitialized_fill_n(first, count, value);
+}
+
+template<typename T>
+T* uninitialized_fill_n(T* first, std::size_t count, T const& value, std::true_type) noexcept
+{
+    return fill_n(first, count, value, std::true_type());
+}
+
+template<typename T>
+T* copy_n(T const* first, std::size_t count, T* result, std::true_type) noexcept
+{
+    if (count != 0)
+    {
+        std::memmove(static_cast<void*>(result), static_cast<void const*>(first), count * sizeof(T));
+    }
+
+    return result + count;
+}
+
+template<typename T>
+T* copy_n(T const* first, std::size_t count, T* result, std::false_type)
+{
+    return std::copy_n(first, count, result);
+}
+
+template<typename T>
+T* uninitialized_copy_n(T const* first, std::size_t count, T* result, std::true_type) noexcept
+{
+    if (count != 0)
+    {
+        std::memcpy(static_cast<void*>(result), static_cast<void const*>(first), count * sizeof(T));
+    }
+
+    return result + count;
+}
+
+template<typename T>
+T* uninitialized_copy_n(T const* first, std::size_t count, T* result, std::false_type)
+{
+    return std::uninitialized_copy_n(first, count, result);
+}
+
+template<typename T>
+T* uninitialized_relocate_n(T* first, std::size_t count, T* result, std::true_type) noexcept
+{
+    return uninitialized_copy_n(first, count, result, std::true_type());
+}
+
+template<typename T>
+T* uninitialized_relocate_n(T* first, std::size_t count, T* result, std::false_type) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ::new (static_cast<void*>(result + i)) T(std::move(first[i]));
+        first[i].~T();
+    }
+
+    return result + count;
+}
+
+} // namespace detail
+
+// Bulk Algorithms
+//-----------------
+//
+// Counterparts of the standard algorithms for contiguous ranges. Standard
+// library implementations only use memset and memcpy for trivial types, which
+// Neo types are not, as they zero-initialize on default construction. These
+// use them whenever is_zero_initialized_by_default, is_bitwise_copyable or
+// is_trivially_relocatable holds, and otherwise behave like the standard
+// algorithms.
+
+// Default-initializes `count` objects in the uninitialized storage at `first`.
+template<typename T>
+T* uninitialized_default_construct_n(T* first, std::size_t count) noexcept(
+    is_zero_initialized_by_default<T>::value ||
+    std::is_nothrow_default_constructible<T>::value)
+{
+    return detail::uninitialized_default_construct_n(first, count, is_zero_initialized_by_default<T>());
+}
+
+// Value-initializes `count` objects in the uninitialized storage at `first`.
+template<typename T>
+T* uninitialized_value_construct_n(T* first, std::size_t count) noexcept(
+    is_zero_initialized_by_default<T>::value ||
+    std::is_nothrow_default_constructible<T>::value)
+{
+    return detail::uninitialized_value_construct_n(first, count, is_zero_initialized_by_default<T>());
+}
+
+// Constructs `count` copies of `value` in the uninitialized storage at `first`.
+template<typename T>
+T* uninitialized_fill_n(T* first, std::size_t count, detail::identity_t<T> const& value) noexcept(
+    is_bitwise_copyable<T>::value ||
+    std::is_nothrow_copy_constructible<T>::value)
+{
+    return detail::uninitialized_fill_n(first, count, value, is_bitwise_copyable<T>());
+}
+
+// Copies the `count` objects at `first` into the uninitialized storage at
+// `result`. The ranges must not overlap.
+template<typename T>
+T* uninitialized_copy_n(T const* first, std::size_t count, T* result) noexcept(
+    is_bitwise_copyable<T>::value ||
+    std::is_nothrow_copy_constructible<T>::value)
+{
+    return detail::uninitialized_copy_n(first, count, result, is_bitwise_copyable<T>());
+}
+
+// Moves the `count` objects at `first` into the uninitialized storage at
+// `result` and destroys the originals, leaving `first` uninitialized. The
+// ranges must not overlap. Trivially relocatable objects are copied with
+// memcpy; other types must be nothrow move constructible.
+template<typename T>
+T* uninitialized_relocate_n(T* first, std::size_t count, T* result) noexcept
+{
+    static_assert(is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value,
+            "relocation requires a trivially relocatable or nothrow move constructible type");
+
+    return detail::uninitialized_relocate_n(first, count, result, is_trivially_relocatable<T>());
+}
+
+// Assigns `value` to the `count` objects at `first`. If every byte of `value`
+// is equal, a single memset is used.
+template<typename T>
+T* fill_n(T* first, std::size_t count, detail::identity_t<T> const& value) noexcept(
+    is_bitwise_copyable<T>::value ||
+    std::is_nothrow_copy_assignable<T>::value)
+{
+    return detail::fill_n(first, count, value, is_bitwise_copyable<T>());
+}
+
+// Assigns the `count` objects at `first` to the objects at `result`. As with
+// std::copy_n, `result` may precede `first` within the same range.
+template<typename T>
+T* copy_n(T const* first, std::size_t count, T* result) noexcept(
+    is_bitwise_copyable<T>::value ||
+    std::is_nothrow_copy_assignable<T>::value)
+{
+    return detail::copy_n(first, count, result, is_bitwise_copyable<T>());
+}
+
+} // namespace neo
+
+#endif // NEO_MEMORY_HPP
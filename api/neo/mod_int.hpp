@@ -0,0 +1,509 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_MOD_INT_HPP
+#define NEO_MOD_INT_HPP
+
+#include <neo/algorithm.hpp>
+#include <neo/span.hpp>
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/kernels.hpp>
+#include <neo/detail/mod_int.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace neo
+{
+
+template<std::uint64_t Modulus>
+class mod_int;
+
+namespace detail
+{
+
+template<typename T>
+struct is_mod_int : std::false_type
+{
+};
+
+template<std::uint64_t Modulus>
+struct is_mod_int<mod_int<Modulus>> : std::true_type
+{
+};
+
+// Unsigned integers convert implicitly to residues, and signed integers must
+// be converted explicitly.
+template<typename U, typename = void>
+struct is_mod_operand : std::false_type
+{
+};
+
+template<typename U>
+struct is_mod_operand<U, enable_if_t<is_unsigned_integral<U>::value>> : std::true_type
+{
+};
+
+template<typename U, typename Policy>
+struct is_mod_operand<value<U, Policy>> : is_mod_operand<U>
+{
+};
+
+template<std::uint64_t Modulus>
+struct mod_constants
+{
+    static constexpr montgomery<mod_storage_t<Modulus>> value = montgomery<mod_storage_t<Modulus>>(Modulus);
+};
+
+template<std::uint64_t Modulus>
+constexpr montgomery<mod_storage_t<Modulus>> mod_constants<Modulus>::value;
+
+// The residue of `x` modulo `n`, for any integer `x`.
+template<typename T, typename U>
+constexpr T residue_of(U x, T n) noexcept
+{
+    return is_signed<U>::value && x < U(0) ?
+        static_cast<T>((n - static_cast<T>((U(0) - static_cast<U>(x + U(1))) % n) - 1u) % n) :
+        static_cast<T>(x % n);
+}
+
+template<typename A, typename B>
+struct are_mod_int_spans : std::integral_constant<bool,
+        is_mod_int<remove_cv_t<A>>::value &&
+        is_same<A, B>::value
+    >
+{
+};
+
+template<std::uint64_t Modulus>
+mod_storage_t<Modulus> const* lanes(mod_int<Modulus> const* p) noexcept
+{
+    return reinterpret_cast<mod_storage_t<Modulus> const*>(p);
+}
+
+template<std::uint64_t Modulus>
+mod_storage_t<Modulus>* lanes(mod_int<Modulus>* p) noexcept
+{
+    return reinterpret_cast<mod_storage_t<Modulus>*>(p);
+}
+
+// Products of spans of residues use the vector kernel for 32-bit moduli, and
+// are multiplied one at a time otherwise.
+template<bool Plain>
+void montgomery_mul_lanes(std::uint32_t const* a, std::uint32_t const* b, montgomery<std::uint32_t> m, std::uint32_t* out, std::size_t count) noexcept
+{
+    dispatch<montgomery_kernel<Plain>>::call(a, b, m, out, count);
+}
+
+template<bool Plain>
+void montgomery_mul_lanes(std::uint64_t const* a, std::uint64_t const* b, montgomery<std::uint64_t> m, std::uint64_t* out, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Plain ? m.mul(m.mul(a[i], b[i]), m.r_squared) : m.mul(a[i], b[i]);
+    }
+}
+
+} // namespace detail
+
+// Modular Integers
+//------------------
+//
+// A residue modulo `Modulus`, which must be odd, for modular hashing and
+// number-theoretic transforms. Residues are stored in Montgomery form, in a
+// std::uint32_t if `Modulus` fits in one and a std::uint64_t otherwise, so
+// products are reduced without division. As with unsigned values, unsigned
+// integers convert implicitly, and are reduced modulo `Modulus`, while signed
+// integers must be converted explicitly.
+template<std::uint64_t Modulus>
+class mod_int
+{
+    static_assert(Modulus > 1 && Modulus % 2 == 1,
+            "mod_int must have an odd modulus greater than 1");
+
+public:
+    using value_type = detail::mod_storage_t<Modulus>;
+
+    static constexpr std::uint64_t modulus = Modulus;
+
+private:
+    using constants = detail::mod_constants<Modulus>;
+
+    value<value_type> m_value;
+
+    struct raw_tag
+    {
+    };
+
+    constexpr mod_int(raw_tag, value_type raw) noexcept :
+        m_value(raw)
+    {
+    }
+
+public:
+    constexpr mod_int() noexcept :
+        m_value()
+    {
+    }
+
+    mod_int(undefined_t) noexcept :
+        m_value(undefined)
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    constexpr mod_int(U const& x) noexcept :
+        m_value(constants::value.to_montgomery(detail::residue_of(x, static_cast<value_type>(Modulus))))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && detail::is_signed<U>::value>,
+        typename = void
+    >
+    constexpr explicit mod_int(U const& x) noexcept :
+        m_value(constants::value.to_montgomery(detail::residue_of(x, static_cast<value_type>(Modulus))))
+    {
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    constexpr mod_int(value<U, Policy> const& x) noexcept :
+        mod_int(x.get())
+    {
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && detail::is_signed<U>::value>,
+        typename = void
+    >
+    constexpr explicit mod_int(value<U, Policy> const& x) noexcept :
+        mod_int(x.get())
+    {
+    }
+
+    // The residue, which is in [0, Modulus).
+    constexpr value<value_type> residue() const noexcept
+    {
+        return constants::value.from_montgomery(m_value.get());
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && !detail::is_same<U, bool>::value>
+    >
+    constexpr explicit operator U() const noexcept
+    {
+        return static_cast<U>(residue().get());
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && !detail::is_same<U, bool>::value>
+    >
+    constexpr explicit operator value<U, Policy>() const noexcept
+    {
+        return static_cast<U>(*this);
+    }
+
+    // The representation, which is the residue multiplied by 2^w modulo
+    // `Modulus`, where w is the width of value_type.
+    constexpr value<value_type> raw() const noexcept
+    {
+        return m_value;
+    }
+
+    static constexpr mod_int from_raw(value<value_type> const& raw) noexcept
+    {
+        return mod_int(raw_tag(), raw.get());
+    }
+
+    constexpr mod_int operator+() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr mod_int operator-() const noexcept
+    {
+        return from_raw(constants::value.sub(0u, m_value.get()));
+    }
+
+    mod_int& operator+=(mod_int const& rhs) noexcept
+    {
+        m_value = constants::value.add(m_value.get(), rhs.m_value.get());
+        return *this;
+    }
+
+    mod_int& operator-=(mod_int const& rhs) noexcept
+    {
+        m_value = constants::value.sub(m_value.get(), rhs.m_value.get());
+        return *this;
+    }
+
+    mod_int& operator*=(mod_int const& rhs) noexcept
+    {
+        m_value = constants::value.mul(m_value.get(), rhs.m_value.get());
+        return *this;
+    }
+
+    // Returns this residue to the power of `e`.
+    constexpr mod_int pow(value<std::uint64_t> const& e) const noexcept
+    {
+        return from_raw(constants::value.pow(m_value.get(), e.get()));
+    }
+
+    // Returns the multiplicative inverse, computed as this residue to the
+    // power of Modulus - 2, which is only correct if `Modulus` is prime. The
+    // inverse of zero is zero.
+    constexpr mod_int inverse() const noexcept
+    {
+        return pow(Modulus - 2);
+    }
+};
+
+template<std::uint64_t Modulus>
+constexpr std::uint64_t mod_int<Modulus>::modulus;
+
+// mod_int - mod_int
+//-------------------
+//
+// Either operand may also be an unsigned integer or value.
+
+template<std::uint64_t Modulus>
+constexpr value<bool> operator==(mod_int<Modulus> const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return lhs.raw() == rhs.raw();
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr value<bool> operator==(mod_int<Modulus> const& lhs, U const& rhs) noexcept
+{
+    return lhs == mod_int<Modulus>(rhs);
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr value<bool> operator==(U const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>(lhs) == rhs;
+}
+
+template<std::uint64_t Modulus>
+constexpr value<bool> operator!=(mod_int<Modulus> const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return lhs.raw() != rhs.raw();
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr value<bool> operator!=(mod_int<Modulus> const& lhs, U const& rhs) noexcept
+{
+    return lhs != mod_int<Modulus>(rhs);
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr value<bool> operator!=(U const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>(lhs) != rhs;
+}
+
+template<std::uint64_t Modulus>
+constexpr mod_int<Modulus> operator+(mod_int<Modulus> const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>::from_raw(detail::mod_constants<Modulus>::value.add(lhs.raw().get(), rhs.raw().get()));
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr mod_int<Modulus> operator+(mod_int<Modulus> const& lhs, U const& rhs) noexcept
+{
+    return lhs + mod_int<Modulus>(rhs);
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr mod_int<Modulus> operator+(U const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>(lhs) + rhs;
+}
+
+template<std::uint64_t Modulus>
+constexpr mod_int<Modulus> operator-(mod_int<Modulus> const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>::from_raw(detail::mod_constants<Modulus>::value.sub(lhs.raw().get(), rhs.raw().get()));
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr mod_int<Modulus> operator-(mod_int<Modulus> const& lhs, U const& rhs) noexcept
+{
+    return lhs - mod_int<Modulus>(rhs);
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr mod_int<Modulus> operator-(U const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>(lhs) - rhs;
+}
+
+template<std::uint64_t Modulus>
+constexpr mod_int<Modulus> operator*(mod_int<Modulus> const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>::from_raw(detail::mod_constants<Modulus>::value.mul(lhs.raw().get(), rhs.raw().get()));
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr mod_int<Modulus> operator*(mod_int<Modulus> const& lhs, U const& rhs) noexcept
+{
+    return lhs * mod_int<Modulus>(rhs);
+}
+
+template<std::uint64_t Modulus, typename U, typename = detail::enable_if_t<
+    detail::is_mod_operand<U>::value>
+>
+constexpr mod_int<Modulus> operator*(U const& lhs, mod_int<Modulus> const& rhs) noexcept
+{
+    return mod_int<Modulus>(lhs) * rhs;
+}
+
+// IOStream
+//----------
+
+template<std::uint64_t Modulus>
+std::ostream& operator<<(std::ostream& s, mod_int<Modulus> const& x)
+{
+    s << x.residue();
+    return s;
+}
+
+// Runtime Moduli
+//----------------
+//
+// A modulus which is only known at runtime, with the constants of Montgomery
+// arithmetic computed once, on construction. Its operations take and return
+// ordinary residues, so values need not be converted to and from Montgomery
+// form, at the cost of a second reduction per product.
+template<typename T>
+class modulus
+{
+    static_assert(std::is_same<T, std::uint32_t>::value || std::is_same<T, std::uint64_t>::value,
+            "modulus must be std::uint32_t or std::uint64_t");
+
+private:
+    detail::montgomery<T> m_constants;
+
+    static T checked(T n)
+    {
+        if (n < 2u || n % 2u == 0u)
+        {
+            throw std::invalid_argument("neo::modulus: modulus must be odd and greater than 1");
+        }
+
+        return n;
+    }
+
+public:
+    // Throws std::invalid_argument if `n` is even or less than 2.
+    explicit modulus(value<T> const& n) :
+        m_constants(checked(n.get()))
+    {
+    }
+
+    value<T> get() const noexcept
+    {
+        return m_constants.modulus;
+    }
+
+    detail::montgomery<T> const& constants() const noexcept
+    {
+        return m_constants;
+    }
+
+    // Returns the residue of `x`, which need not be less than the modulus.
+    value<T> reduce(value<std::uint64_t> const& x) const noexcept
+    {
+        return detail::residue_of(x.get(), m_constants.modulus);
+    }
+
+    // The arithmetic operations take residues, which must be less than the
+    // modulus.
+
+    value<T> add(value<T> const& x, value<T> const& y) const noexcept
+    {
+        return m_constants.add(x.get(), y.get());
+    }
+
+    value<T> sub(value<T> const& x, value<T> const& y) const noexcept
+    {
+        return m_constants.sub(x.get(), y.get());
+    }
+
+    value<T> mul(value<T> const& x, value<T> const& y) const noexcept
+    {
+        return m_constants.mul(m_constants.mul(x.get(), y.get()), m_constants.r_squared);
+    }
+
+    value<T> pow(value<T> const& x, value<std::uint64_t> const& e) const noexcept
+    {
+        return m_constants.from_montgomery(m_constants.pow(m_constants.to_montgomery(x.get()), e.get()));
+    }
+};
+
+// Modular Span Kernels
+//----------------------
+//
+// As in algorithm.hpp, `a`, `b` and `out` must have the same size, and `out`
+// may be the same range as `a` or `b`.
+
+// Assigns `a[i] * b[i]` to each `out[i]`. For moduli of up to 32 bits, the
+// products are computed in vectors.
+template<typename A, typename B, typename = detail::enable_if_t<
+    detail::are_mod_int_spans<A, B>::value>,
+    typename = void
+>
+void transform_mul(span<A> a, span<B> b, span<detail::remove_cv_t<A>> out) noexcept
+{
+    using result = detail::remove_cv_t<A>;
+
+    detail::montgomery_mul_lanes<false>(detail::lanes(a.data()), detail::lanes(b.data()),
+            detail::mod_constants<result::modulus>::value, detail::lanes(out.data()), out.size());
+}
+
+// Assigns `a[i] * b[i]` modulo `m` to each `out[i]`. The elements of `a` and
+// `b` must be less than `m`.
+template<typename A, typename B, typename T, typename Policy, typename = detail::enable_if_t<
+    std::is_same<detail::span_lane_t<A>, T>::value &&
+    std::is_same<detail::span_lane_t<B>, T>::value>
+>
+void transform_mul(span<A> a, span<B> b, span<value<T, Policy>> out, modulus<T> const& m) noexcept
+{
+    detail::montgomery_mul_lanes<true>(detail::lanes(a.data()), detail::lanes(b.data()),
+            m.constants(), detail::lanes(out.data()), out.size());
+}
+
+} // namespace neo
+
+#endif // NEO_MOD_INT_HPP
@@ -6,11 +6,34 @@
 #ifndef NEO_NEO_HPP
 #define NEO_NEO_HPP
 
+#include <neo/algorithm.hpp>
+#include <neo/atomic.hpp>
+#include <neo/atomic_ptr.hpp>
+#include <neo/checked.hpp>
+#include <neo/compressed_ptr.hpp>
+#include <neo/cpu.hpp>
+#include <neo/divider.hpp>
+#include <neo/dynarray.hpp>
+#include <neo/fixed.hpp>
+#include <neo/float16.hpp>
+#include <neo/int128.hpp>
+#include <neo/memory.hpp>
+#include <neo/mod_int.hpp>
+#include <neo/offset_ptr.hpp>
 #include <neo/ptr.hpp>
+#include <neo/ranged.hpp>
 #include <neo/ref.hpp>
 #include <neo/optional_ref.hpp>
+#include <neo/saturating.hpp>
+#include <neo/simd.hpp>
+#include <neo/span.hpp>
 #include <neo/stdint.hpp>
+#include <neo/tagged_ptr.hpp>
+#include <neo/traits.hpp>
 #include <neo/undefined.hpp>
 #include <neo/value.hpp>
+#include <neo/vector.hpp>
+#include <neo/wide_uint.hpp>
+#include <neo/wrapping.hpp>
 
 #endif // NEO_NEO_HPP
@@ -0,0 +1,215 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_OFFSET_PTR_HPP
+#define NEO_OFFSET_PTR_HPP
+
+#include <neo/ptr.hpp>
+#include <neo/traits.hpp>
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+
+namespace neo
+{
+
+// Offset Pointers
+//-----------------
+//
+// A ptr<T> stored as the distance from its own address to the object, so a
+// structure linked by offset pointers stays valid wherever its memory is
+// mapped, and can be mapped read-only, or shared between processes, without
+// being fixed up. The distance is stored plus one, so that, like ptr<T>, an
+// offset pointer is null by default, and null is represented by zero bits.
+// An offset pointer therefore cannot point to the byte before itself, which
+// only an object with an alignment of one can occupy.
+//
+// Copying an offset pointer recomputes the distance, so it is not bitwise
+// copyable or trivially relocatable, but a whole structure may be copied or
+// moved with its bytes, as long as the objects that it points to move with
+// it.
+template<typename T>
+class offset_ptr
+{
+public:
+    using element_type = T;
+    using pointer = element_type*;
+
+private:
+    std::ptrdiff_t m_value;
+
+    std::ptrdiff_t distance(pointer value) const noexcept
+    {
+        return value == nullptr ? 0 :
+            static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(value) - reinterpret_cast<std::uintptr_t>(this) + 1u);
+    }
+
+    // The address of the object, which must not be null.
+    pointer address() const noexcept
+    {
+        return reinterpret_cast<pointer>(reinterpret_cast<std::uintptr_t>(this) - 1u + static_cast<std::uintptr_t>(m_value));
+    }
+
+public:
+    constexpr offset_ptr() noexcept :
+        offset_ptr(nullptr)
+    {
+    }
+
+    constexpr offset_ptr(std::nullptr_t) noexcept :
+        m_value()
+    {
+    }
+
+    offset_ptr(undefined_t) noexcept
+    {
+    }
+
+    offset_ptr(pointer value) noexcept :
+        m_value(distance(value))
+    {
+    }
+
+    offset_ptr& operator=(pointer value) noexcept
+    {
+        m_value = distance(value);
+        return *this;
+    }
+
+    offset_ptr(offset_ptr const& other) noexcept :
+        m_value(distance(other.get()))
+    {
+    }
+
+    offset_ptr& operator=(offset_ptr const& other) noexcept
+    {
+        m_value = distance(other.get());
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_convertible<U*, T*>::value>
+    >
+    offset_ptr(offset_ptr<U> const& other) noexcept :
+        m_value(distance(other.get()))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_convertible<U*, T*>::value>
+    >
+    offset_ptr& operator=(offset_ptr<U> const& other) noexcept
+    {
+        m_value = distance(other.get());
+        return *this;
+    }
+
+    operator pointer() const noexcept
+    {
+        return get();
+    }
+
+    operator ptr<T>() const noexcept
+    {
+        return get();
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return m_value != 0;
+    }
+
+    constexpr explicit operator value<bool>() const noexcept
+    {
+        return static_cast<bool>(*this);
+    }
+
+    element_type& operator*() const noexcept
+    {
+        return *address();
+    }
+
+    pointer operator->() const noexcept
+    {
+        return address();
+    }
+
+    pointer get() const noexcept
+    {
+        return m_value == 0 ? nullptr : address();
+    }
+};
+
+// The null pointer is represented by all-zero bits, so zero-filled memory
+// (e.g. a fresh mapping) holds null offset pointers.
+template<typename T>
+struct is_zero_initialized_by_default<offset_ptr<T>> : std::true_type
+{
+};
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator==(offset_ptr<T1> const& lhs, offset_ptr<T2> const& rhs) noexcept
+{
+    return lhs.get() == rhs.get();
+}
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator!=(offset_ptr<T1> const& lhs, offset_ptr<T2> const& rhs) noexcept
+{
+    return lhs.get() != rhs.get();
+}
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator<(offset_ptr<T1> const& lhs, offset_ptr<T2> const& rhs) noexcept
+{
+    return std::less<detail::common_type_t<T1*, T2*>>()(lhs.get(), rhs.get());
+}
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator<=(offset_ptr<T1> const& lhs, offset_ptr<T2> const& rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator>(offset_ptr<T1> const& lhs, offset_ptr<T2> const& rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+template<typename T1, typename T2, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator>=(offset_ptr<T1> const& lhs, offset_ptr<T2> const& rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+template<typename T>
+std::ostream& operator<<(std::ostream& s, offset_ptr<T> const& v)
+{
+    s << v.get();
+    return s;
+}
+
+} // namespace neo
+
+#endif // NEO_OFFSET_PTR_HPP
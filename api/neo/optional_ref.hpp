@@ -7,6 +7,8 @@
 #define NEO_OPTIONAL_REF_HPP
 
 #include <neo/nullopt.hpp>
+#include <neo/ref.hpp>
+#include <neo/traits.hpp>
 #include <neo/undefined.hpp>
 #include <neo/value.hpp>
 
@@ -107,7 +109,7 @@ public:
         return has_value();
     }
 
-    constexpr explicit operator ptr<bool>() const noexcept
+    constexpr explicit operator neo::value<bool>() const noexcept
     {
         return has_value();
     }
@@ -122,7 +124,7 @@ public:
         return m_value;
     }
 
-    constexpr value<bool> has_value() const noexcept
+    constexpr neo::value<bool> has_value() const noexcept
     {
         return m_value != nullptr;
     }
@@ -139,6 +141,11 @@ public:
     }
 };
 
+template<typename T>
+struct is_zero_initialized_by_default<optional_ref<T>> : std::true_type
+{
+};
+
 template<typename T1, typename T2, typename =
     detail::common_type_t<T1*, T2*>
 >
@@ -195,4 +202,19 @@ constexpr optional_ref<T> make_optional_ref(T& object) noexcept
 
 } // namespace neo
 
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+
+namespace std
+{
+
+template<typename T>
+struct __is_bitwise_relocatable<neo::optional_ref<T>> :
+    neo::is_trivially_relocatable<neo::optional_ref<T>>
+{
+};
+
+} // namespace std
+
+#endif
+
 #endif // NEO_OPTIONAL_REF_HPP
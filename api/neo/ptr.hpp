@@ -6,6 +6,7 @@
 #ifndef NEO_PTR_HPP
 #define NEO_PTR_HPP
 
+#include <neo/traits.hpp>
 #include <neo/undefined.hpp>
 #include <neo/value.hpp>
 
@@ -80,7 +81,7 @@ public:
         return m_value != nullptr;
     }
 
-    constexpr explicit operator ptr<bool>() const noexcept
+    constexpr explicit operator value<bool>() const noexcept
     {
         return static_cast<bool>(*this);
     }
@@ -101,6 +102,12 @@ public:
     }
 };
 
+// The null pointer is represented by all-zero bits on every supported platform.
+template<typename T>
+struct is_zero_initialized_by_default<ptr<T>> : std::true_type
+{
+};
+
 template<typename T1, typename T2, typename =
     detail::common_type_t<T1*, T2*>
 >
@@ -122,7 +129,7 @@ template<typename T1, typename T2, typename =
 >
 constexpr value<bool> operator<(ptr<T1> const& lhs, ptr<T2> const& rhs) noexcept
 {
-    return std::less<detail::common_type_t<T1*, T2*>>(lhs.get(), rhs.get());
+    return std::less<detail::common_type_t<T1*, T2*>>()(lhs.get(), rhs.get());
 }
 
 template<typename T1, typename T2, typename =
@@ -171,4 +178,19 @@ constexpr ptr<T> make_ptr(T* object) noexcept
 
 } // namespace neo
 
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+
+namespace std
+{
+
+template<typename T>
+struct __is_bitwise_relocatable<neo::ptr<T>> :
+    neo::is_trivially_relocatable<neo::ptr<T>>
+{
+};
+
+} // namespace std
+
+#endif
+
 #endif // NEO_PTR_HPP
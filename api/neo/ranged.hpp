@@ -0,0 +1,443 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_RANGED_HPP
+#define NEO_RANGED_HPP
+
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/type_traits.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace neo
+{
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+class ranged;
+
+namespace detail
+{
+
+template<typename T>
+struct is_ranged : std::false_type
+{
+};
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+struct is_ranged<ranged<Lo, Hi>> : std::true_type
+{
+};
+
+template<typename T>
+struct is_integer_like : std::integral_constant<bool,
+        (std::is_integral<T>::value && !is_same<T, bool>::value) ||
+        is_ranged<T>::value
+    >
+{
+};
+
+template<typename T>
+struct integer_bounds
+{
+    static constexpr T lowest() noexcept
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    static constexpr T highest() noexcept
+    {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+struct integer_bounds<ranged<Lo, Hi>>
+{
+    static constexpr std::intmax_t lowest() noexcept
+    {
+        return Lo;
+    }
+
+    static constexpr std::intmax_t highest() noexcept
+    {
+        return Hi;
+    }
+};
+
+template<typename T>
+constexpr bool is_negative(T x) noexcept
+{
+    return std::is_signed<T>::value && x < static_cast<T>(0);
+}
+
+// Comparisons of integers of any signedness which, unlike the built-in
+// operators, do not convert negative values to unsigned.
+template<typename T1, typename T2>
+constexpr bool integer_equal(T1 lhs, T2 rhs) noexcept
+{
+    return is_negative(lhs) == is_negative(rhs) &&
+        static_cast<std::uintmax_t>(lhs) == static_cast<std::uintmax_t>(rhs);
+}
+
+template<typename T1, typename T2>
+constexpr bool integer_less(T1 lhs, T2 rhs) noexcept
+{
+    return is_negative(lhs) != is_negative(rhs) ?
+        is_negative(lhs) :
+        static_cast<std::uintmax_t>(lhs) < static_cast<std::uintmax_t>(rhs);
+}
+
+template<typename From, typename To, bool =
+    is_integer_like<From>::value && is_integer_like<To>::value
+>
+struct is_range_bounded : std::integral_constant<bool,
+        !integer_less(integer_bounds<From>::lowest(), integer_bounds<To>::lowest()) &&
+        !integer_less(integer_bounds<To>::highest(), integer_bounds<From>::highest())
+    >
+{
+};
+
+template<typename From, typename To>
+struct is_range_bounded<From, To, false> : std::false_type
+{
+};
+
+// A ranged value converts implicitly to and from any integer type, and any
+// other ranged type, which can hold every value in its range, regardless of
+// signedness.
+template<std::intmax_t Lo, std::intmax_t Hi, typename To>
+struct is_safely_convertible<ranged<Lo, Hi>, To, false> : is_range_bounded<ranged<Lo, Hi>, To>
+{
+};
+
+template<typename From, std::intmax_t Lo, std::intmax_t Hi>
+struct is_safely_convertible<From, ranged<Lo, Hi>, false> : is_range_bounded<From, ranged<Lo, Hi>>
+{
+};
+
+template<std::intmax_t Lo1, std::intmax_t Hi1, std::intmax_t Lo2, std::intmax_t Hi2>
+struct is_safely_convertible<ranged<Lo1, Hi1>, ranged<Lo2, Hi2>, false> :
+    is_range_bounded<ranged<Lo1, Hi1>, ranged<Lo2, Hi2>>
+{
+};
+
+template<typename T>
+constexpr bool holds_range(std::intmax_t lo, std::intmax_t hi) noexcept
+{
+    return !integer_less(lo, std::numeric_limits<T>::lowest()) &&
+        !integer_less(std::numeric_limits<T>::max(), hi);
+}
+
+// The first of Ts which can hold [Lo, Hi]; the last is used if none can.
+template<std::intmax_t Lo, std::intmax_t Hi, typename T, typename... Ts>
+struct first_holding_range
+{
+    using type = typename std::conditional<holds_range<T>(Lo, Hi),
+        T,
+        typename first_holding_range<Lo, Hi, Ts...>::type>::type;
+};
+
+template<std::intmax_t Lo, std::intmax_t Hi, typename T>
+struct first_holding_range<Lo, Hi, T>
+{
+    using type = T;
+};
+
+// The smallest integer type which can hold [Lo, Hi], preferring unsigned
+// types for ranges which include no negative values.
+template<std::intmax_t Lo, std::intmax_t Hi>
+using ranged_storage_t = typename first_holding_range<Lo, Hi,
+    std::uint8_t, std::int8_t,
+    std::uint16_t, std::int16_t,
+    std::uint32_t, std::int32_t,
+    std::uint64_t, std::int64_t>::type;
+
+template<typename T>
+constexpr T range_value(T const& x) noexcept
+{
+    return x;
+}
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+constexpr std::intmax_t range_value(ranged<Lo, Hi> const& x) noexcept
+{
+    return static_cast<std::intmax_t>(x.get());
+}
+
+constexpr std::intmax_t min4(std::intmax_t a, std::intmax_t b, std::intmax_t c, std::intmax_t d) noexcept
+{
+    return (a < b ? a : b) < (c < d ? c : d) ? (a < b ? a : b) : (c < d ? c : d);
+}
+
+constexpr std::intmax_t max4(std::intmax_t a, std::intmax_t b, std::intmax_t c, std::intmax_t d) noexcept
+{
+    return (a > b ? a : b) > (c > d ? c : d) ? (a > b ? a : b) : (c > d ? c : d);
+}
+
+constexpr std::intmax_t magnitude(std::intmax_t x) noexcept
+{
+    return x < 0 ? -x : x;
+}
+
+// The largest magnitude of a remainder of division by a value in [Lo, Hi],
+// which must not include zero.
+template<std::intmax_t Lo, std::intmax_t Hi>
+struct remainder_magnitude : std::integral_constant<std::intmax_t,
+        (magnitude(Lo) > magnitude(Hi) ? magnitude(Lo) : magnitude(Hi)) - 1
+    >
+{
+};
+
+template<typename T1, typename T2>
+struct are_ranged_comparable : std::integral_constant<bool,
+        is_integer_like<T1>::value && is_integer_like<T2>::value &&
+        (is_ranged<T1>::value || is_ranged<T2>::value)
+    >
+{
+};
+
+} // namespace detail
+
+// Ranged Integers
+//-----------------
+//
+// An integer whose value is known at compile time to lie in [Lo, Hi]. The
+// arithmetic operators compute the bounds of their results at compile time, so
+// `ranged<0, 255> + ranged<0, 255>` is a `ranged<0, 510>`, and a result can
+// never overflow its storage, which is the smallest integer type that holds
+// the range. No runtime checks are made; converting a value which is outside
+// the range, which can only be done explicitly, is undefined.
+template<std::intmax_t Lo, std::intmax_t Hi>
+class ranged
+{
+    static_assert(Lo <= Hi, "ranged lower bound must not exceed upper bound");
+
+public:
+    using value_type = detail::ranged_storage_t<Lo, Hi>;
+
+    static constexpr std::intmax_t lower_bound = Lo;
+    static constexpr std::intmax_t upper_bound = Hi;
+
+private:
+    value_type m_value;
+
+public:
+    // Zero if it is in range, otherwise the lower bound.
+    constexpr ranged() noexcept :
+        m_value(static_cast<value_type>(Lo <= 0 && 0 <= Hi ? 0 : Lo))
+    {
+    }
+
+    ranged(undefined_t) noexcept
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<U, ranged>::value>
+    >
+    constexpr ranged(U const& other) noexcept :
+        m_value(static_cast<value_type>(detail::range_value(other)))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integer_like<U>::value &&
+        !detail::is_safely_convertible<U, ranged>::value>,
+        typename = void
+    >
+    constexpr explicit ranged(U const& other) noexcept :
+        m_value(static_cast<value_type>(detail::range_value(other)))
+    {
+    }
+
+    // value<U> converts implicitly through its own conversion operator.
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        std::is_integral<U>::value &&
+        !detail::is_safely_convertible<U, ranged>::value>
+    >
+    constexpr explicit ranged(value<U, Policy> const& other) noexcept :
+        m_value(static_cast<value_type>(other.get()))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value &&
+        detail::is_safely_convertible<ranged, U>::value>
+    >
+    constexpr operator U() const noexcept
+    {
+        return static_cast<U>(m_value);
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integer_like<U>::value &&
+        !detail::is_ranged<U>::value &&
+        !detail::is_safely_convertible<ranged, U>::value>,
+        typename = void
+    >
+    constexpr explicit operator U() const noexcept
+    {
+        return static_cast<U>(m_value);
+    }
+
+    constexpr value_type get() const noexcept
+    {
+        return m_value;
+    }
+
+    // The nearest value in range to `x`.
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integer_like<U>::value>
+    >
+    static constexpr ranged clamp(U const& x) noexcept
+    {
+        return detail::integer_less(detail::range_value(x), Lo) ? ranged(Lo) :
+            detail::integer_less(Hi, detail::range_value(x)) ? ranged(Hi) :
+            ranged(detail::range_value(x));
+    }
+
+    constexpr ranged operator+() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr ranged<-Hi, -Lo> operator-() const noexcept
+    {
+        return ranged<-Hi, -Lo>(-static_cast<std::intmax_t>(m_value));
+    }
+};
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+constexpr std::intmax_t ranged<Lo, Hi>::lower_bound;
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+constexpr std::intmax_t ranged<Lo, Hi>::upper_bound;
+
+// ranged - ranged
+//-----------------
+
+template<std::intmax_t Lo1, std::intmax_t Hi1, std::intmax_t Lo2, std::intmax_t Hi2>
+constexpr ranged<Lo1 + Lo2, Hi1 + Hi2> operator+(ranged<Lo1, Hi1> const& lhs, ranged<Lo2, Hi2> const& rhs) noexcept
+{
+    return ranged<Lo1 + Lo2, Hi1 + Hi2>(detail::range_value(lhs) + detail::range_value(rhs));
+}
+
+template<std::intmax_t Lo1, std::intmax_t Hi1, std::intmax_t Lo2, std::intmax_t Hi2>
+constexpr ranged<Lo1 - Hi2, Hi1 - Lo2> operator-(ranged<Lo1, Hi1> const& lhs, ranged<Lo2, Hi2> const& rhs) noexcept
+{
+    return ranged<Lo1 - Hi2, Hi1 - Lo2>(detail::range_value(lhs) - detail::range_value(rhs));
+}
+
+template<std::intmax_t Lo1, std::intmax_t Hi1, std::intmax_t Lo2, std::intmax_t Hi2,
+    std::intmax_t Lo = detail::min4(Lo1 * Lo2, Lo1 * Hi2, Hi1 * Lo2, Hi1 * Hi2),
+    std::intmax_t Hi = detail::max4(Lo1 * Lo2, Lo1 * Hi2, Hi1 * Lo2, Hi1 * Hi2)
+>
+constexpr ranged<Lo, Hi> operator*(ranged<Lo1, Hi1> const& lhs, ranged<Lo2, Hi2> const& rhs) noexcept
+{
+    return ranged<Lo, Hi>(detail::range_value(lhs) * detail::range_value(rhs));
+}
+
+// Division is only defined for divisors whose range does not include zero.
+template<std::intmax_t Lo1, std::intmax_t Hi1, std::intmax_t Lo2, std::intmax_t Hi2,
+    typename = detail::enable_if_t<(Lo2 > 0 || Hi2 < 0)>,
+    std::intmax_t Lo = detail::min4(Lo1 / Lo2, Lo1 / Hi2, Hi1 / Lo2, Hi1 / Hi2),
+    std::intmax_t Hi = detail::max4(Lo1 / Lo2, Lo1 / Hi2, Hi1 / Lo2, Hi1 / Hi2)
+>
+constexpr ranged<Lo, Hi> operator/(ranged<Lo1, Hi1> const& lhs, ranged<Lo2, Hi2> const& rhs) noexcept
+{
+    return ranged<Lo, Hi>(detail::range_value(lhs) / detail::range_value(rhs));
+}
+
+template<std::intmax_t Lo1, std::intmax_t Hi1, std::intmax_t Lo2, std::intmax_t Hi2,
+    typename = detail::enable_if_t<(Lo2 > 0 || Hi2 < 0)>,
+    std::intmax_t M = detail::remainder_magnitude<Lo2, Hi2>::value,
+    std::intmax_t Lo = (Lo1 >= 0 ? 0 : -M > Lo1 ? -M : Lo1),
+    std::intmax_t Hi = (Hi1 <= 0 ? 0 : M < Hi1 ? M : Hi1)
+>
+constexpr ranged<Lo, Hi> operator%(ranged<Lo1, Hi1> const& lhs, ranged<Lo2, Hi2> const& rhs) noexcept
+{
+    return ranged<Lo, Hi>(detail::range_value(lhs) % detail::range_value(rhs));
+}
+
+// Comparisons
+//-------------
+//
+// Ranged values compare with each other and with integers of any signedness.
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_ranged_comparable<T1, T2>::value>
+>
+constexpr value<bool> operator==(T1 const& lhs, T2 const& rhs) noexcept
+{
+    return detail::integer_equal(detail::range_value(lhs), detail::range_value(rhs));
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_ranged_comparable<T1, T2>::value>
+>
+constexpr value<bool> operator!=(T1 const& lhs, T2 const& rhs) noexcept
+{
+    return !detail::integer_equal(detail::range_value(lhs), detail::range_value(rhs));
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_ranged_comparable<T1, T2>::value>
+>
+constexpr value<bool> operator<(T1 const& lhs, T2 const& rhs) noexcept
+{
+    return detail::integer_less(detail::range_value(lhs), detail::range_value(rhs));
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_ranged_comparable<T1, T2>::value>
+>
+constexpr value<bool> operator<=(T1 const& lhs, T2 const& rhs) noexcept
+{
+    return !detail::integer_less(detail::range_value(rhs), detail::range_value(lhs));
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_ranged_comparable<T1, T2>::value>
+>
+constexpr value<bool> operator>(T1 const& lhs, T2 const& rhs) noexcept
+{
+    return detail::integer_less(detail::range_value(rhs), detail::range_value(lhs));
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_ranged_comparable<T1, T2>::value>
+>
+constexpr value<bool> operator>=(T1 const& lhs, T2 const& rhs) noexcept
+{
+    return !detail::integer_less(detail::range_value(lhs), detail::range_value(rhs));
+}
+
+// IOStream
+//----------
+
+template<std::intmax_t Lo, std::intmax_t Hi>
+std::ostream& operator<<(std::ostream& s, ranged<Lo, Hi> const& r)
+{
+    s << detail::range_value(r);
+    return s;
+}
+
+// Utilities
+//-----------
+
+template<std::intmax_t V>
+constexpr ranged<V, V> ranged_constant() noexcept
+{
+    return ranged<V, V>(V);
+}
+
+} // namespace neo
+
+#endif // NEO_RANGED_HPP
@@ -6,6 +6,7 @@
 #ifndef NEO_REF_HPP
 #define NEO_REF_HPP
 
+#include <neo/traits.hpp>
 #include <neo/undefined.hpp>
 #include <neo/value.hpp>
 
@@ -65,7 +66,7 @@ public:
         return true;
     }
 
-    constexpr explicit operator ptr<bool>() const noexcept
+    constexpr explicit operator neo::value<bool>() const noexcept
     {
         return static_cast<bool>(*this);
     }
@@ -142,4 +143,19 @@ constexpr ref<T> make_ref(T& object) noexcept
 
 } // namespace neo
 
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+
+namespace std
+{
+
+template<typename T>
+struct __is_bitwise_relocatable<neo::ref<T>> :
+    neo::is_trivially_relocatable<neo::ref<T>>
+{
+};
+
+} // namespace std
+
+#endif
+
 #endif // NEO_REF_HPP
@@ -0,0 +1,102 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_SATURATING_HPP
+#define NEO_SATURATING_HPP
+
+#include <neo/value.hpp>
+
+#include <neo/detail/overflow.hpp>
+
+#include <limits>
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+// Integer arithmetic which clamps results that are not representable in the
+// operand type to its minimum or maximum. As with the fundamental types,
+// division by zero is undefined.
+struct saturating_integral
+{
+    static constexpr bool is_nothrow = true;
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T add(T lhs, T rhs) noexcept
+    {
+        return saturating_add(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T sub(T lhs, T rhs) noexcept
+    {
+        return saturating_sub(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T mul(T lhs, T rhs) noexcept
+    {
+        return saturating_mul(lhs, rhs);
+    }
+
+    // The minimum value divided by -1 gives the maximum value.
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T div(T lhs, T rhs) noexcept
+    {
+        return is_signed<T>::value && rhs == static_cast<T>(-1) ?
+            saturating_sub(static_cast<T>(0), lhs) :
+            static_cast<T>(lhs / rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T mod(T lhs, T rhs) noexcept
+    {
+        return is_signed<T>::value && rhs == static_cast<T>(-1) ?
+            static_cast<T>(0) :
+            static_cast<T>(lhs % rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static T neg(T x) noexcept
+    {
+        return saturating_sub(static_cast<T>(0), x);
+    }
+};
+
+} // namespace detail
+
+namespace policy
+{
+
+// Saturating integer arithmetic. Floating-point arithmetic is unchanged.
+struct saturating : detail::float_passthrough<detail::saturating_integral>
+{
+};
+
+} // namespace policy
+
+// Saturating Arithmetic
+//-----------------------
+//
+// A value whose +, - and * clamp to the range of `T` instead of wrapping, so
+// 200 + 100 is 255 for `saturating<std::uint8_t>`. As with value<T>,
+// operands are not promoted, so results saturate at the range of the wider
+// operand type. Spans of saturating values are supported by transform_add and
+// transform_sub in algorithm.hpp.
+template<typename T>
+using saturating = value<T, policy::saturating>;
+
+template<typename T>
+constexpr saturating<T> make_saturating(T const& v) noexcept
+{
+    return saturating<T>(v);
+}
+
+} // namespace neo
+
+#endif // NEO_SATURATING_HPP
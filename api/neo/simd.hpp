@@ -0,0 +1,605 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_SIMD_HPP
+#define NEO_SIMD_HPP
+
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/simd.hpp>
+#include <neo/detail/simd_neon.hpp>
+#include <neo/detail/simd_x86.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+
+namespace neo
+{
+
+template<typename T, std::size_t N = detail::simd_register_size<T>::value / sizeof(T)>
+class simd;
+
+namespace detail
+{
+
+template<typename T1, typename T2>
+struct are_similar_integral : std::integral_constant<bool,
+        are_similar_numeric<T1, T2>::value && std::is_integral<T1>::value
+    >
+{
+};
+
+// The lane type of a scalar operand of a simd operator.
+template<typename T, typename = void>
+struct simd_scalar
+{
+};
+
+template<typename T>
+struct simd_scalar<T, enable_if_t<is_numeric<T>::value>>
+{
+    using type = T;
+};
+
+template<typename T>
+struct simd_scalar<value<T>, enable_if_t<is_numeric<T>::value>>
+{
+    using type = T;
+};
+
+template<typename T>
+using simd_scalar_t = typename simd_scalar<T>::type;
+
+// The lane type of an operand of a compound assignment to simd<T, N>, which
+// may be another simd<U, N> or a scalar.
+template<typename T, std::size_t N>
+struct simd_operand : simd_scalar<T>
+{
+};
+
+template<typename T, std::size_t N>
+struct simd_operand<simd<T, N>, N>
+{
+    using type = T;
+};
+
+template<typename T, std::size_t N>
+using simd_operand_t = typename simd_operand<T, N>::type;
+
+template<typename T>
+constexpr T scalar_value(T const& x) noexcept
+{
+    return x;
+}
+
+template<typename T>
+constexpr T scalar_value(value<T> const& x) noexcept
+{
+    return x.get();
+}
+
+// A shift count for lanes of type `T`, as an int. Counts which are negative or
+// at least the width of a lane, which shift every bit out, are given as the
+// width of a lane, so that they are not truncated into range.
+template<typename T, typename U>
+constexpr int shift_count(U count) noexcept
+{
+    return static_cast<unsigned long long>(count) < sizeof(T) * 8 ?
+        static_cast<int>(count) :
+        static_cast<int>(sizeof(T) * 8);
+}
+
+} // namespace detail
+
+// The result of a lane-wise comparison of two simd vectors.
+template<std::size_t N>
+class simd_mask
+{
+private:
+    bool m_lanes[N];
+
+public:
+    simd_mask() noexcept :
+        m_lanes()
+    {
+    }
+
+    explicit simd_mask(value<bool> v) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            m_lanes[i] = bool(v);
+        }
+    }
+
+    explicit simd_mask(bool const (&lanes)[N]) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            m_lanes[i] = lanes[i];
+        }
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    value<bool> operator[](std::size_t i) const noexcept
+    {
+        return m_lanes[i];
+    }
+
+    simd_mask operator!() const noexcept
+    {
+        bool lanes[N];
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            lanes[i] = !m_lanes[i];
+        }
+
+        return simd_mask(lanes);
+    }
+
+    friend simd_mask operator&&(simd_mask const& lhs, simd_mask const& rhs) noexcept
+    {
+        bool lanes[N];
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            lanes[i] = lhs.m_lanes[i] && rhs.m_lanes[i];
+        }
+
+        return simd_mask(lanes);
+    }
+
+    friend simd_mask operator||(simd_mask const& lhs, simd_mask const& rhs) noexcept
+    {
+        bool lanes[N];
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            lanes[i] = lhs.m_lanes[i] || rhs.m_lanes[i];
+        }
+
+        return simd_mask(lanes);
+    }
+};
+
+template<std::size_t N>
+value<bool> all(simd_mask<N> const& mask) noexcept
+{
+    bool result = true;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        result = result && bool(mask[i]);
+    }
+
+    return result;
+}
+
+template<std::size_t N>
+value<bool> any(simd_mask<N> const& mask) noexcept
+{
+    bool result = false;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        result = result || bool(mask[i]);
+    }
+
+    return result;
+}
+
+template<std::size_t N>
+value<bool> none(simd_mask<N> const& mask) noexcept
+{
+    return !any(mask);
+}
+
+// A vector of N lanes of T, held in a SIMD register where the target has one
+// of the right size, and otherwise in an array. Lanes follow the same rules
+// as value<T>: conversions must not narrow, mixed operands must be of similar
+// types, bitwise operations are only defined for unsigned lanes, and there is
+// no integer promotion, so adding two simd<unsigned char> vectors yields a
+// simd<unsigned char> whose lanes wrap. Unlike value<T>, signed integer lanes
+// wrap too, as the vector instructions do.
+template<typename T, std::size_t N>
+class simd
+{
+    static_assert(detail::is_numeric<T>::value, "simd lanes must be of numeric type");
+    static_assert(N > 0, "simd must have at least one lane");
+
+private:
+    using impl = detail::simd_impl<T, N>;
+
+public:
+    using value_type = value<T>;
+    using native_type = typename impl::type;
+
+private:
+    native_type m_value;
+
+    template<typename U>
+    static native_type convert(simd<U, N> const& other) noexcept
+    {
+        return other.template convert_to<T>().m_value;
+    }
+
+    template<typename U>
+    simd<U, N> convert_to() const noexcept
+    {
+        T from[N];
+        store(from);
+
+        U to[N];
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            to[i] = static_cast<U>(from[i]);
+        }
+
+        return simd<U, N>::load(to);
+    }
+
+    template<typename, std::size_t>
+    friend class simd;
+
+public:
+    simd() noexcept :
+        m_value(impl::broadcast(T()))
+    {
+    }
+
+    simd(undefined_t) noexcept
+    {
+    }
+
+    explicit simd(native_type const& v) noexcept :
+        m_value(v)
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<U, T>::value>
+    >
+    simd(U const& v) noexcept :
+        m_value(impl::broadcast(v))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<U, T>::value>
+    >
+    simd(value<U> const& v) noexcept :
+        m_value(impl::broadcast(v.get()))
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<U, T>::value>
+    >
+    simd(simd<U, N> const& other) noexcept :
+        m_value(convert(other))
+    {
+    }
+
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsafely_convertible<T, U>::value>
+    >
+    explicit operator simd<U, N>() const noexcept
+    {
+        return convert_to<U>();
+    }
+
+    static simd load(T const* p) noexcept
+    {
+        return simd(impl::load(p));
+    }
+
+    static simd load(value<T> const* p) noexcept
+    {
+        return load(reinterpret_cast<T const*>(p));
+    }
+
+    void store(T* p) const noexcept
+    {
+        impl::store(m_value, p);
+    }
+
+    void store(value<T>* p) const noexcept
+    {
+        store(reinterpret_cast<T*>(p));
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    native_type native() const noexcept
+    {
+        return m_value;
+    }
+
+    value<T> operator[](std::size_t i) const noexcept
+    {
+        T lanes[N];
+        store(lanes);
+        return lanes[i];
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator+=(U const& rhs) noexcept
+    {
+        m_value = impl::add(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator-=(U const& rhs) noexcept
+    {
+        m_value = impl::sub(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator*=(U const& rhs) noexcept
+    {
+        m_value = impl::mul(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator/=(U const& rhs) noexcept
+    {
+        m_value = impl::div(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<T>::value &&
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator%=(U const& rhs) noexcept
+    {
+        m_value = impl::mod(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<T>::value &&
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator&=(U const& rhs) noexcept
+    {
+        m_value = impl::bit_and(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<T>::value &&
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator|=(U const& rhs) noexcept
+    {
+        m_value = impl::bit_or(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<T>::value &&
+        detail::is_safely_convertible<detail::simd_operand_t<U, N>, T>::value>
+    >
+    simd& operator^=(U const& rhs) noexcept
+    {
+        m_value = impl::bit_xor(m_value, simd(rhs).m_value);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<T>::value &&
+        std::is_integral<detail::simd_scalar_t<U>>::value>
+    >
+    simd& operator<<=(U const& rhs) noexcept
+    {
+        m_value = impl::shift_left(m_value, detail::shift_count<T>(detail::scalar_value(rhs)));
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<T>::value &&
+        std::is_integral<detail::simd_scalar_t<U>>::value>
+    >
+    simd& operator>>=(U const& rhs) noexcept
+    {
+        m_value = impl::shift_right(m_value, detail::shift_count<T>(detail::scalar_value(rhs)));
+        return *this;
+    }
+
+    simd operator+() const noexcept
+    {
+        return *this;
+    }
+
+    simd operator-() const noexcept
+    {
+        return simd(impl::neg(m_value));
+    }
+
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>>
+    simd operator~() const noexcept
+    {
+        return simd(impl::bit_not(m_value));
+    }
+};
+
+template<typename T, typename U, std::size_t N>
+simd<T, N> simd_cast(simd<U, N> const& v) noexcept
+{
+    return static_cast<simd<T, N>>(v);
+}
+
+// Binary operators are defined for two simd vectors, or a simd vector and a
+// scalar (either a value<U> or a U), whose lane types are similar. As with
+// value<T>, the result has the wider of the two lane types.
+#define NEO_DETAIL_SIMD_BINARY_OPERATOR(op, function, trait) \
+    template<typename T1, typename T2, std::size_t N, typename = detail::enable_if_t< \
+        detail::trait<T1, T2>::value> \
+    > \
+    simd<detail::wider_t<T1, T2>, N> operator op(simd<T1, N> const& lhs, simd<T2, N> const& rhs) noexcept \
+    { \
+        using result = simd<detail::wider_t<T1, T2>, N>; \
+        return result(detail::simd_impl<detail::wider_t<T1, T2>, N>::function( \
+                result(lhs).native(), result(rhs).native())); \
+    } \
+    \
+    template<typename T1, typename U, std::size_t N, typename = detail::enable_if_t< \
+        detail::trait<T1, detail::simd_scalar_t<U>>::value> \
+    > \
+    simd<detail::wider_t<T1, detail::simd_scalar_t<U>>, N> operator op(simd<T1, N> const& lhs, U const& rhs) noexcept \
+    { \
+        using result = simd<detail::wider_t<T1, detail::simd_scalar_t<U>>, N>; \
+        return result(detail::simd_impl<detail::wider_t<T1, detail::simd_scalar_t<U>>, N>::function( \
+                result(lhs).native(), result(rhs).native())); \
+    } \
+    \
+    template<typename U, typename T2, std::size_t N, typename = detail::enable_if_t< \
+        detail::trait<detail::simd_scalar_t<U>, T2>::value> \
+    > \
+    simd<detail::wider_t<detail::simd_scalar_t<U>, T2>, N> operator op(U const& lhs, simd<T2, N> const& rhs) noexcept \
+    { \
+        using result = simd<detail::wider_t<detail::simd_scalar_t<U>, T2>, N>; \
+        return result(detail::simd_impl<detail::wider_t<detail::simd_scalar_t<U>, T2>, N>::function( \
+                result(lhs).native(), result(rhs).native())); \
+    }
+
+NEO_DETAIL_SIMD_BINARY_OPERATOR(+, add, are_similar_numeric)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(-, sub, are_similar_numeric)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(*, mul, are_similar_numeric)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(/, div, are_similar_numeric)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(%, mod, are_similar_integral)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(&, bit_and, are_unsigned_integral)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(|, bit_or, are_unsigned_integral)
+NEO_DETAIL_SIMD_BINARY_OPERATOR(^, bit_xor, are_unsigned_integral)
+
+#undef NEO_DETAIL_SIMD_BINARY_OPERATOR
+
+#define NEO_DETAIL_SIMD_COMPARISON_OPERATOR(op, trait) \
+    template<typename T1, typename T2, std::size_t N, typename = detail::enable_if_t< \
+        detail::trait<T1, T2>::value> \
+    > \
+    simd_mask<N> operator op(simd<T1, N> const& lhs, simd<T2, N> const& rhs) noexcept \
+    { \
+        using lane = detail::wider_t<T1, T2>; \
+        bool lanes[N]; \
+        detail::simd_impl<lane, N>::compare(simd<lane, N>(lhs).native(), simd<lane, N>(rhs).native(), \
+                lanes, [](lane x, lane y) { return x op y; }); \
+        return simd_mask<N>(lanes); \
+    } \
+    \
+    template<typename T1, typename U, std::size_t N, typename = detail::enable_if_t< \
+        detail::trait<T1, detail::simd_scalar_t<U>>::value> \
+    > \
+    simd_mask<N> operator op(simd<T1, N> const& lhs, U const& rhs) noexcept \
+    { \
+        return lhs op simd<detail::simd_scalar_t<U>, N>(rhs); \
+    } \
+    \
+    template<typename U, typename T2, std::size_t N, typename = detail::enable_if_t< \
+        detail::trait<detail::simd_scalar_t<U>, T2>::value> \
+    > \
+    simd_mask<N> operator op(U const& lhs, simd<T2, N> const& rhs) noexcept \
+    { \
+        return simd<detail::simd_scalar_t<U>, N>(lhs) op rhs; \
+    }
+
+NEO_DETAIL_SIMD_COMPARISON_OPERATOR(==, are_similar_numeric)
+NEO_DETAIL_SIMD_COMPARISON_OPERATOR(!=, are_similar_numeric)
+NEO_DETAIL_SIMD_COMPARISON_OPERATOR(<, are_similar_numeric)
+NEO_DETAIL_SIMD_COMPARISON_OPERATOR(<=, are_similar_numeric)
+NEO_DETAIL_SIMD_COMPARISON_OPERATOR(>, are_similar_numeric)
+NEO_DETAIL_SIMD_COMPARISON_OPERATOR(>=, are_similar_numeric)
+
+#undef NEO_DETAIL_SIMD_COMPARISON_OPERATOR
+
+template<typename T1, typename U, std::size_t N, typename = detail::enable_if_t<
+    detail::is_unsigned_integral<T1>::value &&
+    std::is_integral<detail::simd_scalar_t<U>>::value>
+>
+simd<T1, N> operator<<(simd<T1, N> lhs, U const& rhs) noexcept
+{
+    return lhs <<= rhs;
+}
+
+template<typename T1, typename U, std::size_t N, typename = detail::enable_if_t<
+    detail::is_unsigned_integral<T1>::value &&
+    std::is_integral<detail::simd_scalar_t<U>>::value>
+>
+simd<T1, N> operator>>(simd<T1, N> lhs, U const& rhs) noexcept
+{
+    return lhs >>= rhs;
+}
+
+template<typename T1, typename T2, std::size_t N, typename = detail::enable_if_t<
+    detail::are_similar_numeric<T1, T2>::value>
+>
+simd<detail::wider_t<T1, T2>, N> min(simd<T1, N> const& a, simd<T2, N> const& b) noexcept
+{
+    using result = simd<detail::wider_t<T1, T2>, N>;
+    return result(detail::simd_impl<detail::wider_t<T1, T2>, N>::min(result(a).native(), result(b).native()));
+}
+
+template<typename T1, typename T2, std::size_t N, typename = detail::enable_if_t<
+    detail::are_similar_numeric<T1, T2>::value>
+>
+simd<detail::wider_t<T1, T2>, N> max(simd<T1, N> const& a, simd<T2, N> const& b) noexcept
+{
+    using result = simd<detail::wider_t<T1, T2>, N>;
+    return result(detail::simd_impl<detail::wider_t<T1, T2>, N>::max(result(a).native(), result(b).native()));
+}
+
+// Returns the sum of the lanes of `v`. As with the arithmetic operators of
+// simd, the sum wraps for integer lanes, signed or unsigned.
+template<typename T, std::size_t N>
+value<T> reduce_add(simd<T, N> const& v) noexcept
+{
+    return detail::simd_impl<T, N>::reduce_add(v.native());
+}
+
+// Returns a vector whose lanes are taken from `a` where `mask` is true, and
+// from `b` elsewhere.
+template<typename T, std::size_t N>
+simd<T, N> select(simd_mask<N> const& mask, simd<T, N> const& a, simd<T, N> const& b) noexcept
+{
+    T x[N];
+    T y[N];
+    a.store(x);
+    b.store(y);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        x[i] = bool(mask[i]) ? x[i] : y[i];
+    }
+
+    return simd<T, N>::load(x);
+}
+
+} // namespace neo
+
+#endif // NEO_SIMD_HPP
@@ -0,0 +1,136 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_SPAN_HPP
+#define NEO_SPAN_HPP
+
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace neo
+{
+
+namespace detail
+{
+
+template<typename From, typename To>
+struct is_array_convertible : std::is_convertible<From(*)[], To(*)[]>
+{
+};
+
+template<typename Container, typename T, typename = void>
+struct is_span_compatible : std::false_type
+{
+};
+
+template<typename Container, typename T>
+struct is_span_compatible<Container, T, void_t<
+    decltype(std::declval<Container&>().size())>
+> : is_array_convertible<
+        typename std::remove_pointer<decltype(std::declval<Container&>().data())>::type, T
+    >
+{
+};
+
+} // namespace detail
+
+// A non-owning view of a contiguous sequence of `T`. As with pointers,
+// `span<T const>` is a read-only view, and `span<T>` converts to it.
+template<typename T>
+class span
+{
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = element_type&;
+    using pointer = element_type*;
+    using iterator = pointer;
+
+private:
+    pointer m_data;
+    size_type m_size;
+
+public:
+    constexpr span() noexcept :
+        m_data(),
+        m_size()
+    {
+    }
+
+    constexpr span(pointer data, size_type size) noexcept :
+        m_data(data),
+        m_size(size)
+    {
+    }
+
+    template<std::size_t N>
+    constexpr span(element_type (&array)[N]) noexcept :
+        m_data(array),
+        m_size(N)
+    {
+    }
+
+    template<typename Container, typename = detail::enable_if_t<
+        detail::is_span_compatible<Container, T>::value>
+    >
+    constexpr span(Container& container) noexcept(noexcept(container.data())) :
+        m_data(container.data()),
+        m_size(container.size())
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_array_convertible<U, T>::value>
+    >
+    constexpr span(span<U> const& other) noexcept :
+        m_data(other.data()),
+        m_size(other.size())
+    {
+    }
+
+    constexpr pointer data() const noexcept
+    {
+        return m_data;
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    constexpr iterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+
+    constexpr reference operator[](size_type index) const noexcept
+    {
+        return m_data[index];
+    }
+
+    // Returns the `count` elements starting at `offset`.
+    constexpr span subspan(size_type offset, size_type count) const noexcept
+    {
+        return span(m_data + offset, count);
+    }
+};
+
+} // namespace neo
+
+#endif // NEO_SPAN_HPP
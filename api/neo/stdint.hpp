@@ -49,6 +49,62 @@ using uint_least64 = value<std::uint_least64_t>;
 using uintmax = value<std::uintmax_t>;
 using uintptr = value<std::uintptr_t>;
 
+// 128-bit integers, where the compiler provides them.
+#if defined(NEO_DETAIL_INT128)
+using int128 = value<detail::int128_t>;
+using uint128 = value<detail::uint128_t>;
+#endif
+
+// The aliases above, with the arithmetic policy `Policy`. A module can select
+// the arithmetic of all its integers with a single alias:
+//
+//     #if defined(NDEBUG)
+//     using ints = neo::integers<neo::policy::unchecked>;
+//     #else
+//     using ints = neo::integers<neo::policy::checked>;
+//     #endif
+//
+//     ints::int32 total = 0;
+template<typename Policy>
+struct integers
+{
+    using int8 = value<std::int8_t, Policy>;
+    using int16 = value<std::int16_t, Policy>;
+    using int32 = value<std::int32_t, Policy>;
+    using int64 = value<std::int64_t, Policy>;
+
+    using int_fast8 = value<std::int_fast8_t, Policy>;
+    using int_fast16 = value<std::int_fast16_t, Policy>;
+    using int_fast32 = value<std::int_fast32_t, Policy>;
+    using int_fast64 = value<std::int_fast64_t, Policy>;
+
+    using int_least8 = value<std::int_least8_t, Policy>;
+    using int_least16 = value<std::int_least16_t, Policy>;
+    using int_least32 = value<std::int_least32_t, Policy>;
+    using int_least64 = value<std::int_least64_t, Policy>;
+
+    using intmax = value<std::intmax_t, Policy>;
+    using intptr = value<std::intptr_t, Policy>;
+
+    using uint8 = value<std::uint8_t, Policy>;
+    using uint16 = value<std::uint16_t, Policy>;
+    using uint32 = value<std::uint32_t, Policy>;
+    using uint64 = value<std::uint64_t, Policy>;
+
+    using uint_fast8 = value<std::uint_fast8_t, Policy>;
+    using uint_fast16 = value<std::uint_fast16_t, Policy>;
+    using uint_fast32 = value<std::uint_fast32_t, Policy>;
+    using uint_fast64 = value<std::uint_fast64_t, Policy>;
+
+    using uint_least8 = value<std::uint_least8_t, Policy>;
+    using uint_least16 = value<std::uint_least16_t, Policy>;
+    using uint_least32 = value<std::uint_least32_t, Policy>;
+    using uint_least64 = value<std::uint_least64_t, Policy>;
+
+    using uintmax = value<std::uintmax_t, Policy>;
+    using uintptr = value<std::uintptr_t, Policy>;
+};
+
 } // namespace neo
 
 #endif // NEO_STDINT_HPP
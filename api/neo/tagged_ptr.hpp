@@ -0,0 +1,260 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_TAGGED_PTR_HPP
+#define NEO_TAGGED_PTR_HPP
+
+#include <neo/ptr.hpp>
+#include <neo/traits.hpp>
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/tagged_ptr.hpp>
+#include <neo/detail/type_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+
+namespace neo
+{
+
+// Tagged Pointers
+//-----------------
+//
+// A ptr<T> with `Bits` bits of tag stored in the same word: first in the low
+// bits, which are always zero because of the alignment of T, and then, on
+// x86-64, in the upper 16 bits, which are not part of the address. Like
+// ptr<T>, it is null by default, and the tag is zero. Bits of a tag beyond
+// `Bits` are ignored.
+template<typename T, std::size_t Bits>
+class tagged_ptr
+{
+public:
+    using element_type = T;
+    using pointer = element_type*;
+    using tag_type = value<std::uintptr_t>;
+
+    static constexpr std::size_t tag_bits = Bits;
+
+private:
+    using layout = detail::tagged_layout<T, Bits>;
+
+    std::uintptr_t m_value;
+
+    struct raw_tag
+    {
+    };
+
+    constexpr tagged_ptr(raw_tag, std::uintptr_t raw) noexcept :
+        m_value(raw)
+    {
+    }
+
+public:
+    constexpr tagged_ptr() noexcept :
+        tagged_ptr(nullptr)
+    {
+    }
+
+    constexpr tagged_ptr(std::nullptr_t) noexcept :
+        m_value()
+    {
+    }
+
+    tagged_ptr(undefined_t) noexcept
+    {
+    }
+
+    tagged_ptr(pointer value, tag_type const& tag = 0u) noexcept :
+        m_value(layout::pack(value, tag.get()))
+    {
+    }
+
+    tagged_ptr(ptr<T> const& value, tag_type const& tag = 0u) noexcept :
+        tagged_ptr(value.get(), tag)
+    {
+    }
+
+    // Assigning a pointer clears the tag, as if a tagged_ptr were constructed
+    // from it.
+    tagged_ptr& operator=(pointer value) noexcept
+    {
+        m_value = layout::pack(value, 0u);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_convertible<U*, T*>::value>
+    >
+    tagged_ptr(tagged_ptr<U, Bits> const& other) noexcept :
+        tagged_ptr(other.get(), other.tag())
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_convertible<U*, T*>::value>
+    >
+    tagged_ptr& operator=(tagged_ptr<U, Bits> const& other) noexcept
+    {
+        return *this = tagged_ptr(other);
+    }
+
+    operator pointer() const noexcept
+    {
+        return get();
+    }
+
+    operator ptr<T>() const noexcept
+    {
+        return get();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return get() != nullptr;
+    }
+
+    explicit operator value<bool>() const noexcept
+    {
+        return static_cast<bool>(*this);
+    }
+
+    element_type& operator*() const noexcept
+    {
+        return *get();
+    }
+
+    pointer operator->() const noexcept
+    {
+        return get();
+    }
+
+    pointer get() const noexcept
+    {
+        return layout::pointer(m_value);
+    }
+
+    tag_type tag() const noexcept
+    {
+        return layout::tag(m_value);
+    }
+
+    void set_pointer(pointer value) noexcept
+    {
+        m_value = layout::pack(value, layout::tag(m_value));
+    }
+
+    void set_tag(tag_type const& tag) noexcept
+    {
+        m_value = layout::pack(get(), tag.get());
+    }
+
+    // The representation, in which the pointer and tag are packed.
+    constexpr std::uintptr_t raw() const noexcept
+    {
+        return m_value;
+    }
+
+    static constexpr tagged_ptr from_raw(std::uintptr_t raw) noexcept
+    {
+        return tagged_ptr(raw_tag(), raw);
+    }
+};
+
+template<typename T, std::size_t Bits>
+constexpr std::size_t tagged_ptr<T, Bits>::tag_bits;
+
+// The null pointer with a zero tag is represented by all-zero bits.
+template<typename T, std::size_t Bits>
+struct is_zero_initialized_by_default<tagged_ptr<T, Bits>> : std::true_type
+{
+};
+
+// Tagged pointers are equal if their pointers and tags are equal, and are
+// ordered by pointer, then by tag.
+template<typename T1, typename T2, std::size_t Bits, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator==(tagged_ptr<T1, Bits> const& lhs, tagged_ptr<T2, Bits> const& rhs) noexcept
+{
+    return lhs.get() == rhs.get() && lhs.tag().get() == rhs.tag().get();
+}
+
+template<typename T1, typename T2, std::size_t Bits, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator!=(tagged_ptr<T1, Bits> const& lhs, tagged_ptr<T2, Bits> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template<typename T1, typename T2, std::size_t Bits, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator<(tagged_ptr<T1, Bits> const& lhs, tagged_ptr<T2, Bits> const& rhs) noexcept
+{
+    using common = detail::common_type_t<T1*, T2*>;
+
+    return std::less<common>()(lhs.get(), rhs.get()) ||
+        (!std::less<common>()(rhs.get(), lhs.get()) && lhs.tag().get() < rhs.tag().get());
+}
+
+template<typename T1, typename T2, std::size_t Bits, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator<=(tagged_ptr<T1, Bits> const& lhs, tagged_ptr<T2, Bits> const& rhs) noexcept
+{
+    return !(rhs < lhs);
+}
+
+template<typename T1, typename T2, std::size_t Bits, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator>(tagged_ptr<T1, Bits> const& lhs, tagged_ptr<T2, Bits> const& rhs) noexcept
+{
+    return rhs < lhs;
+}
+
+template<typename T1, typename T2, std::size_t Bits, typename =
+    detail::common_type_t<T1*, T2*>
+>
+value<bool> operator>=(tagged_ptr<T1, Bits> const& lhs, tagged_ptr<T2, Bits> const& rhs) noexcept
+{
+    return !(lhs < rhs);
+}
+
+template<typename T, std::size_t Bits>
+std::ostream& operator<<(std::ostream& s, tagged_ptr<T, Bits> const& v)
+{
+    s << v.get();
+    return s;
+}
+
+template<std::size_t Bits, typename T>
+tagged_ptr<T, Bits> make_tagged_ptr(T* object, value<std::uintptr_t> const& tag = 0u) noexcept
+{
+    return tagged_ptr<T, Bits>(object, tag);
+}
+
+} // namespace neo
+
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+
+namespace std
+{
+
+template<typename T, std::size_t Bits>
+struct __is_bitwise_relocatable<neo::tagged_ptr<T, Bits>> :
+    neo::is_trivially_relocatable<neo::tagged_ptr<T, Bits>>
+{
+};
+
+} // namespace std
+
+#endif
+
+#endif // NEO_TAGGED_PTR_HPP
@@ -0,0 +1,50 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_TRAITS_HPP
+#define NEO_TRAITS_HPP
+
+#include <type_traits>
+
+// libstdc++ relocates the elements of a reallocating std::vector with a single
+// memmove only if std::__is_bitwise_relocatable holds, which by default
+// requires a trivial type. Neo types are not trivial, so they specialize it.
+#if defined(_GLIBCXX_RELEASE) && _GLIBCXX_RELEASE >= 9
+#define NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+#include <memory>
+#endif
+
+namespace neo
+{
+
+// True if default construction of T is equivalent to filling its storage with
+// zero bytes, such that memory which is already zero (e.g. fresh pages from
+// the operating system) holds default-constructed objects without running any
+// constructor.
+template<typename T>
+struct is_zero_initialized_by_default : std::false_type
+{
+};
+
+// True if copying a T is equivalent to copying its bytes, so that ranges of T
+// can be copied and filled with memcpy and memset. Neo types are trivially
+// copyable, so this holds for them without specialization; it may be
+// specialized for other types with the same property.
+template<typename T>
+struct is_bitwise_copyable : std::is_trivially_copyable<T>
+{
+};
+
+// True if moving a T to new storage and destroying the original is equivalent
+// to copying its bytes, so that ranges of T can be relocated with memcpy or
+// realloc. Every bitwise copyable type is trivially relocatable.
+template<typename T>
+struct is_trivially_relocatable : is_bitwise_copyable<T>
+{
+};
+
+} // namespace neo
+
+#endif // NEO_TRAITS_HPP
@@ -6,8 +6,10 @@
 #ifndef NEO_VALUE_HPP
 #define NEO_VALUE_HPP
 
+#include <neo/traits.hpp>
 #include <neo/undefined.hpp>
 
+#include <neo/detail/int128.hpp>
 #include <neo/detail/type_traits.hpp>
 
 #include <cstddef>
@@ -32,15 +34,15 @@ struct is_same : std::integral_constant<bool,
 
 template<typename T>
 struct is_numeric : std::integral_constant<bool,
-        std::is_arithmetic<T>::value & !is_same<T, bool>::value
+        is_arithmetic<T>::value & !is_same<T, bool>::value
     >
 {
 };
 
 template<typename T>
 struct is_unsigned_integral: std::integral_constant<bool,
-        std::is_integral<T>::value &&
-        std::is_unsigned<T>::value &&
+        is_integral<T>::value &&
+        is_unsigned<T>::value &&
         !is_same<T, bool>::value
     >
 {
@@ -48,8 +50,8 @@ struct is_unsigned_integral: std::integral_constant<bool,
 
 template<typename T1, typename T2>
 struct is_bounded : std::integral_constant<bool,
-        std::numeric_limits<T1>::lowest() >= std::numeric_limits<T2>::lowest() &&
-        std::numeric_limits<T1>::max() <= std::numeric_limits<T2>::max()
+        numeric_limits<T1>::lowest() >= numeric_limits<T2>::lowest() &&
+        numeric_limits<T1>::max() <= numeric_limits<T2>::max()
     >
 {
 };
@@ -71,9 +73,9 @@ struct are_unsigned_integral: std::integral_constant<bool,
 template<typename T1, typename T2>
 struct are_similar: std::integral_constant<bool,
         is_numeric<T1>::value == is_numeric<T2>::value &&
-        std::is_integral<T1>::value == std::is_integral<T2>::value &&
+        is_integral<T1>::value == is_integral<T2>::value &&
         std::is_floating_point<T1>::value == std::is_floating_point<T2>::value &&
-        std::is_signed<T1>::value == std::is_signed<T2>::value
+        is_signed<T1>::value == is_signed<T2>::value
     >
 {
 };
@@ -134,7 +136,146 @@ using wider_t = typename wider<T1, T2>::type;
 
 } // namespace detail
 
-template<typename T>
+namespace policy
+{
+
+// Arithmetic policies define the arithmetic operators of value<T, Policy>. A
+// policy has static member functions add, sub, mul, div and mod, taking two
+// operands of the same type, and neg, taking one, and an is_nothrow constant
+// which gives the exception specification of the operators. The operators
+// convert both operands to the result type before calling the policy.
+//
+// The arithmetic of the fundamental types. Integer overflow and division by
+// zero have the same behaviour as with the fundamental types, and values
+// compile to the same code as the fundamental types.
+struct unchecked
+{
+    static constexpr bool is_nothrow = true;
+
+    template<typename T>
+    static constexpr T add(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(lhs + rhs);
+    }
+
+    template<typename T>
+    static constexpr T sub(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(lhs - rhs);
+    }
+
+    template<typename T>
+    static constexpr T mul(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(lhs * rhs);
+    }
+
+    template<typename T>
+    static constexpr T div(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(lhs / rhs);
+    }
+
+    template<typename T>
+    static constexpr T mod(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(lhs % rhs);
+    }
+
+    template<typename T>
+    static constexpr T neg(T x) noexcept
+    {
+        return static_cast<T>(-x);
+    }
+};
+
+} // namespace policy
+
+namespace detail
+{
+
+// A policy whose integer arithmetic is given by the static member functions of
+// Integral, and whose floating-point arithmetic is that of the fundamental
+// types. Both overload sets are declared here, rather than split across a base
+// and a derived class, so that neither hides the other.
+template<typename Integral>
+struct float_passthrough
+{
+    static constexpr bool is_nothrow = Integral::is_nothrow;
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T add(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        return Integral::add(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T sub(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        return Integral::sub(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T mul(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        return Integral::mul(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T div(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        return Integral::div(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T mod(T lhs, T rhs) noexcept(is_nothrow)
+    {
+        return Integral::mod(lhs, rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T neg(T x) noexcept(is_nothrow)
+    {
+        return Integral::neg(x);
+    }
+
+    template<typename T, typename = enable_if_t<std::is_floating_point<T>::value>, typename = void>
+    static constexpr T add(T lhs, T rhs) noexcept
+    {
+        return lhs + rhs;
+    }
+
+    template<typename T, typename = enable_if_t<std::is_floating_point<T>::value>, typename = void>
+    static constexpr T sub(T lhs, T rhs) noexcept
+    {
+        return lhs - rhs;
+    }
+
+    template<typename T, typename = enable_if_t<std::is_floating_point<T>::value>, typename = void>
+    static constexpr T mul(T lhs, T rhs) noexcept
+    {
+        return lhs * rhs;
+    }
+
+    template<typename T, typename = enable_if_t<std::is_floating_point<T>::value>, typename = void>
+    static constexpr T div(T lhs, T rhs) noexcept
+    {
+        return lhs / rhs;
+    }
+
+    template<typename T, typename = enable_if_t<std::is_floating_point<T>::value>, typename = void>
+    static constexpr T neg(T x) noexcept
+    {
+        return -x;
+    }
+};
+
+} // namespace detail
+
+// A value of fundamental type `T`. `Policy` defines the behaviour of the
+// arithmetic operators; values with different policies cannot be mixed in
+// expressions.
+template<typename T, typename Policy = policy::unchecked>
 class value
 {
 private:
@@ -153,7 +294,16 @@ public:
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    constexpr value(value<U> const& other) noexcept :
+    constexpr value(value<U, Policy> const& other) noexcept :
+        m_value(other.get())
+    {
+    }
+
+    template<typename U, typename P, typename = detail::enable_if_t<
+        detail::is_safely_convertible<U, T>::value &&
+        !std::is_same<P, Policy>::value>
+    >
+    constexpr explicit value(value<U, P> const& other) noexcept :
         m_value(other.get())
     {
     }
@@ -161,7 +311,7 @@ public:
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator=(value<U> const& other) noexcept
+    value& operator=(value<U, Policy> const& other) noexcept
     {
         m_value = other.get();
         return *this;
@@ -204,7 +354,7 @@ public:
     template<typename U, typename = detail::enable_if_t<
         detail::is_unsafely_convertible<T, U>::value>
     >
-    constexpr explicit operator value<U>() const noexcept
+    constexpr explicit operator value<U, Policy>() const noexcept
     {
         return static_cast<U>(m_value);
     }
@@ -217,142 +367,146 @@ public:
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator+=(value<U> const& rhs) noexcept
+    value& operator+=(value<U, Policy> const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value += rhs.get();
+        m_value = Policy::add(m_value, static_cast<T>(rhs.get()));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator+=(U const& rhs) noexcept
+    value& operator+=(U const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value += rhs;
+        m_value = Policy::add(m_value, static_cast<T>(rhs));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator-=(value<U> const& rhs) noexcept
+    value& operator-=(value<U, Policy> const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value -= rhs.get();
+        m_value = Policy::sub(m_value, static_cast<T>(rhs.get()));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator-=(U const& rhs) noexcept
+    value& operator-=(U const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value -= rhs;
+        m_value = Policy::sub(m_value, static_cast<T>(rhs));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator*=(value<U> const& rhs) noexcept
+    value& operator*=(value<U, Policy> const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value *= rhs.get();
+        m_value = Policy::mul(m_value, static_cast<T>(rhs.get()));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator*=(U const& rhs) noexcept
+    value& operator*=(U const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value *= rhs;
+        m_value = Policy::mul(m_value, static_cast<T>(rhs));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator/=(value<U> const& rhs) noexcept
+    value& operator/=(value<U, Policy> const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value /= rhs.get();
+        m_value = Policy::div(m_value, static_cast<T>(rhs.get()));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator/=(U const& rhs) noexcept
+    value& operator/=(U const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value /= rhs;
+        m_value = Policy::div(m_value, static_cast<T>(rhs));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator%=(value<U> const& rhs) noexcept
+    value& operator%=(value<U, Policy> const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value %= rhs.get();
+        m_value = Policy::mod(m_value, static_cast<T>(rhs.get()));
         return *this;
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator%=(U const& rhs) noexcept
+    value& operator%=(U const& rhs) noexcept(Policy::is_nothrow)
     {
-        m_value %= rhs;
+        m_value = Policy::mod(m_value, static_cast<T>(rhs));
         return *this;
     }
 
-    template<typename = detail::enable_if_t<
-        std::is_integral<T>::value>
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_integral<U>::value>
     >
-    value& operator++() noexcept
+    value& operator++() noexcept(Policy::is_nothrow)
     {
-        ++m_value;
+        m_value = Policy::add(m_value, static_cast<T>(1));
         return *this;
     }
 
-    template<typename = detail::enable_if_t<
-        std::is_integral<T>::value>
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_integral<U>::value>
     >
-    value operator++(int) noexcept
+    value operator++(int) noexcept(Policy::is_nothrow)
     {
-        return m_value++;
+        value const old = *this;
+        m_value = Policy::add(m_value, static_cast<T>(1));
+        return old;
     }
 
-    template<typename = detail::enable_if_t<
-        std::is_integral<T>::value>
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_integral<U>::value>
     >
-    value& operator--() noexcept
+    value& operator--() noexcept(Policy::is_nothrow)
     {
-        --m_value;
+        m_value = Policy::sub(m_value, static_cast<T>(1));
         return *this;
     }
 
-    template<typename = detail::enable_if_t<
-        std::is_integral<T>::value>
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_integral<U>::value>
     >
-    value operator--(int) noexcept
+    value operator--(int) noexcept(Policy::is_nothrow)
     {
-        return m_value--;
+        value const old = *this;
+        m_value = Policy::sub(m_value, static_cast<T>(1));
+        return old;
     }
 
-    constexpr value<T> operator+() const noexcept
+    constexpr value operator+() const noexcept
     {
         return m_value;
     }
 
-    constexpr value<T> operator-() const noexcept
+    constexpr value operator-() const noexcept(Policy::is_nothrow)
     {
-        return -m_value;
+        return Policy::neg(m_value);
     }
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_unsigned_integral<T>::value &&
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator&=(value<U> const& rhs) noexcept
+    value& operator&=(value<U, Policy> const& rhs) noexcept
     {
         m_value &= rhs.get();
         return *this;
@@ -372,7 +526,7 @@ public:
         detail::is_unsigned_integral<T>::value &&
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator|=(value<U> const& rhs) noexcept
+    value& operator|=(value<U, Policy> const& rhs) noexcept
     {
         m_value |= rhs.get();
         return *this;
@@ -392,7 +546,7 @@ public:
         detail::is_unsigned_integral<T>::value &&
         detail::is_safely_convertible<U, T>::value>
     >
-    value& operator^=(value<U> const& rhs) noexcept
+    value& operator^=(value<U, Policy> const& rhs) noexcept
     {
         m_value ^= rhs.get();
         return *this;
@@ -410,9 +564,9 @@ public:
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_unsigned_integral<T>::value &&
-        std::is_integral<U>::value>
+        detail::is_integral<U>::value>
     >
-    value& operator<<=(value<U> const& rhs) noexcept
+    value& operator<<=(value<U, Policy> const& rhs) noexcept
     {
         m_value <<= rhs.get();
         return *this;
@@ -420,7 +574,7 @@ public:
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_unsigned_integral<T>::value &&
-        std::is_integral<U>::value>
+        detail::is_integral<U>::value>
     >
     value& operator<<=(U const& rhs) noexcept
     {
@@ -430,9 +584,9 @@ public:
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_unsigned_integral<T>::value &&
-        std::is_integral<U>::value>
+        detail::is_integral<U>::value>
     >
-    value& operator>>=(value<U> const& rhs) noexcept
+    value& operator>>=(value<U, Policy> const& rhs) noexcept
     {
         m_value >>= rhs.get();
         return *this;
@@ -440,7 +594,7 @@ public:
 
     template<typename U, typename = detail::enable_if_t<
         detail::is_unsigned_integral<T>::value &&
-        std::is_integral<U>::value>
+        detail::is_integral<U>::value>
     >
     value& operator>>=(U const& rhs) noexcept
     {
@@ -448,16 +602,16 @@ public:
         return *this;
     }
 
-    template<typename = detail::enable_if_t<
-        detail::is_unsigned_integral<T>::value>>
+    template<typename U = T, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>>
     constexpr value operator~() const noexcept
     {
-        return ~m_value;
+        return static_cast<T>(~m_value);
     }
 };
 
-template<>
-class value<bool>
+template<typename Policy>
+class value<bool, Policy>
 {
 private:
     bool m_value;
@@ -485,7 +639,7 @@ public:
         return m_value;
     }
 
-    constexpr value<bool> operator!() const noexcept
+    constexpr value operator!() const noexcept
     {
         return !m_value;
     }
@@ -496,405 +650,413 @@ public:
     }
 };
 
-template<>
-class value<void>
+template<typename Policy>
+class value<void, Policy>
+{
+};
+
+template<typename T, typename Policy>
+struct is_zero_initialized_by_default<value<T, Policy>> : std::integral_constant<bool,
+        detail::is_integral<T>::value ||
+        (std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559)
+    >
 {
 };
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar<T1, T2>::value>
 >
-constexpr value<bool> operator==(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator==(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs.get() == rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar<T1, T2>::value>
 >
-constexpr value<bool> operator!=(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator!=(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs.get() != rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator<(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator<(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs.get() < rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator<=(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator<=(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs.get() <= rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator>(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator>(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs.get() > rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator>=(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator>=(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs.get() >= rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator+(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator+(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return detail::wider_t<T1, T2>(lhs.get() + rhs.get());
+    return Policy::add(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator-(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator-(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return detail::wider_t<T1, T2>(lhs.get() - rhs.get());
+    return Policy::sub(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator*(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator*(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return detail::wider_t<T1, T2>(lhs.get() * rhs.get());
+    return Policy::mul(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator/(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator/(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return detail::wider_t<T1, T2>(lhs.get() / rhs.get());
+    return Policy::div(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator%(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator%(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return detail::wider_t<T1, T2>(lhs.get() % rhs.get());
+    return Policy::mod(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator&(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator&(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return detail::wider_t<T1, T2>(lhs.get() & rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator|(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator|(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return detail::wider_t<T1, T2>(lhs.get() | rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator^(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator^(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return detail::wider_t<T1, T2>(lhs.get() ^ rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::is_unsigned_integral<T1>::value &&
-    std::is_integral<T2>::value>
+    detail::is_integral<T2>::value>
 >
-constexpr value<T1> operator<<(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<T1, Policy> operator<<(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return detail::wider_t<T1, T2>(lhs.get() << rhs.get());
+    return T1(lhs.get() << rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::is_unsigned_integral<T1>::value &&
-    std::is_integral<T2>::value>
+    detail::is_integral<T2>::value>
 >
-constexpr value<T1> operator>>(value<T1> const& lhs, value<T2> const& rhs) noexcept
+constexpr value<T1, Policy> operator>>(value<T1, Policy> const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return lhs.get() >> rhs.get();
+    return T1(lhs.get() >> rhs.get());
 }
 
 // value<T1> - T2
 //------------
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar<T1, T2>::value>
 >
-constexpr value<bool> operator==(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<bool> operator==(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
     return lhs.get() == rhs;
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar<T1, T2>::value>
 >
-constexpr value<bool> operator!=(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<bool> operator!=(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
     return lhs.get() != rhs;
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator<(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<bool> operator<(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
     return lhs.get() < rhs;
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator<=(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<bool> operator<=(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
     return lhs.get() <= rhs;
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator>(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<bool> operator>(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
     return lhs.get() > rhs;
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator>=(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<bool> operator>=(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
     return lhs.get() >= rhs;
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator+(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator+(value<T1, Policy> const& lhs, T2 const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs.get() + rhs;
+    return Policy::add(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator-(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator-(value<T1, Policy> const& lhs, T2 const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs.get() - rhs;
+    return Policy::sub(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator*(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator*(value<T1, Policy> const& lhs, T2 const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs.get() * rhs;
+    return Policy::mul(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator/(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator/(value<T1, Policy> const& lhs, T2 const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs.get() / rhs;
+    return Policy::div(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator%(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator%(value<T1, Policy> const& lhs, T2 const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs.get() % rhs;
+    return Policy::mod(detail::wider_t<T1, T2>(lhs.get()), detail::wider_t<T1, T2>(rhs));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator&(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator&(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
-    return lhs.get() & rhs;
+    return detail::wider_t<T1, T2>(lhs.get() & rhs);
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator|(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator|(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
-    return lhs.get() | rhs;
+    return detail::wider_t<T1, T2>(lhs.get() | rhs);
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator^(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator^(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
-    return lhs.get() ^ rhs;
+    return detail::wider_t<T1, T2>(lhs.get() ^ rhs);
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::is_unsigned_integral<T1>::value &&
-    std::is_integral<T2>::value>
+    detail::is_integral<T2>::value>
 >
-constexpr value<T1> operator<<(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<T1, Policy> operator<<(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
-    return lhs.get() << rhs;
+    return T1(lhs.get() << rhs);
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::is_unsigned_integral<T1>::value &&
-    std::is_integral<T2>::value>
+    detail::is_integral<T2>::value>
 >
-constexpr value<T1> operator>>(value<T1> const& lhs, T2 const& rhs) noexcept
+constexpr value<T1, Policy> operator>>(value<T1, Policy> const& lhs, T2 const& rhs) noexcept
 {
-    return lhs.get() >> rhs;
+    return T1(lhs.get() >> rhs);
 }
 
 // T1 - value<T2>
 //------------
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar<T1, T2>::value>
 >
-constexpr value<bool> operator==(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator==(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs == rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar<T1, T2>::value>
 >
-constexpr value<bool> operator!=(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator!=(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs != rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator<(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator<(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs < rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator<=(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator<=(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs <= rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator>(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator>(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs > rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<bool> operator>=(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<bool> operator>=(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
     return lhs >= rhs.get();
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator+(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator+(T1 const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs + rhs.get();
+    return Policy::add(detail::wider_t<T1, T2>(lhs), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator-(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator-(T1 const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs - rhs.get();
+    return Policy::sub(detail::wider_t<T1, T2>(lhs), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator*(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator*(T1 const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs * rhs.get();
+    return Policy::mul(detail::wider_t<T1, T2>(lhs), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator/(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator/(T1 const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs / rhs.get();
+    return Policy::div(detail::wider_t<T1, T2>(lhs), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_similar_numeric<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator%(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator%(T1 const& lhs, value<T2, Policy> const& rhs) noexcept(Policy::is_nothrow)
 {
-    return lhs % rhs.get();
+    return Policy::mod(detail::wider_t<T1, T2>(lhs), detail::wider_t<T1, T2>(rhs.get()));
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator&(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator&(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return lhs & rhs.get();
+    return detail::wider_t<T1, T2>(lhs & rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator|(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator|(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return lhs | rhs.get();
+    return detail::wider_t<T1, T2>(lhs | rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::are_unsigned_integral<T1, T2>::value>
 >
-constexpr value<detail::wider_t<T1, T2>> operator^(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<detail::wider_t<T1, T2>, Policy> operator^(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return lhs ^ rhs.get();
+    return detail::wider_t<T1, T2>(lhs ^ rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::is_unsigned_integral<T1>::value &&
-    std::is_integral<T2>::value>
+    detail::is_integral<T2>::value>
 >
-constexpr value<T1> operator<<(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<T1, Policy> operator<<(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return lhs << rhs.get();
+    return T1(lhs << rhs.get());
 }
 
-template<typename T1, typename T2, typename = detail::enable_if_t<
+template<typename T1, typename T2, typename Policy, typename = detail::enable_if_t<
     detail::is_unsigned_integral<T1>::value &&
-    std::is_integral<T2>::value>
+    detail::is_integral<T2>::value>
 >
-constexpr value<T1> operator>>(T1 const& lhs, value<T2> const& rhs) noexcept
+constexpr value<T1, Policy> operator>>(T1 const& lhs, value<T2, Policy> const& rhs) noexcept
 {
-    return lhs >> rhs.get();
+    return T1(lhs >> rhs.get());
 }
 
 // Deleted value<bool> boolean operations
@@ -923,15 +1085,15 @@ constexpr bool operator||(T const& lhs, value<bool> const& rhs) = delete;
 // IOStream
 //----------
 
-template<typename T>
-std::ostream& operator<<(std::ostream& s, value<T> const& v)
+template<typename T, typename Policy>
+std::ostream& operator<<(std::ostream& s, value<T, Policy> const& v)
 {
     s << v.get();
     return s;
 }
 
-template<typename T>
-std::istream& operator>>(std::istream& s, value<T>& v)
+template<typename T, typename Policy>
+std::istream& operator>>(std::istream& s, value<T, Policy>& v)
 {
     s >> v.get();
     return s;
@@ -994,7 +1156,7 @@ struct integral_literal_builder
     template<typename T, unsigned long long Value>
     static constexpr value<T> build() noexcept
     {
-        static_assert(Value <= std::numeric_limits<T>::max(),
+        static_assert(Value <= neo::detail::numeric_limits<T>::max(),
                 "literal exceeds max value");
         return static_cast<T>(Value);
     }
@@ -1003,11 +1165,34 @@ struct integral_literal_builder
 template<typename T, char... Digits>
 constexpr value<T> build_integral_literal() noexcept
 {
-    static_assert(sizeof...(Digits) <= std::numeric_limits<T>::digits10 + 1,
+    static_assert(sizeof...(Digits) <= neo::detail::numeric_limits<T>::digits10 + 1,
             "literal exceeds max value");
     return integral_literal_builder::build<T, 0, Digits...>();
 }
 
+#if defined(NEO_DETAIL_INT128)
+// 128-bit literals are accumulated in 128 bits, and checked for overflow
+// before each digit is added.
+struct wide_integral_literal_builder
+{
+    template<typename T, neo::detail::uint128_t Value, char Digit, char... Digits>
+    static constexpr value<T> build() noexcept
+    {
+        static_assert(Digit >= '0' && Digit <= '9',
+                "literal may contain only numeric characters");
+        static_assert(Value <= static_cast<neo::detail::uint128_t>(neo::detail::numeric_limits<T>::max() - (Digit - '0')) / 10,
+                "literal exceeds max value");
+        return build<T, 10 * Value + static_cast<unsigned>(Digit - '0'), Digits...>();
+    }
+
+    template<typename T, neo::detail::uint128_t Value>
+    static constexpr value<T> build() noexcept
+    {
+        return static_cast<T>(Value);
+    }
+};
+#endif
+
 } // namespace detail
 
 static const value<bool> true_ = true;
@@ -1073,6 +1258,20 @@ constexpr value<unsigned long long> operator"" _null() noexcept
     return detail::build_integral_literal<unsigned long long, Digits...>();
 }
 
+#if defined(NEO_DETAIL_INT128)
+template<char... Digits>
+constexpr value<neo::detail::int128_t> operator"" _ni128() noexcept
+{
+    return detail::wide_integral_literal_builder::build<neo::detail::int128_t, 0, Digits...>();
+}
+
+template<char... Digits>
+constexpr value<neo::detail::uint128_t> operator"" _nui128() noexcept
+{
+    return detail::wide_integral_literal_builder::build<neo::detail::uint128_t, 0, Digits...>();
+}
+#endif
+
 constexpr inline value<float> operator"" _nf(long double value) noexcept
 {
     return static_cast<float>(value);
@@ -1130,4 +1329,19 @@ constexpr inline value<char32_t> operator"" _n(char32_t value) noexcept
 
 } // namespace neo
 
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+
+namespace std
+{
+
+template<typename T, typename Policy>
+struct __is_bitwise_relocatable<neo::value<T, Policy>> :
+    neo::is_trivially_relocatable<neo::value<T, Policy>>
+{
+};
+
+} // namespace std
+
+#endif
+
 #endif // NEO_VALUE_HPP
@@ -0,0 +1,466 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_VECTOR_HPP
+#define NEO_VECTOR_HPP
+
+#include <neo/memory.hpp>
+#include <neo/traits.hpp>
+#include <neo/undefined.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace neo
+{
+
+// A dynamically sized array. Storage for trivially relocatable types is grown
+// with realloc, so reallocation never runs a constructor, and large buffers
+// can often be extended in place or remapped rather than copied.
+template<typename T>
+class vector
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+            "over-aligned types are not supported");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+    using pointer = value_type*;
+    using const_pointer = value_type const*;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+
+private:
+    pointer m_data;
+    size_type m_size;
+    size_type m_capacity;
+
+    static pointer allocate(size_type count)
+    {
+        if (count > max_size())
+        {
+            throw std::bad_alloc();
+        }
+
+        void* p = count != 0 ? std::malloc(count * sizeof(T)) : nullptr;
+
+        if (!p && count != 0)
+        {
+            throw std::bad_alloc();
+        }
+
+        return static_cast<pointer>(p);
+    }
+
+    void reallocate(size_type capacity, std::true_type)
+    {
+        if (capacity == 0)
+        {
+            std::free(m_data);
+            m_data = nullptr;
+        }
+        else
+        {
+            if (capacity > max_size())
+            {
+                throw std::bad_alloc();
+            }
+
+            void* p = std::realloc(m_data, capacity * sizeof(T));
+
+            if (!p)
+            {
+                throw std::bad_alloc();
+            }
+
+            m_data = static_cast<pointer>(p);
+        }
+
+        m_capacity = capacity;
+    }
+
+    void relocate(pointer data, std::true_type) noexcept
+    {
+        neo::uninitialized_relocate_n(m_data, m_size, data);
+    }
+
+    // Copies elements which may throw on move, so that the existing elements
+    // are left intact if construction fails.
+    void relocate(pointer data, std::false_type)
+    {
+        pointer source = m_data;
+        detail::construct_n(data, m_size, [&](pointer p) {
+            ::new (static_cast<void*>(p)) T(std::move_if_noexcept(*source++));
+        });
+
+        detail::destroy_n(m_data, m_size);
+    }
+
+    void reallocate(size_type capacity, std::false_type)
+    {
+        pointer data = allocate(capacity);
+
+        try
+        {
+            relocate(data, std::is_nothrow_move_constructible<T>());
+        }
+        catch (...)
+        {
+            std::free(data);
+            throw;
+        }
+
+        std::free(m_data);
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    // Changes the capacity to `capacity`, which must be at least size().
+    void reallocate(size_type capacity)
+    {
+        reallocate(capacity, is_trivially_relocatable<T>());
+    }
+
+    size_type grown_capacity(size_type count) const
+    {
+        if (count > max_size())
+        {
+            throw std::bad_alloc();
+        }
+
+        return std::max(count, m_capacity <= max_size() / 2 ? m_capacity * 2 : max_size());
+    }
+
+    // Runs `construct` on storage for `count` elements, releasing the storage
+    // if it throws.
+    template<typename Construct>
+    void initialize(size_type count, Construct construct)
+    {
+        m_data = allocate(count);
+
+        try
+        {
+            construct(m_data);
+        }
+        catch (...)
+        {
+            std::free(m_data);
+            throw;
+        }
+
+        m_size = count;
+        m_capacity = count;
+    }
+
+    // Runs `construct` on storage for the elements appended by resize(count).
+    template<typename Construct>
+    void grow(size_type count, Construct construct)
+    {
+        if (count > m_capacity)
+        {
+            reallocate(grown_capacity(count));
+        }
+
+        construct(m_data + m_size, count - m_size);
+        m_size = count;
+    }
+
+public:
+    vector() noexcept :
+        m_data(),
+        m_size(),
+        m_capacity()
+    {
+    }
+
+    explicit vector(size_type count) :
+        vector()
+    {
+        initialize(count, [&](pointer p) { neo::uninitialized_value_construct_n(p, count); });
+    }
+
+    vector(size_type count, undefined_t) :
+        vector()
+    {
+        initialize(count, [&](pointer p) {
+            detail::construct_n(p, count, [](pointer q) { detail::construct_undefined(q); });
+        });
+    }
+
+    vector(size_type count, value_type const& value) :
+        vector()
+    {
+        initialize(count, [&](pointer p) { neo::uninitialized_fill_n(p, count, value); });
+    }
+
+    vector(std::initializer_list<value_type> values) :
+        vector()
+    {
+        initialize(values.size(), [&](pointer p) { neo::uninitialized_copy_n(values.begin(), values.size(), p); });
+    }
+
+    vector(vector const& other) :
+        vector()
+    {
+        initialize(other.m_size, [&](pointer p) { neo::uninitialized_copy_n(other.data(), other.m_size, p); });
+    }
+
+    vector(vector&& other) noexcept :
+        m_data(other.m_data),
+        m_size(other.m_size),
+        m_capacity(other.m_capacity)
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+
+    vector& operator=(vector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~vector()
+    {
+        detail::destroy_n(m_data, m_size);
+        std::free(m_data);
+    }
+
+    void swap(vector& other) noexcept
+    {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+    }
+
+    static constexpr size_type max_size() noexcept
+    {
+        return static_cast<size_type>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(T);
+    }
+
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    void reserve(size_type capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            reallocate(capacity);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (m_capacity != m_size)
+        {
+            reallocate(m_size);
+        }
+    }
+
+    void resize(size_type count)
+    {
+        if (count < m_size)
+        {
+            erase(begin() + count, end());
+        }
+        else
+        {
+            grow(count, [](pointer p, size_type n) { neo::uninitialized_value_construct_n(p, n); });
+        }
+    }
+
+    void resize(size_type count, undefined_t)
+    {
+        if (count < m_size)
+        {
+            erase(begin() + count, end());
+        }
+        else
+        {
+            grow(count, [](pointer p, size_type n) {
+                detail::construct_n(p, n, [](pointer q) { detail::construct_undefined(q); });
+            });
+        }
+    }
+
+    void resize(size_type count, value_type const& value)
+    {
+        if (count < m_size)
+        {
+            erase(begin() + count, end());
+        }
+        else
+        {
+            // `value` may be an element, so it is copied before reallocation
+            value_type const copy = value;
+            grow(count, [&](pointer p, size_type n) { neo::uninitialized_fill_n(p, n, copy); });
+        }
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+        {
+            // The arguments may refer to elements, so the new element is
+            // constructed before reallocation
+            value_type element(std::forward<Args>(args)...);
+            reallocate(grown_capacity(m_size + 1));
+            ::new (static_cast<void*>(m_data + m_size)) T(std::move(element));
+        }
+        else
+        {
+            ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+        }
+
+        return m_data[m_size++];
+    }
+
+    void push_back(value_type const& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back() noexcept
+    {
+        m_data[--m_size].~T();
+    }
+
+    iterator erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        pointer const begin = m_data + (first - m_data);
+        pointer const end = m_data + (last - m_data);
+        size_type const count = static_cast<size_type>(last - first);
+
+        if (count == 0)
+        {
+            return begin;
+        }
+
+        if (is_trivially_relocatable<T>::value)
+        {
+            detail::destroy_n(begin, count);
+            std::memmove(static_cast<void*>(begin), static_cast<void const*>(end),
+                    static_cast<size_type>(m_data + m_size - end) * sizeof(T));
+        }
+        else
+        {
+            std::move(end, m_data + m_size, begin);
+            detail::destroy_n(m_data + m_size - count, count);
+        }
+
+        m_size -= count;
+        return begin;
+    }
+
+    void clear() noexcept
+    {
+        detail::destroy_n(m_data, m_size);
+        m_size = 0;
+    }
+
+    pointer data() noexcept
+    {
+        return m_data;
+    }
+
+    const_pointer data() const noexcept
+    {
+        return m_data;
+    }
+
+    reference operator[](size_type i) noexcept
+    {
+        return m_data[i];
+    }
+
+    const_reference operator[](size_type i) const noexcept
+    {
+        return m_data[i];
+    }
+
+    reference front() noexcept
+    {
+        return m_data[0];
+    }
+
+    const_reference front() const noexcept
+    {
+        return m_data[0];
+    }
+
+    reference back() noexcept
+    {
+        return m_data[m_size - 1];
+    }
+
+    const_reference back() const noexcept
+    {
+        return m_data[m_size - 1];
+    }
+
+    iterator begin() noexcept
+    {
+        return m_data;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    iterator end() noexcept
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+};
+
+template<typename T>
+void swap(vector<T>& lhs, vector<T>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+} // namespace neo
+
+#endif // NEO_VECTOR_HPP
@@ -0,0 +1,586 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_WIDE_UINT_HPP
+#define NEO_WIDE_UINT_HPP
+
+#include <neo/undefined.hpp>
+#include <neo/value.hpp>
+
+#include <neo/detail/int128.hpp>
+#include <neo/detail/type_traits.hpp>
+#include <neo/detail/wide_uint.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+namespace neo
+{
+
+template<std::size_t Bits>
+class wide_uint;
+
+namespace detail
+{
+
+template<typename T>
+struct is_wide_uint : std::false_type
+{
+};
+
+template<std::size_t Bits>
+struct is_wide_uint<wide_uint<Bits>> : std::true_type
+{
+};
+
+// The width of an operand of the wide integer operators, or zero for types
+// which cannot be mixed with them. Signed integers must be converted
+// explicitly.
+template<typename T, typename = void>
+struct wide_operand_bits : std::integral_constant<std::size_t, 0>
+{
+};
+
+template<std::size_t Bits>
+struct wide_operand_bits<wide_uint<Bits>> : std::integral_constant<std::size_t, Bits>
+{
+};
+
+template<typename T>
+struct wide_operand_bits<T, enable_if_t<is_unsigned_integral<T>::value>> :
+    std::integral_constant<std::size_t, numeric_limits<T>::digits>
+{
+};
+
+template<typename T, typename Policy>
+struct wide_operand_bits<value<T, Policy>> : wide_operand_bits<T>
+{
+};
+
+template<typename T1, typename T2>
+struct are_wide_operands : std::integral_constant<bool,
+        (is_wide_uint<T1>::value || is_wide_uint<T2>::value) &&
+        wide_operand_bits<T1>::value != 0 &&
+        wide_operand_bits<T2>::value != 0
+    >
+{
+};
+
+template<typename T1, typename T2>
+using wide_result_t = wide_uint<(wide_operand_bits<T1>::value > wide_operand_bits<T2>::value ?
+        wide_operand_bits<T1>::value : wide_operand_bits<T2>::value)>;
+
+template<typename T>
+constexpr T const& raw_operand(T const& x) noexcept
+{
+    return x;
+}
+
+template<typename T, typename Policy>
+constexpr T raw_operand(value<T, Policy> const& x) noexcept
+{
+    return x.get();
+}
+
+// Negative counts, converted to unsigned, are at least `Bits`.
+template<std::size_t Bits, typename U>
+constexpr std::size_t wide_shift_count(U count) noexcept
+{
+    return static_cast<std::uint64_t>(count) < Bits ? static_cast<std::size_t>(count) : Bits;
+}
+
+} // namespace detail
+
+// Wide Unsigned Integers
+//------------------------
+//
+// An unsigned integer of `Bits` bits, stored as 64-bit limbs, for big counters
+// and accumulators. Arithmetic wraps modulo 2^Bits. Unsigned integers and
+// narrower wide integers convert implicitly, so `uint64` widens to `uint256`
+// as it would to `uint128`, and mixed expressions have the type of the wider
+// operand. Signed integers and narrowing conversions must be explicit, and
+// follow the rules of the built-in conversions.
+template<std::size_t Bits>
+class wide_uint
+{
+    static_assert(Bits % 64 == 0 && Bits >= 128,
+            "wide_uint must be a multiple of 64 bits, and at least 128 bits");
+
+    template<std::size_t B>
+    friend class wide_uint;
+
+public:
+    static constexpr std::size_t limb_count = Bits / 64;
+
+private:
+    std::uint64_t m_limbs[limb_count];
+
+    template<std::size_t B>
+    constexpr void assign_limbs(wide_uint<B> const& other) noexcept
+    {
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            m_limbs[i] = i < wide_uint<B>::limb_count ? other.m_limbs[i] : 0u;
+        }
+    }
+
+public:
+    constexpr wide_uint() noexcept :
+        m_limbs()
+    {
+    }
+
+    wide_uint(undefined_t) noexcept
+    {
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    constexpr wide_uint(U const& x) noexcept :
+        m_limbs{detail::limb_of(x, 0), detail::limb_of(x, 1)}
+    {
+    }
+
+    // Negative integers are sign extended, so they convert modulo 2^Bits.
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && detail::is_signed<U>::value>,
+        typename = void
+    >
+    constexpr explicit wide_uint(U const& x) noexcept :
+        m_limbs()
+    {
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            m_limbs[i] = detail::limb_of(x, i);
+        }
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_unsigned_integral<U>::value>
+    >
+    constexpr wide_uint(value<U, Policy> const& x) noexcept :
+        wide_uint(x.get())
+    {
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && detail::is_signed<U>::value>,
+        typename = void
+    >
+    constexpr explicit wide_uint(value<U, Policy> const& x) noexcept :
+        wide_uint(x.get())
+    {
+    }
+
+    template<std::size_t B, typename = detail::enable_if_t<
+        (B < Bits)>
+    >
+    constexpr wide_uint(wide_uint<B> const& other) noexcept :
+        m_limbs()
+    {
+        assign_limbs(other);
+    }
+
+    // Narrowing discards the high limbs.
+    template<std::size_t B, typename = detail::enable_if_t<
+        (B > Bits)>,
+        typename = void
+    >
+    constexpr explicit wide_uint(wide_uint<B> const& other) noexcept :
+        m_limbs()
+    {
+        assign_limbs(other);
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && !detail::is_same<U, bool>::value>
+    >
+    constexpr explicit operator U() const noexcept
+    {
+        return static_cast<U>(sizeof(U) > 8 ?
+                (static_cast<U>(m_limbs[1]) << (sizeof(U) > 8 ? 64 : 0)) | m_limbs[0] :
+                static_cast<U>(m_limbs[0]));
+    }
+
+    template<typename U, typename Policy, typename = detail::enable_if_t<
+        detail::is_integral<U>::value && !detail::is_same<U, bool>::value>
+    >
+    constexpr explicit operator value<U, Policy>() const noexcept
+    {
+        return static_cast<U>(*this);
+    }
+
+    // The `i`th 64-bit limb, counting from the least significant.
+    constexpr value<std::uint64_t> limb(std::size_t i) const noexcept
+    {
+        return m_limbs[i];
+    }
+
+    constexpr std::uint64_t const* limbs() const noexcept
+    {
+        return m_limbs;
+    }
+
+    constexpr std::uint64_t* limbs() noexcept
+    {
+        return m_limbs;
+    }
+
+    constexpr wide_uint operator+() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr wide_uint operator-() const noexcept
+    {
+        wide_uint result = ~*this;
+        std::uint64_t carry = 1;
+
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            result.m_limbs[i] += carry;
+            carry = result.m_limbs[i] < carry ? 1u : 0u;
+        }
+
+        return result;
+    }
+
+    constexpr wide_uint operator~() const noexcept
+    {
+        wide_uint result;
+
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            result.m_limbs[i] = ~m_limbs[i];
+        }
+
+        return result;
+    }
+
+    wide_uint& operator++() noexcept
+    {
+        return *this += 1u;
+    }
+
+    wide_uint operator++(int) noexcept
+    {
+        wide_uint const old = *this;
+        ++*this;
+        return old;
+    }
+
+    wide_uint& operator--() noexcept
+    {
+        return *this -= 1u;
+    }
+
+    wide_uint operator--(int) noexcept
+    {
+        wide_uint const old = *this;
+        --*this;
+        return old;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::wide_operand_bits<U>::value != 0 &&
+        detail::wide_operand_bits<U>::value <= Bits>
+    >
+    wide_uint& operator+=(U const& rhs) noexcept
+    {
+        wide_uint const r = detail::raw_operand(rhs);
+        detail::limbs_add<limb_count>(m_limbs, m_limbs, r.m_limbs);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::wide_operand_bits<U>::value != 0 &&
+        detail::wide_operand_bits<U>::value <= Bits>
+    >
+    wide_uint& operator-=(U const& rhs) noexcept
+    {
+        wide_uint const r = detail::raw_operand(rhs);
+        detail::limbs_sub<limb_count>(m_limbs, m_limbs, r.m_limbs);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::wide_operand_bits<U>::value != 0 &&
+        detail::wide_operand_bits<U>::value <= Bits>
+    >
+    wide_uint& operator*=(U const& rhs) noexcept
+    {
+        wide_uint const l = *this;
+        wide_uint const r = detail::raw_operand(rhs);
+        detail::limbs_mul<limb_count, limb_count>(m_limbs, l.m_limbs, r.m_limbs);
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::wide_operand_bits<U>::value != 0 &&
+        detail::wide_operand_bits<U>::value <= Bits>
+    >
+    constexpr wide_uint& operator&=(U const& rhs) noexcept
+    {
+        wide_uint const r = detail::raw_operand(rhs);
+
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            m_limbs[i] &= r.m_limbs[i];
+        }
+
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::wide_operand_bits<U>::value != 0 &&
+        detail::wide_operand_bits<U>::value <= Bits>
+    >
+    constexpr wide_uint& operator|=(U const& rhs) noexcept
+    {
+        wide_uint const r = detail::raw_operand(rhs);
+
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            m_limbs[i] |= r.m_limbs[i];
+        }
+
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        detail::wide_operand_bits<U>::value != 0 &&
+        detail::wide_operand_bits<U>::value <= Bits>
+    >
+    constexpr wide_uint& operator^=(U const& rhs) noexcept
+    {
+        wide_uint const r = detail::raw_operand(rhs);
+
+        for (std::size_t i = 0; i < limb_count; ++i)
+        {
+            m_limbs[i] ^= r.m_limbs[i];
+        }
+
+        return *this;
+    }
+
+    // Shifts by `Bits` or more give zero.
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value>
+    >
+    constexpr wide_uint& operator<<=(U const& count) noexcept
+    {
+        wide_uint const l = *this;
+        detail::limbs_shl<limb_count>(m_limbs, l.m_limbs, detail::wide_shift_count<Bits>(count));
+        return *this;
+    }
+
+    template<typename U, typename = detail::enable_if_t<
+        std::is_integral<U>::value>
+    >
+    constexpr wide_uint& operator>>=(U const& count) noexcept
+    {
+        wide_uint const l = *this;
+        detail::limbs_shr<limb_count>(m_limbs, l.m_limbs, detail::wide_shift_count<Bits>(count));
+        return *this;
+    }
+};
+
+template<std::size_t Bits>
+constexpr std::size_t wide_uint<Bits>::limb_count;
+
+using uint256 = wide_uint<256>;
+using uint512 = wide_uint<512>;
+
+// Returns the full product of `x` and `y`, which is twice as wide.
+template<std::size_t Bits>
+wide_uint<Bits * 2> full_product(wide_uint<Bits> const& x, wide_uint<Bits> const& y) noexcept
+{
+    wide_uint<Bits * 2> result(undefined);
+    detail::limbs_mul<Bits / 64, Bits / 32>(result.limbs(), x.limbs(), y.limbs());
+    return result;
+}
+
+// wide_uint - wide_uint
+//-----------------------
+//
+// Either operand may also be an unsigned integer or value.
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>,
+    typename = void
+>
+constexpr value<bool> operator==(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+    return detail::limbs_compare<result::limb_count>(result(detail::raw_operand(lhs)).limbs(), result(detail::raw_operand(rhs)).limbs()) == 0;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>,
+    typename = void
+>
+constexpr value<bool> operator!=(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+    return detail::limbs_compare<result::limb_count>(result(detail::raw_operand(lhs)).limbs(), result(detail::raw_operand(rhs)).limbs()) != 0;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>,
+    typename = void
+>
+constexpr value<bool> operator<(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+    return detail::limbs_compare<result::limb_count>(result(detail::raw_operand(lhs)).limbs(), result(detail::raw_operand(rhs)).limbs()) < 0;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>,
+    typename = void
+>
+constexpr value<bool> operator<=(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+    return detail::limbs_compare<result::limb_count>(result(detail::raw_operand(lhs)).limbs(), result(detail::raw_operand(rhs)).limbs()) <= 0;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>,
+    typename = void
+>
+constexpr value<bool> operator>(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+    return detail::limbs_compare<result::limb_count>(result(detail::raw_operand(lhs)).limbs(), result(detail::raw_operand(rhs)).limbs()) > 0;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>,
+    typename = void
+>
+constexpr value<bool> operator>=(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+    return detail::limbs_compare<result::limb_count>(result(detail::raw_operand(lhs)).limbs(), result(detail::raw_operand(rhs)).limbs()) >= 0;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>
+>
+detail::wide_result_t<T1, T2> operator+(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+
+    result const l = detail::raw_operand(lhs);
+    result const r = detail::raw_operand(rhs);
+    result sum(undefined);
+
+    detail::limbs_add<result::limb_count>(sum.limbs(), l.limbs(), r.limbs());
+    return sum;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>
+>
+detail::wide_result_t<T1, T2> operator-(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+
+    result const l = detail::raw_operand(lhs);
+    result const r = detail::raw_operand(rhs);
+    result difference(undefined);
+
+    detail::limbs_sub<result::limb_count>(difference.limbs(), l.limbs(), r.limbs());
+    return difference;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>
+>
+detail::wide_result_t<T1, T2> operator*(T1 const& lhs, T2 const& rhs) noexcept
+{
+    using result = detail::wide_result_t<T1, T2>;
+
+    result const l = detail::raw_operand(lhs);
+    result const r = detail::raw_operand(rhs);
+    result product(undefined);
+
+    detail::limbs_mul<result::limb_count, result::limb_count>(product.limbs(), l.limbs(), r.limbs());
+    return product;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>
+>
+constexpr detail::wide_result_t<T1, T2> operator&(T1 const& lhs, T2 const& rhs) noexcept
+{
+    detail::wide_result_t<T1, T2> result = detail::raw_operand(lhs);
+    return result &= rhs;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>
+>
+constexpr detail::wide_result_t<T1, T2> operator|(T1 const& lhs, T2 const& rhs) noexcept
+{
+    detail::wide_result_t<T1, T2> result = detail::raw_operand(lhs);
+    return result |= rhs;
+}
+
+template<typename T1, typename T2, typename = detail::enable_if_t<
+    detail::are_wide_operands<T1, T2>::value>
+>
+constexpr detail::wide_result_t<T1, T2> operator^(T1 const& lhs, T2 const& rhs) noexcept
+{
+    detail::wide_result_t<T1, T2> result = detail::raw_operand(lhs);
+    return result ^= rhs;
+}
+
+template<std::size_t Bits, typename U, typename = detail::enable_if_t<
+    std::is_integral<U>::value>
+>
+constexpr wide_uint<Bits> operator<<(wide_uint<Bits> lhs, U const& count) noexcept
+{
+    return lhs <<= count;
+}
+
+template<std::size_t Bits, typename U, typename = detail::enable_if_t<
+    std::is_integral<U>::value>
+>
+constexpr wide_uint<Bits> operator>>(wide_uint<Bits> lhs, U const& count) noexcept
+{
+    return lhs >>= count;
+}
+
+// IOStream
+//----------
+
+template<std::size_t Bits>
+std::ostream& operator<<(std::ostream& s, wide_uint<Bits> const& x)
+{
+    // Each digit takes at least 3 bits.
+    char digits[Bits / 3 + 2];
+    char* p = digits + sizeof(digits);
+    wide_uint<Bits> rest = x;
+
+    *--p = '\0';
+
+    do
+    {
+        *--p = static_cast<char>('0' + detail::limbs_divmod_small<wide_uint<Bits>::limb_count>(rest.limbs(), 10));
+    }
+    while (rest != 0u);
+
+    s << p;
+    return s;
+}
+
+} // namespace neo
+
+#endif // NEO_WIDE_UINT_HPP
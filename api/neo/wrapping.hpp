@@ -0,0 +1,113 @@
+/*
+ * Neo Types Library
+ * Copyright 2016 Joseph Thomson
+ */
+
+#ifndef NEO_WRAPPING_HPP
+#define NEO_WRAPPING_HPP
+
+#include <neo/value.hpp>
+
+#include <neo/detail/type_traits.hpp>
+
+#include <type_traits>
+
+namespace neo
+{
+
+namespace detail
+{
+
+// The unsigned type in which wrapping arithmetic on T is done. It is at least
+// as wide as unsigned int, so that operands are not promoted to int, where
+// multiplication could overflow.
+template<typename T>
+using wrapping_unsigned_t = common_type_t<make_unsigned_t<T>, unsigned>;
+
+template<typename T>
+constexpr wrapping_unsigned_t<T> to_wrapping_unsigned(T x) noexcept
+{
+    return static_cast<wrapping_unsigned_t<T>>(x);
+}
+
+// Integer arithmetic which wraps around modulo 2^N, for signed types as well
+// as unsigned types. Signed operations are done in the corresponding unsigned
+// type and converted back, which wraps on two's complement targets. As with
+// the fundamental types, division by zero is undefined.
+struct wrapping_integral
+{
+    static constexpr bool is_nothrow = true;
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T add(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(to_wrapping_unsigned(lhs) + to_wrapping_unsigned(rhs));
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T sub(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(to_wrapping_unsigned(lhs) - to_wrapping_unsigned(rhs));
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T mul(T lhs, T rhs) noexcept
+    {
+        return static_cast<T>(to_wrapping_unsigned(lhs) * to_wrapping_unsigned(rhs));
+    }
+
+    // The minimum value divided by -1 wraps to the minimum value.
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T div(T lhs, T rhs) noexcept
+    {
+        return is_signed<T>::value && rhs == static_cast<T>(-1) ?
+            neg(lhs) :
+            static_cast<T>(lhs / rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T mod(T lhs, T rhs) noexcept
+    {
+        return is_signed<T>::value && rhs == static_cast<T>(-1) ?
+            static_cast<T>(0) :
+            static_cast<T>(lhs % rhs);
+    }
+
+    template<typename T, typename = enable_if_t<is_integral<T>::value>>
+    static constexpr T neg(T x) noexcept
+    {
+        return static_cast<T>(0u - to_wrapping_unsigned(x));
+    }
+};
+
+} // namespace detail
+
+namespace policy
+{
+
+// Wrapping integer arithmetic. Floating-point arithmetic is unchanged.
+struct wrapping : detail::float_passthrough<detail::wrapping_integral>
+{
+};
+
+} // namespace policy
+
+// Wrapping Arithmetic
+//---------------------
+//
+// A value whose +, - and * wrap around on overflow, even for signed types, so
+// that hashes and checksums can be computed in signed arithmetic without
+// undefined behaviour. As with value<T>, operands are not promoted, so
+// `wrapping<std::int8_t>` arithmetic wraps at 8 bits.
+template<typename T>
+using wrapping = value<T, policy::wrapping>;
+
+template<typename T>
+constexpr wrapping<T> make_wrapping(T const& v) noexcept
+{
+    return wrapping<T>(v);
+}
+
+} // namespace neo
+
+#endif // NEO_WRAPPING_HPP
@@ -0,0 +1,170 @@
+#include <neo/algorithm.hpp>
+#include <neo/stdint.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 4096;
+constexpr std::size_t padding = 24;
+
+// Raw and Neo copies of two operand arrays and an output array, padded by
+// different amounts, as in bench_value.cpp, to avoid 4K aliasing.
+template<typename T, typename U, typename R>
+struct operands
+{
+    std::vector<T> a;
+    std::vector<U> b;
+    std::vector<R> out;
+
+    std::vector<neo::value<T>> na;
+    std::vector<neo::value<U>> nb;
+    std::vector<neo::value<R>> nout;
+
+    operands() :
+        a(element_count + 1 * padding), b(element_count + 2 * padding), out(element_count + 3 * padding),
+        na(element_count + 4 * padding), nb(element_count + 5 * padding), nout(element_count + 6 * padding)
+    {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            a[i] = static_cast<T>(1 + i % 13);
+            b[i] = static_cast<U>(1 + i % 7);
+            na[i] = neo::value<T>(a[i]);
+            nb[i] = neo::value<U>(b[i]);
+        }
+    }
+
+    neo::span<neo::value<T> const> span_a() const
+    {
+        return neo::span<neo::value<T> const>(na.data(), element_count);
+    }
+
+    neo::span<neo::value<U> const> span_b() const
+    {
+        return neo::span<neo::value<U> const>(nb.data(), element_count);
+    }
+
+    neo::span<neo::value<R>> span_out()
+    {
+        return neo::span<neo::value<R>>(nout.data(), element_count);
+    }
+};
+
+template<typename T, typename U, typename R>
+void transforms(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    operands<T, U, R> d;
+
+    T const* a = d.a.data();
+    U const* b = d.b.data();
+    R* out = d.out.data();
+    auto const na = d.span_a();
+    auto const nb = d.span_b();
+    auto const nout = d.span_out();
+
+    ctx.compare("transform_add " + alias, element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<R>(a[i] + b[i]);
+        }
+    }, [=] {
+        neo::transform_add(na, nb, nout);
+    });
+
+    ctx.compare("transform_mul " + alias, element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<R>(a[i] * b[i]);
+        }
+    }, [=] {
+        neo::transform_mul(na, nb, nout);
+    });
+
+    ctx.compare("transform_min " + alias, element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            R const x = a[i];
+            R const y = b[i];
+            out[i] = x < y ? x : y;
+        }
+    }, [=] {
+        neo::transform_min(na, nb, nout);
+    });
+}
+
+template<typename T>
+void reductions(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    operands<T, T, T> d;
+
+    T const* a = d.a.data();
+    T const* b = d.b.data();
+    auto const na = d.span_a();
+    auto const nb = d.span_b();
+
+    ctx.compare("sum " + alias, element_count, [=] {
+        T sum = T();
+
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            sum = static_cast<T>(sum + a[i]);
+        }
+
+        neo_types::benchmark::do_not_optimize(sum);
+    }, [=] {
+        neo_types::benchmark::do_not_optimize(neo::sum(na));
+    });
+
+    ctx.compare("dot " + alias, element_count, [=] {
+        T sum = T();
+
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            sum = static_cast<T>(sum + a[i] * b[i]);
+        }
+
+        neo_types::benchmark::do_not_optimize(sum);
+    }, [=] {
+        neo_types::benchmark::do_not_optimize(neo::dot(na, nb));
+    });
+
+    // The ranges are equal, so every element is compared.
+    std::vector<T> const copy(d.a);
+    std::vector<neo::value<T>> const ncopy(d.na);
+
+    T const* c = copy.data();
+    neo::span<neo::value<T> const> const nc(ncopy.data(), element_count);
+
+    ctx.compare("compare " + alias, element_count, [=] {
+        std::size_t i = 0;
+
+        while (i < element_count && !(a[i] < c[i]) && !(c[i] < a[i]))
+        {
+            ++i;
+        }
+
+        neo_types::benchmark::do_not_optimize(i);
+    }, [=] {
+        neo_types::benchmark::do_not_optimize(neo::compare(na, nc));
+    });
+}
+
+} // namespace
+
+BENCHMARK_CASE("algorithm.hpp span kernels")
+{
+    transforms<std::int32_t, std::int32_t, std::int32_t>(ctx, "int32 int32");
+    transforms<std::int16_t, std::int32_t, std::int32_t>(ctx, "int16 int32");
+    transforms<std::uint8_t, std::uint8_t, std::uint8_t>(ctx, "uint8 uint8");
+    transforms<float, float, float>(ctx, "float float");
+    transforms<float, double, double>(ctx, "float double");
+
+    reductions<std::int32_t>(ctx, "int32");
+    reductions<float>(ctx, "float");
+    reductions<double>(ctx, "double");
+}
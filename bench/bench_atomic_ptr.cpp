@@ -0,0 +1,251 @@
+#include <neo/atomic_ptr.hpp>
+#include <neo/ptr.hpp>
+#include <neo/stdint.hpp>
+#include <benchmark.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Without CMPXCHG16B (-mcx16 with GCC and Clang), atomic_versioned_ptr is a
+// std::atomic of two words, so this file must be linked with -latomic.
+
+namespace
+{
+
+struct raw_node
+{
+    std::atomic<raw_node*> next;
+    neo::uint32 value;
+};
+
+struct node
+{
+    neo::atomic_ptr<node> next;
+    neo::uint32 value;
+};
+
+// Treiber stacks linked by std::atomic and neo::atomic_ptr. They are only
+// correct on one thread, where a node cannot be popped and pushed again
+// between the load of the top and the compare-exchange.
+struct raw_stack
+{
+    std::atomic<raw_node*> top{nullptr};
+
+    void push(raw_node* n) noexcept
+    {
+        raw_node* expected = top.load(std::memory_order_relaxed);
+        do
+        {
+            n->next.store(expected, std::memory_order_relaxed);
+        }
+        while (!top.compare_exchange_weak(expected, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    raw_node* pop() noexcept
+    {
+        raw_node* expected = top.load(std::memory_order_acquire);
+        while (expected &&
+            !top.compare_exchange_weak(expected, expected->next.load(std::memory_order_relaxed),
+                std::memory_order_acquire, std::memory_order_acquire))
+        {
+        }
+        return expected;
+    }
+};
+
+struct stack
+{
+    neo::atomic_ptr<node> top;
+
+    void push(node* n) noexcept
+    {
+        neo::ptr<node> expected = top.load(std::memory_order_relaxed);
+        do
+        {
+            n->next.store(expected, std::memory_order_relaxed);
+        }
+        while (!top.compare_exchange_weak(expected, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    node* pop() noexcept
+    {
+        neo::ptr<node> expected = top.load(std::memory_order_acquire);
+        while (expected &&
+            !top.compare_exchange_weak(expected, expected->next.load(std::memory_order_relaxed),
+                std::memory_order_acquire, std::memory_order_acquire))
+        {
+        }
+        return expected;
+    }
+};
+
+// Stacks which are safe on any number of threads: one guarded by a lock, and
+// one whose top is versioned.
+struct locked_stack
+{
+    std::mutex mutex;
+    node* top = nullptr;
+
+    void push(node* n)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        n->next.store(top, std::memory_order_relaxed);
+        top = n;
+    }
+
+    node* pop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        node* n = top;
+        if (n)
+        {
+            top = n->next.load(std::memory_order_relaxed);
+        }
+        return n;
+    }
+};
+
+struct versioned_stack
+{
+    neo::atomic_versioned_ptr<node> top;
+
+    void push(node* n) noexcept
+    {
+        auto expected = top.load(std::memory_order_relaxed);
+        do
+        {
+            n->next.store(expected.pointer, std::memory_order_relaxed);
+        }
+        while (!top.compare_exchange_weak(expected, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    node* pop() noexcept
+    {
+        auto expected = top.load(std::memory_order_acquire);
+        while (expected.pointer &&
+            !top.compare_exchange_weak(expected, expected.pointer->next.load(std::memory_order_relaxed),
+                std::memory_order_acquire, std::memory_order_acquire))
+        {
+        }
+        return expected.pointer;
+    }
+};
+
+std::size_t const pool_size = 256;
+std::size_t const operations = 4096;
+
+// Pops a node and pushes it back, as a freelist does on each allocation.
+template<typename Stack>
+std::uint32_t churn(Stack& s, std::size_t count)
+{
+    std::uint32_t sum = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto n = s.pop();
+        if (n)
+        {
+            sum += n->value.get();
+            s.push(n);
+        }
+    }
+
+    return sum;
+}
+
+template<typename Stack, typename Node>
+void fill(Stack& s, std::vector<Node>& nodes)
+{
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        nodes[i].value = static_cast<std::uint32_t>(i);
+        s.push(&nodes[i]);
+    }
+}
+
+// Every thread churns the same stack, so its top is contended.
+template<typename Stack>
+void churn_concurrently(Stack& s, std::size_t thread_count)
+{
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 1; t < thread_count; ++t)
+    {
+        threads.emplace_back([&s] {
+            neo_types::benchmark::do_not_optimize(churn(s, operations));
+        });
+    }
+
+    neo_types::benchmark::do_not_optimize(churn(s, operations));
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void single_thread_loops(neo_types::benchmark::context& ctx)
+{
+    std::string const name = "atomic_ptr push/pop (1 thread)";
+
+    if (!ctx.enabled(name))
+    {
+        return;
+    }
+
+    std::vector<raw_node> raw_nodes(pool_size);
+    std::vector<node> nodes(pool_size);
+    raw_stack raw;
+    stack s;
+    fill(raw, raw_nodes);
+    fill(s, nodes);
+
+    ctx.compare(name, operations, [&] {
+        neo_types::benchmark::do_not_optimize(churn(raw, operations));
+    }, [&] {
+        neo_types::benchmark::do_not_optimize(churn(s, operations));
+    });
+}
+
+void contended_loops(neo_types::benchmark::context& ctx, std::size_t thread_count)
+{
+    std::string const name = "atomic_versioned_ptr stack (" + std::to_string(thread_count) +
+        (thread_count == 1 ? " thread)" : " threads)");
+
+    if (!ctx.enabled(name))
+    {
+        return;
+    }
+
+    std::vector<node> locked_nodes(pool_size);
+    std::vector<node> versioned_nodes(pool_size);
+    locked_stack locked;
+    versioned_stack versioned;
+    fill(locked, locked_nodes);
+    fill(versioned, versioned_nodes);
+
+    ctx.compare(name, operations * thread_count, [&] {
+        churn_concurrently(locked, thread_count);
+    }, [&] {
+        churn_concurrently(versioned, thread_count);
+    });
+}
+
+} // namespace
+
+// The first row compares a Treiber stack linked by std::atomic (the baseline)
+// with one linked by neo::atomic_ptr, which should cost nothing. The others
+// compare a stack guarded by std::mutex with a lock-free stack whose top is a
+// neo::atomic_versioned_ptr, on a number of threads. Each call starts the
+// threads, so on few cores the times include their creation.
+BENCHMARK_CASE("atomic_ptr.hpp Treiber stack")
+{
+    single_thread_loops(ctx);
+    contended_loops(ctx, 1);
+    contended_loops(ctx, 2);
+    contended_loops(ctx, 4);
+}
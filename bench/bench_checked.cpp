@@ -0,0 +1,123 @@
+#include <neo/checked.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 1024;
+constexpr std::size_t padding = 24;
+
+// Unchecked and checked copies of two operand arrays and an output array,
+// padded by different amounts, as in bench_value.cpp, to avoid 4K aliasing.
+template<typename T>
+struct operands
+{
+    std::vector<neo::value<T>> a;
+    std::vector<neo::value<T>> b;
+    std::vector<neo::value<T>> out;
+
+    std::vector<neo::checked<T>> ca;
+    std::vector<neo::checked<T>> cb;
+    std::vector<neo::checked<T>> cr;
+
+    // Operands are small and `a[i] > b[i]`, so nothing overflows and the checked
+    // loops measure the cost of the checks rather than of throwing.
+    operands() :
+        a(element_count + 1 * padding), b(element_count + 2 * padding), out(element_count + 3 * padding),
+        ca(element_count + 4 * padding), cb(element_count + 5 * padding), cr(element_count + 6 * padding)
+    {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            a[i] = static_cast<T>(8 + i % 13);
+            b[i] = static_cast<T>(1 + i % 7);
+            ca[i] = neo::checked<T>(a[i]);
+            cb[i] = neo::checked<T>(b[i]);
+        }
+    }
+};
+
+template<typename T>
+void checked_operators(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    operands<T> d;
+
+    neo::value<T> const* a = d.a.data();
+    neo::value<T> const* b = d.b.data();
+    neo::value<T>* out = d.out.data();
+    neo::checked<T> const* ca = d.ca.data();
+    neo::checked<T> const* cb = d.cb.data();
+    neo::checked<T>* cr = d.cr.data();
+
+    ctx.compare(alias + " checked + checked", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = a[i] + b[i];
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            cr[i] = ca[i] + cb[i];
+        }
+    });
+
+    ctx.compare(alias + " checked - checked", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = a[i] - b[i];
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            cr[i] = ca[i] - cb[i];
+        }
+    });
+
+    ctx.compare(alias + " checked * checked", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = a[i] * b[i];
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            cr[i] = ca[i] * cb[i];
+        }
+    });
+
+    // A running sum is a dependency chain, so the check is on the critical path.
+    ctx.compare(alias + " checked sum", element_count, [=] {
+        neo::value<T> sum = T();
+
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            sum += a[i];
+        }
+
+        neo_types::benchmark::do_not_optimize(sum);
+    }, [=] {
+        neo::checked<T> sum = T();
+
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            sum += ca[i];
+        }
+
+        neo_types::benchmark::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+// Each row compares unchecked value<T> (the baseline) with checked<T>.
+BENCHMARK_CASE("checked.hpp operators")
+{
+    checked_operators<std::int16_t>(ctx, "int16");
+    checked_operators<std::int32_t>(ctx, "int32");
+    checked_operators<std::int64_t>(ctx, "int64");
+    checked_operators<std::uint32_t>(ctx, "uint32");
+}
@@ -0,0 +1,226 @@
+#include <neo/compressed_ptr.hpp>
+#include <neo/ptr.hpp>
+#include <neo/stdint.hpp>
+#include <benchmark.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct list_arena_tag;
+struct tree_arena_tag;
+
+using list_arena = neo::arena<list_arena_tag>;
+using tree_arena = neo::arena<tree_arena_tag>;
+
+// Nodes linked by neo::ptr (16 and 24 bytes) and by neo::compressed_ptr (8
+// and 12 bytes), so more of the latter fit in each cache line.
+struct list_node
+{
+    neo::ptr<list_node> next;
+    neo::uint32 value;
+};
+
+struct compressed_list_node
+{
+    neo::compressed_ptr<compressed_list_node, list_arena> next;
+    neo::uint32 value;
+};
+
+struct tree_node
+{
+    neo::ptr<tree_node> left;
+    neo::ptr<tree_node> right;
+    neo::uint32 key;
+};
+
+struct compressed_tree_node
+{
+    neo::compressed_ptr<compressed_tree_node, tree_arena> left;
+    neo::compressed_ptr<compressed_tree_node, tree_arena> right;
+    neo::uint32 key;
+};
+
+std::uint64_t next_random(std::uint64_t& seed)
+{
+    seed = seed * 6364136223846793005u + 1442695040888963407u;
+    return seed >> 33;
+}
+
+// Links the nodes in a random order, so each step of a traversal is a cache
+// miss once the list is larger than the cache.
+template<typename Node>
+Node* link_list(std::vector<Node>& nodes)
+{
+    std::vector<std::size_t> order(nodes.size());
+    std::uint64_t seed = 0x9e3779b97f4a7c15u;
+
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+
+    for (std::size_t i = order.size(); i > 1; --i)
+    {
+        std::swap(order[i - 1], order[next_random(seed) % i]);
+    }
+
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+        nodes[order[i]].value = static_cast<std::uint32_t>(i);
+        nodes[order[i]].next = i + 1 < order.size() ? &nodes[order[i + 1]] : nullptr;
+    }
+
+    return &nodes[order[0]];
+}
+
+// Builds a balanced binary search tree of the keys 0, 2, 4, ..., with the
+// nodes in a random order in memory.
+template<typename Node>
+Node* build_tree(std::vector<Node>& nodes, std::vector<std::size_t> const& slots, std::size_t first, std::size_t last)
+{
+    if (first == last)
+    {
+        return nullptr;
+    }
+
+    std::size_t const middle = first + (last - first) / 2;
+    Node* n = &nodes[slots[middle]];
+
+    n->key = static_cast<std::uint32_t>(2 * middle);
+    n->left = build_tree(nodes, slots, first, middle);
+    n->right = build_tree(nodes, slots, middle + 1, last);
+
+    return n;
+}
+
+template<typename Node>
+Node* build_tree(std::vector<Node>& nodes)
+{
+    std::vector<std::size_t> slots(nodes.size());
+    std::uint64_t seed = 0x2545f4914f6cdd1du;
+
+    for (std::size_t i = 0; i < slots.size(); ++i)
+    {
+        slots[i] = i;
+    }
+
+    for (std::size_t i = slots.size(); i > 1; --i)
+    {
+        std::swap(slots[i - 1], slots[next_random(seed) % i]);
+    }
+
+    return build_tree(nodes, slots, 0, nodes.size());
+}
+
+// The traversals use the pointer types of the nodes, so compressed pointers
+// are only expanded to be dereferenced.
+template<typename Ptr>
+std::uint32_t sum_list(Ptr n)
+{
+    std::uint32_t sum = 0;
+
+    for (; n; n = n->next)
+    {
+        sum += n->value.get();
+    }
+
+    return sum;
+}
+
+template<typename Ptr>
+std::size_t search_tree(Ptr root, std::uint32_t const* keys, std::size_t count)
+{
+    std::size_t found = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Ptr n = root;
+
+        while (n && n->key.get() != keys[i])
+        {
+            n = keys[i] < n->key.get() ? n->left : n->right;
+        }
+
+        found += n ? 1 : 0;
+    }
+
+    return found;
+}
+
+void list_loops(neo_types::benchmark::context& ctx, std::size_t count)
+{
+    std::string const name = "compressed_ptr list traversal (" + std::to_string(count) + " nodes)";
+
+    if (!ctx.enabled(name))
+    {
+        return;
+    }
+
+    std::vector<list_node> nodes(count);
+    std::vector<compressed_list_node> compressed(count);
+    list_arena::set_base(compressed.data());
+
+    neo::ptr<list_node> const head = link_list(nodes);
+    neo::compressed_ptr<compressed_list_node, list_arena> const compressed_head = link_list(compressed);
+
+    ctx.compare(name, count, [=] {
+        neo_types::benchmark::do_not_optimize(sum_list(head));
+    }, [=] {
+        neo_types::benchmark::do_not_optimize(sum_list(compressed_head));
+    });
+}
+
+void tree_loops(neo_types::benchmark::context& ctx, std::size_t count)
+{
+    std::string const name = "compressed_ptr tree search (" + std::to_string(count) + " nodes)";
+
+    if (!ctx.enabled(name))
+    {
+        return;
+    }
+
+    std::vector<tree_node> nodes(count);
+    std::vector<compressed_tree_node> compressed(count);
+    tree_arena::set_base(compressed.data());
+
+    neo::ptr<tree_node> const root = build_tree(nodes);
+    neo::compressed_ptr<compressed_tree_node, tree_arena> const compressed_root = build_tree(compressed);
+
+    // Half of the keys are in the tree.
+    std::size_t const searches = 4096;
+    std::vector<std::uint32_t> keys(searches);
+    std::uint64_t seed = 1;
+
+    for (std::size_t i = 0; i < searches; ++i)
+    {
+        keys[i] = static_cast<std::uint32_t>(next_random(seed) % (2 * count));
+    }
+
+    std::uint32_t const* k = keys.data();
+
+    ctx.compare(name, searches, [=] {
+        neo_types::benchmark::do_not_optimize(search_tree(root, k, searches));
+    }, [=] {
+        neo_types::benchmark::do_not_optimize(search_tree(compressed_root, k, searches));
+    });
+}
+
+} // namespace
+
+// Each row compares a structure linked by neo::ptr (the baseline) with the
+// same structure linked by neo::compressed_ptr. The gain is largest when the
+// compressed structure fits in a level of cache that the other does not.
+BENCHMARK_CASE("compressed_ptr.hpp traversal")
+{
+    list_loops(ctx, std::size_t(1) << 12);
+    list_loops(ctx, std::size_t(1) << 16);
+    list_loops(ctx, std::size_t(1) << 18);
+    tree_loops(ctx, std::size_t(1) << 12);
+    tree_loops(ctx, std::size_t(1) << 16);
+    tree_loops(ctx, std::size_t(1) << 20);
+}
@@ -0,0 +1,96 @@
+#include <neo/divider.hpp>
+#include <neo/stdint.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 4096;
+constexpr std::size_t padding = 24;
+
+// Each row compares the built-in operators (the baseline), with a divisor the
+// compiler cannot see, so they are division instructions, with a divider of
+// the same divisor.
+template<typename T>
+void divider_loops(neo_types::benchmark::context& ctx, std::string const& alias, T divisor)
+{
+    // Read through a volatile, so the divisor is not propagated into the loops.
+    volatile T hidden = divisor;
+    T const d = hidden;
+
+    // Padded by different amounts, as in bench_value.cpp, to avoid 4K aliasing.
+    std::vector<T> a(element_count + 1 * padding);
+    std::vector<T> out(element_count + 2 * padding);
+    std::vector<neo::value<T>> na(element_count + 3 * padding);
+    std::vector<neo::value<T>> nout(element_count + 4 * padding);
+
+    std::uint64_t seed = 0x9e3779b97f4a7c15u;
+
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        a[i] = static_cast<T>(seed >> (i % 32));
+        na[i] = a[i];
+    }
+
+    T* pa = a.data();
+    T* pout = out.data();
+    neo::value<T>* pna = na.data();
+    neo::value<T>* pnout = nout.data();
+
+    neo::divider<neo::value<T>> const divider(d);
+
+    ctx.compare(alias + " divider x / d", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pout[i] = pa[i] / d;
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pnout[i] = pna[i] / divider;
+        }
+    });
+
+    ctx.compare(alias + " divider x % d", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pout[i] = pa[i] % d;
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pnout[i] = pna[i] % divider;
+        }
+    });
+
+    neo::span<neo::value<T> const> const sa(pna, element_count);
+    neo::span<neo::value<T>> const sout(pnout, element_count);
+
+    ctx.compare(alias + " divider transform_div", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pout[i] = pa[i] / d;
+        }
+    }, [=] {
+        neo::transform_div(sa, sout, divider);
+    });
+}
+
+} // namespace
+
+// 7 takes the longest path (with the extra addition) for each type, and 1000
+// the shorter one.
+BENCHMARK_CASE("divider.hpp division")
+{
+    divider_loops<std::uint32_t>(ctx, "uint32", 7u);
+    divider_loops<std::uint64_t>(ctx, "uint64", 7u);
+    divider_loops<std::uint64_t>(ctx, "uint64 (1000)", 1000u);
+    divider_loops<std::int64_t>(ctx, "int64", -7);
+}
@@ -0,0 +1,139 @@
+#include <neo/fixed.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 4096;
+constexpr std::size_t padding = 24;
+
+// Floating-point and fixed-point copies of the state of a particle system,
+// padded by different amounts, as in bench_value.cpp, to avoid 4K aliasing.
+template<typename L, typename X>
+struct particles
+{
+    using F = neo::value<L>;
+
+    std::vector<F> position;
+    std::vector<F> velocity;
+    std::vector<F> out;
+
+    std::vector<X> fposition;
+    std::vector<X> fvelocity;
+    std::vector<X> fout;
+
+    particles() :
+        position(element_count + 1 * padding), velocity(element_count + 2 * padding), out(element_count + 3 * padding),
+        fposition(element_count + 4 * padding), fvelocity(element_count + 5 * padding), fout(element_count + 6 * padding)
+    {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            position[i] = static_cast<L>(static_cast<double>(i % 97) - 48.5);
+            velocity[i] = static_cast<L>(static_cast<double>(i % 13) * 0.25 - 1.5);
+            fposition[i] = X(static_cast<double>(position[i]));
+            fvelocity[i] = X(static_cast<double>(velocity[i]));
+        }
+    }
+};
+
+template<typename L, typename X>
+void fixed_update_loops(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    using F = neo::value<L>;
+
+    particles<L, X> d;
+
+    F* position = d.position.data();
+    F* velocity = d.velocity.data();
+    F* out = d.out.data();
+    X* fposition = d.fposition.data();
+    X* fvelocity = d.fvelocity.data();
+    X* fout = d.fout.data();
+
+    F const dt = static_cast<L>(1.0 / 64.0);
+    F const gravity = static_cast<L>(-9.75);
+    F const damping = static_cast<L>(0.984375);
+    F const scale = static_cast<L>(3.0);
+
+    X const fdt(1.0 / 64.0);
+    X const fgravity(-9.75);
+    X const fdamping(0.984375);
+    X const fscale(3.0);
+
+    // An explicit Euler step. The damping keeps the velocities bounded however
+    // many times the step is repeated.
+    ctx.compare(alias + " fixed euler step", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            velocity[i] = (velocity[i] + gravity * dt) * damping;
+            out[i] = position[i] + velocity[i] * dt;
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            fvelocity[i] = (fvelocity[i] + fgravity * fdt) * fdamping;
+            fout[i] = fposition[i] + fvelocity[i] * fdt;
+        }
+    });
+
+    ctx.compare(alias + " fixed * fixed", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = position[i] * damping;
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            fout[i] = fposition[i] * fdamping;
+        }
+    });
+
+    ctx.compare(alias + " fixed / fixed", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = position[i] / scale;
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            fout[i] = fposition[i] / fscale;
+        }
+    });
+
+    neo::span<X const> const sposition(fposition, element_count);
+    neo::span<X const> const svelocity(fvelocity, element_count);
+    neo::span<X> const sout(fout, element_count);
+
+    ctx.compare(alias + " fixed transform_mul", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = position[i] * velocity[i];
+        }
+    }, [=] {
+        neo::transform_mul(sposition, svelocity, sout);
+    });
+
+    ctx.compare(alias + " fixed transform_div", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = position[i] / scale;
+        }
+    }, [=] {
+        neo::transform_div(sposition, fscale, sout);
+    });
+}
+
+} // namespace
+
+// Each row compares a floating-point loop (the baseline) with the same loop in
+// fixed point of the same width.
+BENCHMARK_CASE("fixed.hpp update loops")
+{
+    fixed_update_loops<float, neo::fixed<std::int32_t, 16>>(ctx, "float_ vs q16.16");
+    fixed_update_loops<double, neo::fixed<std::int64_t, 32>>(ctx, "double_ vs q32.32");
+}
@@ -0,0 +1,6 @@
+#include <benchmark.hpp>
+
+int main(int argc, char* argv[])
+{
+    return neo_types::benchmark::run(argc, argv);
+}
@@ -0,0 +1,187 @@
+#include <neo/memory.hpp>
+#include <neo/optional_ref.hpp>
+#include <neo/ptr.hpp>
+#include <neo/ref.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 64 * 1024;
+constexpr std::size_t padding = 24;
+
+int target = 0;
+
+// The fundamental type with the same representation as each Neo type, and
+// the non-zero value each is filled with.
+template<typename T>
+struct underlying;
+
+template<typename T>
+struct underlying<neo::value<T>>
+{
+    using type = T;
+    static T fill() { return static_cast<T>(42); }
+};
+
+template<typename T>
+struct underlying<neo::ptr<T>>
+{
+    using type = T*;
+    static T* fill() { return &target; }
+};
+
+template<typename T>
+struct underlying<neo::ref<T>>
+{
+    using type = T*;
+    static T* fill() { return &target; }
+};
+
+template<typename T>
+struct underlying<neo::optional_ref<T>>
+{
+    using type = T*;
+    static T* fill() { return &target; }
+};
+
+// Raw storage for `element_count` objects of each type. Storage is padded by
+// different amounts, as in bench_value.cpp, to avoid 4K aliasing.
+template<typename Neo>
+struct buffers
+{
+    using T = typename underlying<Neo>::type;
+
+    std::vector<T> src;
+    std::vector<T> dst;
+    std::unique_ptr<unsigned char[]> nsrc_storage;
+    std::unique_ptr<unsigned char[]> ndst_storage;
+
+    buffers() :
+        src(element_count + 1 * padding, underlying<Neo>::fill()),
+        dst(element_count + 2 * padding),
+        nsrc_storage(new unsigned char[(element_count + 3 * padding) * sizeof(Neo)]),
+        ndst_storage(new unsigned char[(element_count + 4 * padding) * sizeof(Neo)])
+    {
+        std::memcpy(nsrc_storage.get(), src.data(), element_count * sizeof(Neo));
+    }
+
+    Neo* nsrc()
+    {
+        return reinterpret_cast<Neo*>(nsrc_storage.get());
+    }
+
+    Neo* ndst()
+    {
+        return reinterpret_cast<Neo*>(ndst_storage.get());
+    }
+};
+
+template<typename Neo>
+void construction(neo_types::benchmark::context& ctx, std::string const& alias, buffers<Neo>& d)
+{
+    using T = typename underlying<Neo>::type;
+
+    T* dst = d.dst.data();
+    Neo* ndst = d.ndst();
+
+    auto const baseline = [=] {
+        std::uninitialized_fill_n(dst, element_count, T());
+    };
+
+    ctx.compare(alias + " default construct loop", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            ::new (static_cast<void*>(ndst + i)) Neo;
+        }
+    });
+
+    ctx.compare(alias + " neo::uninitialized_default_construct_n", element_count, baseline, [=] {
+        neo::uninitialized_default_construct_n(ndst, element_count);
+    });
+}
+
+template<typename Neo>
+void assignment(neo_types::benchmark::context& ctx, std::string const& alias, buffers<Neo>& d)
+{
+    using T = typename underlying<Neo>::type;
+
+    T const* src = d.src.data();
+    T* dst = d.dst.data();
+    Neo const* nsrc = d.nsrc();
+    Neo* ndst = d.ndst();
+    Neo const value = nsrc[0];
+
+    std::uninitialized_copy_n(nsrc, element_count, ndst);
+
+    auto const fill_baseline = [=] {
+        std::fill_n(dst, element_count, src[0]);
+    };
+
+    ctx.compare(alias + " std::fill_n", element_count, fill_baseline, [=] {
+        std::fill_n(ndst, element_count, value);
+    });
+
+    ctx.compare(alias + " neo::fill_n", element_count, fill_baseline, [=] {
+        neo::fill_n(ndst, element_count, value);
+    });
+
+    auto const copy_baseline = [=] {
+        std::copy_n(src, element_count, dst);
+    };
+
+    ctx.compare(alias + " std::copy_n", element_count, copy_baseline, [=] {
+        std::copy_n(nsrc, element_count, ndst);
+    });
+
+    ctx.compare(alias + " neo::copy_n", element_count, copy_baseline, [=] {
+        neo::copy_n(nsrc, element_count, ndst);
+    });
+
+    auto const uninitialized_copy_baseline = [=] {
+        std::uninitialized_copy_n(src, element_count, dst);
+    };
+
+    ctx.compare(alias + " std::uninitialized_copy_n", element_count, uninitialized_copy_baseline, [=] {
+        std::uninitialized_copy_n(nsrc, element_count, ndst);
+    });
+
+    ctx.compare(alias + " neo::uninitialized_copy_n", element_count, uninitialized_copy_baseline, [=] {
+        neo::uninitialized_copy_n(nsrc, element_count, ndst);
+    });
+}
+
+template<typename Neo>
+void all_algorithms(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    buffers<Neo> d;
+    construction(ctx, alias, d);
+    assignment(ctx, alias, d);
+}
+
+template<typename Neo>
+void assignment_algorithms(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    buffers<Neo> d;
+    assignment(ctx, alias, d);
+}
+
+} // namespace
+
+BENCHMARK_CASE("memory.hpp bulk algorithms")
+{
+    all_algorithms<neo::byte>(ctx, "byte");
+    all_algorithms<neo::int_>(ctx, "int_");
+    all_algorithms<neo::double_>(ctx, "double_");
+    all_algorithms<neo::ptr<int>>(ctx, "ptr<int>");
+    all_algorithms<neo::optional_ref<int>>(ctx, "optional_ref<int>");
+    assignment_algorithms<neo::ref<int>>(ctx, "ref<int>");
+}
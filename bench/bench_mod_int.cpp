@@ -0,0 +1,157 @@
+#include <neo/mod_int.hpp>
+#include <neo/stdint.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 4096;
+constexpr std::size_t padding = 24;
+
+// Residues and their representations, padded by different amounts, as in
+// bench_value.cpp, to avoid 4K aliasing.
+template<typename T, typename M>
+struct residues
+{
+    std::vector<T> a;
+    std::vector<T> b;
+    std::vector<T> out;
+
+    std::vector<M> ma;
+    std::vector<M> mb;
+    std::vector<M> mout;
+
+    residues() :
+        a(element_count + 1 * padding), b(element_count + 2 * padding), out(element_count + 3 * padding),
+        ma(element_count + 4 * padding), mb(element_count + 5 * padding), mout(element_count + 6 * padding)
+    {
+        std::uint64_t seed = 0x9e3779b97f4a7c15u;
+
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            a[i] = static_cast<T>((seed >> 1) % M::modulus);
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            b[i] = static_cast<T>((seed >> 1) % M::modulus);
+
+            ma[i] = a[i];
+            mb[i] = b[i];
+        }
+    }
+};
+
+// Each row compares `%` by a compile-time modulus (the baseline), which the
+// compiler implements with a multiplication by a reciprocal for 32-bit moduli,
+// and with a call to a 128-bit division routine for 64-bit moduli.
+template<typename W, typename T, std::uint64_t Modulus>
+void mod_int_loops(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    using M = neo::mod_int<Modulus>;
+
+    residues<T, M> d;
+
+    T* a = d.a.data();
+    T* b = d.b.data();
+    T* out = d.out.data();
+    M* ma = d.ma.data();
+    M* mb = d.mb.data();
+    M* mout = d.mout.data();
+
+    ctx.compare(alias + " mod_int a * b", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<T>(static_cast<W>(a[i]) * b[i] % Modulus);
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            mout[i] = ma[i] * mb[i];
+        }
+    });
+
+    // A polynomial hash, in which each step depends on the last.
+    ctx.compare(alias + " mod_int hash", element_count, [=] {
+        T h = 0;
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            h = static_cast<T>((static_cast<W>(h) * 131u + a[i]) % Modulus);
+        }
+        out[0] = h;
+    }, [=] {
+        M h;
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            h = h * 131u + ma[i];
+        }
+        mout[0] = h;
+    });
+
+    neo::span<M const> const sa(ma, element_count);
+    neo::span<M const> const sb(mb, element_count);
+    neo::span<M> const sout(mout, element_count);
+
+    ctx.compare(alias + " mod_int transform_mul", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<T>(static_cast<W>(a[i]) * b[i] % Modulus);
+        }
+    }, [=] {
+        neo::transform_mul(sa, sb, sout);
+    });
+}
+
+// The same products with a modulus only known at runtime, for which `%` is a
+// division instruction.
+void modulus_loops(neo_types::benchmark::context& ctx, std::uint32_t n)
+{
+    residues<std::uint32_t, neo::mod_int<998244353u>> d;
+    std::vector<neo::uint32> out(element_count + 7 * padding);
+
+    std::uint32_t* a = d.a.data();
+    std::uint32_t* b = d.b.data();
+    std::uint32_t* r = d.out.data();
+    neo::uint32* nout = out.data();
+
+    neo::modulus<std::uint32_t> const m(n);
+    neo::span<neo::uint32 const> const sa(reinterpret_cast<neo::uint32 const*>(a), element_count);
+    neo::span<neo::uint32 const> const sb(reinterpret_cast<neo::uint32 const*>(b), element_count);
+    neo::span<neo::uint32> const sout(nout, element_count);
+
+    ctx.compare("uint32 modulus mul", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            r[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(a[i]) * b[i] % n);
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = m.mul(a[i], b[i]);
+        }
+    });
+
+    ctx.compare("uint32 modulus transform_mul", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            r[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(a[i]) * b[i] % n);
+        }
+    }, [=] {
+        neo::transform_mul(sa, sb, sout, m);
+    });
+}
+
+} // namespace
+
+BENCHMARK_CASE("mod_int.hpp arithmetic")
+{
+    mod_int_loops<std::uint64_t, std::uint32_t, 998244353u>(ctx, "uint32");
+#if defined(NEO_DETAIL_INT128)
+    mod_int_loops<neo::detail::uint128_t, std::uint64_t, 0xffffffff00000001u>(ctx, "uint64");
+#endif
+    modulus_loops(ctx, 998244353u);
+}
@@ -0,0 +1,118 @@
+#include <neo/algorithm.hpp>
+#include <neo/saturating.hpp>
+#include <benchmark.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 4096;
+constexpr std::size_t padding = 24;
+
+// The hand-written alternative: compute in a wider type and clamp.
+template<typename T>
+T clamp(long long x)
+{
+    return static_cast<T>(x < std::numeric_limits<T>::min() ? std::numeric_limits<T>::min() :
+            x > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max() : x);
+}
+
+// Raw and saturating copies of two operand arrays and an output array, padded
+// by different amounts, as in bench_value.cpp, to avoid 4K aliasing. The
+// operands cover the range of T, so that some results saturate.
+template<typename T>
+struct operands
+{
+    std::vector<T> a;
+    std::vector<T> b;
+    std::vector<T> out;
+
+    std::vector<neo::saturating<T>> na;
+    std::vector<neo::saturating<T>> nb;
+    std::vector<neo::saturating<T>> nout;
+
+    operands() :
+        a(element_count + 1 * padding), b(element_count + 2 * padding), out(element_count + 3 * padding),
+        na(element_count + 4 * padding), nb(element_count + 5 * padding), nout(element_count + 6 * padding)
+    {
+        using unsigned_type = typename std::make_unsigned<T>::type;
+
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            a[i] = static_cast<T>(static_cast<unsigned_type>(i * 2654435761u));
+            b[i] = static_cast<T>(static_cast<unsigned_type>(i * 40503u));
+            na[i] = neo::saturating<T>(a[i]);
+            nb[i] = neo::saturating<T>(b[i]);
+        }
+    }
+};
+
+template<typename T>
+void saturating_operations(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    operands<T> d;
+
+    T const* a = d.a.data();
+    T const* b = d.b.data();
+    T* out = d.out.data();
+    neo::saturating<T> const* na = d.na.data();
+    neo::saturating<T> const* nb = d.nb.data();
+    neo::saturating<T>* nout = d.nout.data();
+
+    neo::span<neo::saturating<T> const> const sa(na, element_count);
+    neo::span<neo::saturating<T> const> const sb(nb, element_count);
+    neo::span<neo::saturating<T>> const sout(nout, element_count);
+
+    auto const clamped_add = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = clamp<T>(static_cast<long long>(a[i]) + b[i]);
+        }
+    };
+
+    auto const clamped_sub = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = clamp<T>(static_cast<long long>(a[i]) - b[i]);
+        }
+    };
+
+    ctx.compare(alias + " saturating + saturating", element_count, clamped_add, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = na[i] + nb[i];
+        }
+    });
+
+    ctx.compare(alias + " saturating - saturating", element_count, clamped_sub, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = na[i] - nb[i];
+        }
+    });
+
+    ctx.compare(alias + " saturating transform_add", element_count, clamped_add, [=] {
+        neo::transform_add(sa, sb, sout);
+    });
+
+    ctx.compare(alias + " saturating transform_sub", element_count, clamped_sub, [=] {
+        neo::transform_sub(sa, sb, sout);
+    });
+}
+
+} // namespace
+
+// Each row compares hand-written clamping of a wider result (the baseline)
+// with saturating<T>.
+BENCHMARK_CASE("saturating.hpp operators and kernels")
+{
+    saturating_operations<std::uint8_t>(ctx, "uint8");
+    saturating_operations<std::int8_t>(ctx, "int8");
+    saturating_operations<std::uint16_t>(ctx, "uint16");
+    saturating_operations<std::int16_t>(ctx, "int16");
+    saturating_operations<std::int32_t>(ctx, "int32");
+}
@@ -0,0 +1,593 @@
+#include <neo/stdint.hpp>
+#include <neo/value.hpp>
+#include <benchmark.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 1024;
+constexpr std::size_t padding = 24;
+
+template<typename T>
+struct underlying;
+
+template<typename T>
+struct underlying<neo::value<T>>
+{
+    using type = T;
+};
+
+// Operators
+//-----------
+
+#define NEO_BENCH_BINARY_OP(name_, op) \
+    struct name_ \
+    { \
+        static char const* name() { return #op; } \
+        template<typename A, typename B> \
+        static auto apply(A const& a, B const& b) -> decltype(a op b) { return a op b; } \
+        template<typename A, typename B> \
+        static void assign(A& a, B const& b) { a op##= b; } \
+    };
+
+NEO_BENCH_BINARY_OP(add_op, +)
+NEO_BENCH_BINARY_OP(sub_op, -)
+NEO_BENCH_BINARY_OP(mul_op, *)
+NEO_BENCH_BINARY_OP(div_op, /)
+NEO_BENCH_BINARY_OP(mod_op, %)
+NEO_BENCH_BINARY_OP(and_op, &)
+NEO_BENCH_BINARY_OP(or_op, |)
+NEO_BENCH_BINARY_OP(xor_op, ^)
+NEO_BENCH_BINARY_OP(shl_op, <<)
+NEO_BENCH_BINARY_OP(shr_op, >>)
+
+#undef NEO_BENCH_BINARY_OP
+
+#define NEO_BENCH_COMPARISON_OP(name_, op) \
+    struct name_ \
+    { \
+        static char const* name() { return #op; } \
+        template<typename A, typename B> \
+        static auto apply(A const& a, B const& b) -> decltype(a op b) { return a op b; } \
+    };
+
+NEO_BENCH_COMPARISON_OP(eq_op, ==)
+NEO_BENCH_COMPARISON_OP(ne_op, !=)
+NEO_BENCH_COMPARISON_OP(lt_op, <)
+NEO_BENCH_COMPARISON_OP(le_op, <=)
+NEO_BENCH_COMPARISON_OP(gt_op, >)
+NEO_BENCH_COMPARISON_OP(ge_op, >=)
+
+#undef NEO_BENCH_COMPARISON_OP
+
+#define NEO_BENCH_UNARY_OP(name_, op) \
+    struct name_ \
+    { \
+        static char const* name() { return #op; } \
+        template<typename A> \
+        static auto apply(A const& a) -> decltype(op a) { return op a; } \
+    };
+
+NEO_BENCH_UNARY_OP(pos_op, +)
+NEO_BENCH_UNARY_OP(neg_op, -)
+NEO_BENCH_UNARY_OP(not_op, ~)
+NEO_BENCH_UNARY_OP(lnot_op, !)
+
+#undef NEO_BENCH_UNARY_OP
+
+// Operands
+//----------
+
+template<typename T>
+struct operands
+{
+    std::vector<T> a;
+    std::vector<T> b;
+    std::vector<T> out;
+    std::unique_ptr<bool[]> out_bool;
+
+    std::vector<neo::value<T>> na;
+    std::vector<neo::value<T>> nb;
+    std::vector<neo::value<T>> nout;
+    std::vector<neo::value<bool>> nout_bool;
+
+    // Each array is padded by a different amount so that they do not all start
+    // at the same offset within a page, which would make timings depend on
+    // 4K aliasing between loads and stores rather than on the operators.
+    operands() :
+        a(element_count + 1 * padding), b(element_count + 2 * padding),
+        out(element_count + 3 * padding), out_bool(new bool[element_count + 4 * padding]),
+        na(element_count + 5 * padding), nb(element_count + 6 * padding),
+        nout(element_count + 7 * padding), nout_bool(element_count + 8 * padding)
+    {
+        // Small, non-zero operands keep every operator (including division,
+        // modulo and shifts) well-defined for every type.
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            a[i] = static_cast<T>(1 + i % 13);
+            b[i] = static_cast<T>(1 + i % 7);
+            na[i] = neo::value<T>(a[i]);
+            nb[i] = neo::value<T>(b[i]);
+        }
+    }
+};
+
+// Operator Families
+//-------------------
+
+template<typename Op, typename T>
+void binary(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d)
+{
+    // Pointers are captured by value so that stores through them cannot be
+    // assumed to alias the containers, which would pessimize both loops.
+    T const* a = d.a.data();
+    T const* b = d.b.data();
+    T* out = d.out.data();
+    neo::value<T> const* na = d.na.data();
+    neo::value<T> const* nb = d.nb.data();
+    neo::value<T>* nout = d.nout.data();
+
+    auto const baseline = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<T>(Op::apply(a[i], b[i]));
+        }
+    };
+
+    ctx.compare(alias + " value " + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i], nb[i]);
+        }
+    });
+
+    ctx.compare(alias + " value " + Op::name() + " T", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i], b[i]);
+        }
+    });
+
+    ctx.compare(alias + " T " + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(a[i], nb[i]);
+        }
+    });
+}
+
+template<typename Op, typename T>
+void compound(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d)
+{
+    T const* a = d.a.data();
+    T const* b = d.b.data();
+    T* out = d.out.data();
+    neo::value<T> const* na = d.na.data();
+    neo::value<T> const* nb = d.nb.data();
+    neo::value<T>* nout = d.nout.data();
+
+    auto const baseline = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = a[i];
+            Op::assign(out[i], b[i]);
+        }
+    };
+
+    ctx.compare(alias + " value " + Op::name() + "= value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = na[i];
+            Op::assign(nout[i], nb[i]);
+        }
+    });
+
+    ctx.compare(alias + " value " + Op::name() + "= T", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = na[i];
+            Op::assign(nout[i], b[i]);
+        }
+    });
+}
+
+template<typename Op, typename T>
+void comparison(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d)
+{
+    T const* a = d.a.data();
+    T const* b = d.b.data();
+    bool* out_bool = d.out_bool.get();
+    neo::value<T> const* na = d.na.data();
+    neo::value<T> const* nb = d.nb.data();
+    neo::value<bool>* nout_bool = d.nout_bool.data();
+
+    auto const baseline = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out_bool[i] = Op::apply(a[i], b[i]);
+        }
+    };
+
+    ctx.compare(alias + " value " + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout_bool[i] = Op::apply(na[i], nb[i]);
+        }
+    });
+
+    ctx.compare(alias + " value " + Op::name() + " T", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout_bool[i] = Op::apply(na[i], b[i]);
+        }
+    });
+
+    ctx.compare(alias + " T " + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout_bool[i] = Op::apply(a[i], nb[i]);
+        }
+    });
+}
+
+template<typename Op, typename T>
+void unary(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d)
+{
+    T const* a = d.a.data();
+    T* out = d.out.data();
+    neo::value<T> const* na = d.na.data();
+    neo::value<T>* nout = d.nout.data();
+
+    ctx.compare(alias + " " + Op::name() + "value", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<T>(Op::apply(a[i]));
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i]);
+        }
+    });
+}
+
+template<typename T>
+void increments(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d)
+{
+    T const* a = d.a.data();
+    T* out = d.out.data();
+    neo::value<T> const* na = d.na.data();
+    neo::value<T>* nout = d.nout.data();
+
+    ctx.compare(alias + " ++value", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { out[i] = a[i]; ++out[i]; }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { nout[i] = na[i]; ++nout[i]; }
+    });
+
+    ctx.compare(alias + " value++", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { out[i] = a[i]; out[i]++; }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { nout[i] = na[i]; nout[i]++; }
+    });
+
+    ctx.compare(alias + " --value", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { out[i] = a[i]; --out[i]; }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { nout[i] = na[i]; --nout[i]; }
+    });
+
+    ctx.compare(alias + " value--", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { out[i] = a[i]; out[i]--; }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i) { nout[i] = na[i]; nout[i]--; }
+    });
+}
+
+// The modulo, increment and bitwise families are only defined for some value
+// types, so they are dispatched on the same traits value.hpp uses to enable them.
+
+template<typename T>
+void integral_families(neo_types::benchmark::context&, std::string const&, operands<T>&, std::false_type)
+{
+}
+
+template<typename T>
+void integral_families(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d, std::true_type)
+{
+    binary<mod_op>(ctx, alias, d);
+    compound<mod_op>(ctx, alias, d);
+    increments(ctx, alias, d);
+}
+
+template<typename T>
+void bitwise_families(neo_types::benchmark::context&, std::string const&, operands<T>&, std::false_type)
+{
+}
+
+template<typename T>
+void bitwise_families(neo_types::benchmark::context& ctx, std::string const& alias, operands<T>& d, std::true_type)
+{
+    binary<and_op>(ctx, alias, d);
+    binary<or_op>(ctx, alias, d);
+    binary<xor_op>(ctx, alias, d);
+    binary<shl_op>(ctx, alias, d);
+    binary<shr_op>(ctx, alias, d);
+
+    compound<and_op>(ctx, alias, d);
+    compound<or_op>(ctx, alias, d);
+    compound<xor_op>(ctx, alias, d);
+    compound<shl_op>(ctx, alias, d);
+    compound<shr_op>(ctx, alias, d);
+
+    unary<not_op>(ctx, alias, d);
+}
+
+template<typename Alias>
+void all_operators(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    using T = typename underlying<Alias>::type;
+
+    operands<T> d;
+
+    binary<add_op>(ctx, alias, d);
+    binary<sub_op>(ctx, alias, d);
+    binary<mul_op>(ctx, alias, d);
+    binary<div_op>(ctx, alias, d);
+
+    compound<add_op>(ctx, alias, d);
+    compound<sub_op>(ctx, alias, d);
+    compound<mul_op>(ctx, alias, d);
+    compound<div_op>(ctx, alias, d);
+
+    unary<pos_op>(ctx, alias, d);
+    unary<neg_op>(ctx, alias, d);
+
+    comparison<eq_op>(ctx, alias, d);
+    comparison<ne_op>(ctx, alias, d);
+    comparison<lt_op>(ctx, alias, d);
+    comparison<le_op>(ctx, alias, d);
+    comparison<gt_op>(ctx, alias, d);
+    comparison<ge_op>(ctx, alias, d);
+
+    integral_families(ctx, alias, d, std::integral_constant<bool,
+            std::is_integral<T>::value>());
+    bitwise_families(ctx, alias, d, std::integral_constant<bool,
+            neo::detail::is_unsigned_integral<T>::value>());
+}
+
+// bool_ only has the equality operators and logical negation.
+template<typename Op>
+void bool_comparison(neo_types::benchmark::context& ctx, bool const* a, bool const* b, bool* out,
+        neo::bool_ const* na, neo::bool_ const* nb, neo::bool_* nout)
+{
+    auto const baseline = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = Op::apply(a[i], b[i]);
+        }
+    };
+
+    ctx.compare(std::string("bool_ value ") + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i], nb[i]);
+        }
+    });
+
+    ctx.compare(std::string("bool_ value ") + Op::name() + " T", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i], b[i]);
+        }
+    });
+
+    ctx.compare(std::string("bool_ T ") + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(a[i], nb[i]);
+        }
+    });
+}
+
+void bool_operators(neo_types::benchmark::context& ctx)
+{
+    // std::vector<bool> is bit-packed, so the fundamental operands are plain arrays.
+    std::unique_ptr<bool[]> a(new bool[element_count + 1 * padding]);
+    std::unique_ptr<bool[]> b(new bool[element_count + 2 * padding]);
+    std::unique_ptr<bool[]> out(new bool[element_count + 3 * padding]);
+    std::vector<neo::bool_> na(element_count + 4 * padding);
+    std::vector<neo::bool_> nb(element_count + 5 * padding);
+    std::vector<neo::bool_> nout(element_count + 6 * padding);
+
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        a[i] = i % 3 == 0;
+        b[i] = i % 5 == 0;
+        na[i] = a[i];
+        nb[i] = b[i];
+    }
+
+    bool_comparison<eq_op>(ctx, a.get(), b.get(), out.get(), na.data(), nb.data(), nout.data());
+    bool_comparison<ne_op>(ctx, a.get(), b.get(), out.get(), na.data(), nb.data(), nout.data());
+
+    bool const* pa = a.get();
+    bool* pout = out.get();
+    neo::bool_ const* pna = na.data();
+    neo::bool_* pnout = nout.data();
+
+    ctx.compare("bool_ !value", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pout[i] = lnot_op::apply(pa[i]);
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pnout[i] = lnot_op::apply(pna[i]);
+        }
+    });
+}
+
+// Mixed-width operands convert the narrower operand to the wider type before
+// the operator is applied, so each pairing is measured separately.
+template<typename Op, typename T1, typename T2>
+void mixed(neo_types::benchmark::context& ctx, std::string const& alias, operands<T1>& l, operands<T2>& r)
+{
+    using W = neo::detail::wider_t<T1, T2>;
+
+    std::vector<W> out_storage(element_count + 1 * padding);
+    std::vector<neo::value<W>> nout_storage(element_count + 2 * padding);
+
+    T1 const* a = l.a.data();
+    T2 const* b = r.b.data();
+    W* out = out_storage.data();
+    neo::value<T1> const* na = l.na.data();
+    neo::value<T2> const* nb = r.nb.data();
+    neo::value<W>* nout = nout_storage.data();
+
+    auto const baseline = [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            out[i] = static_cast<W>(Op::apply(a[i], b[i]));
+        }
+    };
+
+    ctx.compare(alias + " value " + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i], nb[i]);
+        }
+    });
+
+    ctx.compare(alias + " value " + Op::name() + " T", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(na[i], b[i]);
+        }
+    });
+
+    ctx.compare(alias + " T " + Op::name() + " value", element_count, baseline, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            nout[i] = Op::apply(a[i], nb[i]);
+        }
+    });
+}
+
+template<typename Alias1, typename Alias2>
+void mixed_operators(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    using T1 = typename underlying<Alias1>::type;
+    using T2 = typename underlying<Alias2>::type;
+
+    operands<T1> l;
+    operands<T2> r;
+
+    mixed<add_op>(ctx, alias, l, r);
+    mixed<sub_op>(ctx, alias, l, r);
+    mixed<mul_op>(ctx, alias, l, r);
+    mixed<div_op>(ctx, alias, l, r);
+}
+
+} // namespace
+
+BENCHMARK_CASE("value.hpp bool_ operators")
+{
+    bool_operators(ctx);
+}
+
+#define NEO_BENCH_MIXED(alias1, alias2) mixed_operators<neo::alias1, neo::alias2>(ctx, #alias1 "/" #alias2)
+
+BENCHMARK_CASE("mixed-width operators")
+{
+    NEO_BENCH_MIXED(int8, int32);
+    NEO_BENCH_MIXED(int16, int32);
+    NEO_BENCH_MIXED(int32, int64);
+    NEO_BENCH_MIXED(int64, int16);
+
+    NEO_BENCH_MIXED(uint8, uint32);
+    NEO_BENCH_MIXED(uint16, uint32);
+    NEO_BENCH_MIXED(uint32, uint64);
+    NEO_BENCH_MIXED(uint64, uint8);
+
+    NEO_BENCH_MIXED(float_, double_);
+    NEO_BENCH_MIXED(double_, float_);
+}
+
+#undef NEO_BENCH_MIXED
+
+#define NEO_BENCH_ALIAS(alias) all_operators<neo::alias>(ctx, #alias)
+
+BENCHMARK_CASE("value.hpp operators")
+{
+    NEO_BENCH_ALIAS(byte);
+    NEO_BENCH_ALIAS(short_);
+    NEO_BENCH_ALIAS(int_);
+    NEO_BENCH_ALIAS(long_);
+    NEO_BENCH_ALIAS(llong);
+
+    NEO_BENCH_ALIAS(ubyte);
+    NEO_BENCH_ALIAS(ushort);
+    NEO_BENCH_ALIAS(uint);
+    NEO_BENCH_ALIAS(ulong);
+    NEO_BENCH_ALIAS(ullong);
+
+    NEO_BENCH_ALIAS(float_);
+    NEO_BENCH_ALIAS(double_);
+    NEO_BENCH_ALIAS(ldouble);
+
+    NEO_BENCH_ALIAS(size);
+    NEO_BENCH_ALIAS(ptrdiff);
+
+    NEO_BENCH_ALIAS(char_);
+    NEO_BENCH_ALIAS(wchar);
+    NEO_BENCH_ALIAS(char16);
+    NEO_BENCH_ALIAS(char32);
+}
+
+BENCHMARK_CASE("stdint.hpp operators")
+{
+    NEO_BENCH_ALIAS(int8);
+    NEO_BENCH_ALIAS(int16);
+    NEO_BENCH_ALIAS(int32);
+    NEO_BENCH_ALIAS(int64);
+
+    NEO_BENCH_ALIAS(int_fast8);
+    NEO_BENCH_ALIAS(int_fast16);
+    NEO_BENCH_ALIAS(int_fast32);
+    NEO_BENCH_ALIAS(int_fast64);
+
+    NEO_BENCH_ALIAS(int_least8);
+    NEO_BENCH_ALIAS(int_least16);
+    NEO_BENCH_ALIAS(int_least32);
+    NEO_BENCH_ALIAS(int_least64);
+
+    NEO_BENCH_ALIAS(intmax);
+    NEO_BENCH_ALIAS(intptr);
+
+    NEO_BENCH_ALIAS(uint8);
+    NEO_BENCH_ALIAS(uint16);
+    NEO_BENCH_ALIAS(uint32);
+    NEO_BENCH_ALIAS(uint64);
+
+    NEO_BENCH_ALIAS(uint_fast8);
+    NEO_BENCH_ALIAS(uint_fast16);
+    NEO_BENCH_ALIAS(uint_fast32);
+    NEO_BENCH_ALIAS(uint_fast64);
+
+    NEO_BENCH_ALIAS(uint_least8);
+    NEO_BENCH_ALIAS(uint_least16);
+    NEO_BENCH_ALIAS(uint_least32);
+    NEO_BENCH_ALIAS(uint_least64);
+
+    NEO_BENCH_ALIAS(uintmax);
+    NEO_BENCH_ALIAS(uintptr);
+}
+
+#undef NEO_BENCH_ALIAS
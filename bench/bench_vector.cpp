@@ -0,0 +1,84 @@
+#include <neo/optional_ref.hpp>
+#include <neo/ptr.hpp>
+#include <neo/ref.hpp>
+#include <neo/value.hpp>
+#include <neo/vector.hpp>
+#include <benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct widget
+{
+    int id;
+};
+
+widget widgets[16];
+
+// Reallocation dominates when vectors are grown one element at a time
+// without reserving, so each benchmark builds a vector of `count` elements
+// from empty.
+template<typename Vector, typename Make>
+void fill(std::size_t count, Make make)
+{
+    Vector v;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        v.push_back(make(i));
+    }
+
+    neo_types::benchmark::do_not_optimize(v.data());
+}
+
+template<typename Neo, typename Raw, typename MakeNeo, typename MakeRaw>
+void growth(neo_types::benchmark::context& ctx, std::string const& alias, std::size_t count,
+        MakeNeo make_neo, MakeRaw make_raw)
+{
+    std::string const suffix = " x" + std::to_string(count);
+
+    auto const baseline = [=] {
+        fill<std::vector<Raw>>(count, make_raw);
+    };
+
+    ctx.compare("std::vector<" + alias + ">" + suffix, count, baseline, [=] {
+        fill<std::vector<Neo>>(count, make_neo);
+    });
+
+    ctx.compare("neo::vector<" + alias + ">" + suffix, count, baseline, [=] {
+        fill<neo::vector<Neo>>(count, make_neo);
+    });
+}
+
+template<typename Neo, typename Raw, typename MakeNeo, typename MakeRaw>
+void all_sizes(neo_types::benchmark::context& ctx, std::string const& alias,
+        MakeNeo make_neo, MakeRaw make_raw)
+{
+    growth<Neo, Raw>(ctx, alias, 1000, make_neo, make_raw);
+    growth<Neo, Raw>(ctx, alias, 100000, make_neo, make_raw);
+    growth<Neo, Raw>(ctx, alias, 1000000, make_neo, make_raw);
+}
+
+} // namespace
+
+BENCHMARK_CASE("vector.hpp reallocation")
+{
+    all_sizes<neo::int_, int>(ctx, "int_",
+            [](std::size_t i) { return neo::int_(static_cast<int>(i)); },
+            [](std::size_t i) { return static_cast<int>(i); });
+
+    all_sizes<neo::ptr<widget>, widget*>(ctx, "ptr<widget>",
+            [](std::size_t i) { return neo::ptr<widget>(&widgets[i % 16]); },
+            [](std::size_t i) { return &widgets[i % 16]; });
+
+    all_sizes<neo::ref<widget>, widget*>(ctx, "ref<widget>",
+            [](std::size_t i) { return neo::ref<widget>(widgets[i % 16]); },
+            [](std::size_t i) { return &widgets[i % 16]; });
+
+    all_sizes<neo::optional_ref<widget>, widget*>(ctx, "optional_ref<widget>",
+            [](std::size_t i) { return neo::optional_ref<widget>(widgets[i % 16]); },
+            [](std::size_t i) { return &widgets[i % 16]; });
+}
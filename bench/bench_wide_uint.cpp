@@ -0,0 +1,150 @@
+#include <neo/wide_uint.hpp>
+#include <benchmark.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t element_count = 4096;
+constexpr std::size_t padding = 24;
+
+// A wide integer as it is often written by hand: 32-bit digits, with 64-bit
+// intermediate products, and carries detected by comparison.
+template<std::size_t Bits>
+struct naive_uint
+{
+    static constexpr std::size_t digit_count = Bits / 32;
+
+    std::uint32_t digits[digit_count];
+};
+
+template<std::size_t Bits>
+void naive_add(naive_uint<Bits>& x, naive_uint<Bits> const& y)
+{
+    std::uint32_t carry = 0;
+
+    for (std::size_t i = 0; i < naive_uint<Bits>::digit_count; ++i)
+    {
+        std::uint32_t const sum = x.digits[i] + y.digits[i];
+        std::uint32_t const result = sum + carry;
+        carry = (sum < x.digits[i]) | (result < sum);
+        x.digits[i] = result;
+    }
+}
+
+template<std::size_t Bits>
+naive_uint<Bits> naive_mul(naive_uint<Bits> const& x, naive_uint<Bits> const& y)
+{
+    naive_uint<Bits> result = {};
+
+    for (std::size_t i = 0; i < naive_uint<Bits>::digit_count; ++i)
+    {
+        std::uint64_t carry = 0;
+
+        for (std::size_t j = 0; i + j < naive_uint<Bits>::digit_count; ++j)
+        {
+            std::uint64_t const t = static_cast<std::uint64_t>(x.digits[j]) * y.digits[i] + result.digits[i + j] + carry;
+            result.digits[i + j] = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+    }
+
+    return result;
+}
+
+template<std::size_t Bits>
+void wide_uint_loops(neo_types::benchmark::context& ctx, std::string const& alias)
+{
+    using W = neo::wide_uint<Bits>;
+    using N = naive_uint<Bits>;
+
+    // Padded by different amounts, as in bench_value.cpp, to avoid 4K aliasing.
+    std::vector<N> na(element_count + 1 * padding);
+    std::vector<N> nb(element_count + 2 * padding);
+    std::vector<N> nout(element_count + 3 * padding);
+    std::vector<W> wa(element_count + 4 * padding);
+    std::vector<W> wb(element_count + 5 * padding);
+    std::vector<W> wout(element_count + 6 * padding);
+
+    std::uint64_t seed = 0x9e3779b97f4a7c15u;
+
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        for (std::size_t j = 0; j < W::limb_count; ++j)
+        {
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            wa[i].limbs()[j] = seed;
+            na[i].digits[2 * j] = static_cast<std::uint32_t>(seed);
+            na[i].digits[2 * j + 1] = static_cast<std::uint32_t>(seed >> 32);
+
+            seed = seed * 6364136223846793005u + 1442695040888963407u;
+            wb[i].limbs()[j] = seed;
+            nb[i].digits[2 * j] = static_cast<std::uint32_t>(seed);
+            nb[i].digits[2 * j + 1] = static_cast<std::uint32_t>(seed >> 32);
+        }
+    }
+
+    N* pna = na.data();
+    N* pnb = nb.data();
+    N* pnout = nout.data();
+    W* pwa = wa.data();
+    W* pwb = wb.data();
+    W* pwout = wout.data();
+
+    // Sums the elements into one accumulator, so each addition depends on the
+    // carries of the last.
+    ctx.compare(alias + " wide_uint accumulate", element_count, [=] {
+        N sum = {};
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            naive_add(sum, pna[i]);
+        }
+        pnout[0] = sum;
+    }, [=] {
+        W sum;
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            sum += pwa[i];
+        }
+        pwout[0] = sum;
+    });
+
+    ctx.compare(alias + " wide_uint a + b", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pnout[i] = pna[i];
+            naive_add(pnout[i], pnb[i]);
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pwout[i] = pwa[i] + pwb[i];
+        }
+    });
+
+    ctx.compare(alias + " wide_uint a * b", element_count, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pnout[i] = naive_mul(pna[i], pnb[i]);
+        }
+    }, [=] {
+        for (std::size_t i = 0; i < element_count; ++i)
+        {
+            pwout[i] = pwa[i] * pwb[i];
+        }
+    });
+}
+
+} // namespace
+
+// Each row compares a naive loop over 32-bit digits (the baseline) with the
+// same operation on wide_uint.
+BENCHMARK_CASE("wide_uint.hpp arithmetic")
+{
+    wide_uint_loops<256>(ctx, "uint256");
+    wide_uint_loops<512>(ctx, "uint512");
+}
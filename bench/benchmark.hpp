@@ -0,0 +1,221 @@
+#pragma once
+
+#ifndef NEO_TYPES_BENCHMARK_HPP
+#define NEO_TYPES_BENCHMARK_HPP
+
+#include <neo/cpu.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace neo_types
+{
+namespace benchmark
+{
+
+// Optimization Barriers
+//-----------------------
+
+#if defined(_MSC_VER) && !defined(__clang__)
+
+namespace detail
+{
+
+inline void use_char_pointer(char const volatile*)
+{
+}
+
+} // namespace detail
+
+template<typename T>
+inline void do_not_optimize(T const& value)
+{
+    detail::use_char_pointer(&reinterpret_cast<char const volatile&>(value));
+    _ReadWriteBarrier();
+}
+
+inline void clobber_memory()
+{
+    _ReadWriteBarrier();
+}
+
+#else
+
+template<typename T>
+inline void do_not_optimize(T const& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobber_memory()
+{
+    asm volatile("" : : : "memory");
+}
+
+#endif
+
+// Configuration
+//---------------
+
+inline char const* configuration_name()
+{
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && !defined(_DEBUG))
+    return "optimized";
+#else
+    return "unoptimized";
+#endif
+}
+
+// Timing
+//--------
+
+using clock = std::chrono::steady_clock;
+
+// Returns the best observed time per iteration, in nanoseconds, of `f` called
+// `iterations` times in a row, taken over several repetitions after a warm-up.
+template<typename F>
+double time_per_iteration(F&& f, std::size_t iterations, std::size_t repetitions = 7)
+{
+    double best = 0.0;
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        f();
+        clobber_memory();
+    }
+
+    for (std::size_t r = 0; r < repetitions; ++r)
+    {
+        auto const start = clock::now();
+
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            f();
+            clobber_memory();
+        }
+
+        auto const end = clock::now();
+        double const ns = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+
+        if (r == 0 || ns < best)
+        {
+            best = ns;
+        }
+    }
+
+    return best;
+}
+
+// Reporting
+//-----------
+
+class context
+{
+private:
+    std::string m_filter;
+    std::size_t m_iterations;
+
+public:
+    context(std::string filter, std::size_t iterations) :
+        m_filter(std::move(filter)),
+        m_iterations(iterations)
+    {
+    }
+
+    bool enabled(std::string const& name) const
+    {
+        return m_filter.empty() || name.find(m_filter) != std::string::npos;
+    }
+
+    std::size_t iterations() const
+    {
+        return m_iterations;
+    }
+
+    // Times `baseline` and `candidate`, which must each process `elements`
+    // elements per call, and prints the time per element of each along with
+    // their ratio (candidate / baseline).
+    template<typename Baseline, typename Candidate>
+    void compare(std::string const& name, std::size_t elements,
+            Baseline&& baseline, Candidate&& candidate)
+    {
+        if (!enabled(name))
+        {
+            return;
+        }
+
+        double const b = time_per_iteration(baseline, m_iterations) / elements;
+        double const c = time_per_iteration(candidate, m_iterations) / elements;
+
+        std::printf("%-48s %10.3f %10.3f %8.2f\n", name.c_str(), b, c, b > 0.0 ? c / b : 0.0);
+    }
+};
+
+// Registration
+//--------------
+
+struct benchmark_case
+{
+    char const* name;
+    void (*function)(context&);
+};
+
+inline std::vector<benchmark_case>& registry()
+{
+    static std::vector<benchmark_case> cases;
+    return cases;
+}
+
+struct registrar
+{
+    registrar(char const* name, void (*function)(context&))
+    {
+        registry().push_back({ name, function });
+    }
+};
+
+inline int run(int argc, char* argv[])
+{
+    std::string filter = argc > 1 ? argv[1] : "";
+    std::size_t iterations = argc > 2 ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 200;
+
+    context ctx(filter, iterations);
+
+    std::printf("configuration: %s\n", configuration_name());
+    std::printf("instruction set: %s (override with NEO_CPU_ISA)\n", neo::cpu::name(neo::cpu::selected_isa()));
+
+    for (auto const& c : registry())
+    {
+        std::printf("\n%s\n", c.name);
+        std::printf("%-48s %10s %10s %8s\n", "benchmark", "base ns", "neo ns", "ratio");
+        c.function(ctx);
+    }
+
+    return 0;
+}
+
+} // namespace benchmark
+} // namespace neo_types
+
+#define NEO_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define NEO_BENCHMARK_CONCAT(a, b) NEO_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define BENCHMARK_CASE(name) \
+    static void NEO_BENCHMARK_CONCAT(neo_benchmark_case_, __LINE__)(::neo_types::benchmark::context&); \
+    static ::neo_types::benchmark::registrar NEO_BENCHMARK_CONCAT(neo_benchmark_registrar_, __LINE__)( \
+            name, &NEO_BENCHMARK_CONCAT(neo_benchmark_case_, __LINE__)); \
+    static void NEO_BENCHMARK_CONCAT(neo_benchmark_case_, __LINE__)(::neo_types::benchmark::context& ctx)
+
+#endif // NEO_TYPES_BENCHMARK_HPP
@@ -0,0 +1,471 @@
+/*
+ * Codegen equivalence check.
+ *
+ * Reads an assembly listing of kernels.cpp and compares each raw_<name>
+ * kernel with its neo_<name> counterpart. The check fails if a Neo kernel
+ * emits more instructions than its fundamental counterpart, or fewer vector
+ * instructions, so a Neo kernel that loses some or all of its vectorization
+ * fails even if scalar instructions make up the difference in count. It also
+ * fails if a Neo kernel updates memory in place more often, as a loop that
+ * keeps a value in memory rather than a register is slower but need not be
+ * longer. Only packed arithmetic and packed loads and stores count as vector
+ * instructions; register moves and zeroing idioms in vector registers are
+ * used by scalar floating-point code too.
+ *
+ * Both GCC/Clang assembly (`-S`) and MSVC listings (`/FA`) are understood.
+ * The benchmarks are built with -O2, where GCC 12 and later vectorize only
+ * loops that the very-cheap cost model accepts, and earlier versions not at
+ * all, so the check is run at -O2 and at -O3:
+ *
+ *     g++ -std=c++14 test/codegen/check_codegen.cpp -o check_codegen
+ *     g++ -std=c++14 -O2 -Iapi -S test/codegen/kernels.cpp -o kernels-O2.s
+ *     g++ -std=c++14 -O3 -Iapi -S test/codegen/kernels.cpp -o kernels-O3.s
+ *     ./check_codegen kernels-O2.s && ./check_codegen kernels-O3.s
+ *
+ * The optional second argument is the number of extra instructions a Neo
+ * kernel may emit before the check fails (default 0).
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct instruction
+{
+    std::string mnemonic;
+    std::string text;
+};
+
+using function_map = std::map<std::string, std::vector<instruction>>;
+
+// Kernels whose Neo version is known to compile differently. They are expected
+// to fail, and the check fails if one of them matches its fundamental
+// counterpart, so that it is removed from this list once the compiler handles
+// it.
+//
+// max_int32: `a < b ? b : a` on class-type lvalues selects between the
+// addresses of the operands rather than their values, which GCC does not
+// if-convert, so the Neo loop has extra instructions and is not vectorized.
+//
+// compound_*: GCC copies a Neo value as an aggregate, and does not forward an
+// aggregate store to a later load of its member, so a compound assignment to
+// a value that was just copied reloads it, and updates it in memory.
+char const* const expected_failures[] = {
+    "max_int32",
+    "compound_and_uint32",
+    "compound_xor_uint64",
+    "compound_shl_uint32",
+    "compound_shr_uint64"
+};
+
+std::string trim(std::string const& s)
+{
+    auto const begin = s.find_first_not_of(" \t\r");
+    auto const end = s.find_last_not_of(" \t\r");
+    return begin == std::string::npos ? std::string() : s.substr(begin, end - begin + 1);
+}
+
+std::string strip_comment(std::string const& s)
+{
+    auto const pos = s.find_first_of(";#");
+    return pos == std::string::npos ? s : s.substr(0, pos);
+}
+
+std::string first_word(std::string const& s)
+{
+    auto const end = s.find_first_of(" \t");
+    return end == std::string::npos ? s : s.substr(0, end);
+}
+
+bool starts_with(std::string const& s, std::string const& prefix)
+{
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool ends_with(std::string const& s, std::string const& suffix)
+{
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Returns the kernel name if `label` names one of the paired kernels.
+std::string kernel_name(std::string label)
+{
+    if (starts_with(label, "_"))
+    {
+        label.erase(0, 1); // Mach-O and 32-bit Windows prefix C symbols with '_'
+    }
+
+    return starts_with(label, "raw_") || starts_with(label, "neo_") ? label : std::string();
+}
+
+bool is_instruction(std::string const& mnemonic)
+{
+    if (mnemonic.empty() || mnemonic[0] == '.' || mnemonic[0] == '$' || ends_with(mnemonic, ":"))
+    {
+        return false; // directive or label
+    }
+
+    // MSVC padding pseudo-instructions and listing keywords
+    static char const* const ignored[] = { "npad", "ALIGN", "PUBLIC", "EXTRN", "ENDP", "PROC" };
+    return std::none_of(std::begin(ignored), std::end(ignored), [&](char const* i) {
+        return mnemonic == i;
+    });
+}
+
+// Splits the operands of an instruction at top-level commas.
+std::vector<std::string> operands(instruction const& i)
+{
+    std::vector<std::string> result;
+    std::string const text = i.text.size() > i.mnemonic.size() ? i.text.substr(i.mnemonic.size()) : std::string();
+    int depth = 0;
+    std::string current;
+
+    for (char const c : text)
+    {
+        depth += c == '(' || c == '[' ? 1 : c == ')' || c == ']' ? -1 : 0;
+
+        if (c == ',' && depth == 0)
+        {
+            result.push_back(trim(current));
+            current.clear();
+        }
+        else
+        {
+            current += c;
+        }
+    }
+
+    if (!trim(current).empty())
+    {
+        result.push_back(trim(current));
+    }
+
+    return result;
+}
+
+bool has_memory_operand(instruction const& i)
+{
+    return i.text.find_first_of("([") != std::string::npos;
+}
+
+// AArch64 NEON: vector register operands such as v0.4s, or q registers
+bool has_neon_operand(instruction const& i)
+{
+    for (std::size_t p = i.text.find('v'); p != std::string::npos; p = i.text.find('v', p + 1))
+    {
+        std::size_t q = p + 1;
+        while (q < i.text.size() && std::isdigit(static_cast<unsigned char>(i.text[q]))) ++q;
+        if (q > p + 1 && q + 1 < i.text.size() && i.text[q] == '.' &&
+                std::isdigit(static_cast<unsigned char>(i.text[q + 1])))
+        {
+            return true;
+        }
+    }
+
+    for (auto const& o : operands(i))
+    {
+        if (o.size() > 1 && o[0] == 'q' && std::all_of(o.begin() + 1, o.end(), [](char c) {
+            return std::isdigit(static_cast<unsigned char>(c)) != 0;
+        }))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// x86 mnemonics which operate on packed data
+bool is_packed_mnemonic(std::string const& m)
+{
+    // packed floating point (addps, vfmadd231pd, ...)
+    if (ends_with(m, "ps") || ends_with(m, "pd"))
+    {
+        return true;
+    }
+
+    // packed integer (paddd, vpmulld, ...), excluding scalar mnemonics that
+    // happen to begin with 'p'
+    static char const* const scalar_p[] = { "push", "pop", "pause", "prefetch", "pdep", "pext" };
+    bool const scalar = std::any_of(std::begin(scalar_p), std::end(scalar_p), [&](char const* s) {
+        return starts_with(m, s);
+    });
+
+    return !scalar && (starts_with(m, "p") || starts_with(m, "vp") || starts_with(m, "movdq") || starts_with(m, "vmovdq"));
+}
+
+// Returns true if the instruction is packed arithmetic, or a packed load or
+// store. Register-to-register moves and idioms whose source operands are all
+// the same register, such as `pxor %xmm1, %xmm1`, are not counted.
+bool is_vector_instruction(instruction const& i)
+{
+    std::string m = i.mnemonic;
+    std::transform(m.begin(), m.end(), m.begin(), [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+
+    if (!has_neon_operand(i) && !is_packed_mnemonic(m))
+    {
+        return false;
+    }
+
+    if (has_memory_operand(i))
+    {
+        return true;
+    }
+
+    if (m.find("mov") != std::string::npos)
+    {
+        return false;
+    }
+
+    std::vector<std::string> const o = operands(i);
+
+    return o.size() < 2 || std::any_of(o.begin() + 1, o.end(), [&](std::string const& x) {
+        return x != o.front();
+    });
+}
+
+// Returns true if the instruction reads, modifies and writes back a memory
+// operand, such as `sall %cl, (%r8)`. Moves, comparisons and other
+// instructions which do not modify their destination are not counted.
+bool is_memory_update(instruction const& i)
+{
+    std::string m = i.mnemonic;
+    std::transform(m.begin(), m.end(), m.begin(), [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+
+    static char const* const excluded[] = { "mov", "lea", "cmp", "test", "push", "pop", "prefetch", "nop", "j", "call", "set", "st", "ld" };
+
+    if (std::any_of(std::begin(excluded), std::end(excluded), [&](char const* e) { return starts_with(m, e); }))
+    {
+        return false;
+    }
+
+    std::vector<std::string> const o = operands(i);
+
+    if (o.empty())
+    {
+        return false;
+    }
+
+    // AT&T syntax has the destination last, and Intel syntax first.
+    std::string const& destination = i.text.find('%') != std::string::npos ? o.back() : o.front();
+    return destination.find_first_of("([") != std::string::npos;
+}
+
+function_map parse(std::istream& in)
+{
+    function_map functions;
+    std::string current;
+    std::string line;
+
+    while (std::getline(in, line))
+    {
+        std::string const code = trim(strip_comment(line));
+
+        if (code.empty())
+        {
+            continue;
+        }
+
+        bool const indented = line[0] == ' ' || line[0] == '\t';
+
+        if (!indented)
+        {
+            // GCC/Clang: "name:"; MSVC: "name PROC" / "name ENDP"
+            std::string const word = first_word(code);
+
+            if (ends_with(code, ":") && code.find(' ') == std::string::npos)
+            {
+                std::string const name = kernel_name(code.substr(0, code.size() - 1));
+
+                if (!name.empty())
+                {
+                    current = name;
+                    functions[current];
+                }
+                continue;
+            }
+
+            if (code.find(" PROC") != std::string::npos)
+            {
+                current = kernel_name(word);
+                if (!current.empty())
+                {
+                    functions[current];
+                }
+                continue;
+            }
+
+            if (code.find(" ENDP") != std::string::npos)
+            {
+                current.clear();
+                continue;
+            }
+
+            // Local labels ($LN4@raw_saxpy:, .L3:) continue the current function
+            if (!ends_with(word, ":"))
+            {
+                continue;
+            }
+        }
+
+        if (current.empty())
+        {
+            continue;
+        }
+
+        std::string const mnemonic = first_word(code);
+
+        if (mnemonic == ".cfi_endproc" || starts_with(code, ".size"))
+        {
+            current.clear();
+            continue;
+        }
+
+        if (is_instruction(mnemonic))
+        {
+            functions[current].push_back({ mnemonic, code });
+        }
+    }
+
+    return functions;
+}
+
+std::size_t count_vector(std::vector<instruction> const& body)
+{
+    return static_cast<std::size_t>(std::count_if(body.begin(), body.end(), is_vector_instruction));
+}
+
+std::size_t count_memory_updates(std::vector<instruction> const& body)
+{
+    return static_cast<std::size_t>(std::count_if(body.begin(), body.end(), is_memory_update));
+}
+
+void print_bodies(std::vector<instruction> const& raw, std::vector<instruction> const& neo)
+{
+    std::size_t const n = std::max(raw.size(), neo.size());
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::printf("    %-40s | %s\n",
+                i < raw.size() ? raw[i].text.c_str() : "",
+                i < neo.size() ? neo[i].text.c_str() : "");
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <assembly listing> [instruction tolerance]\n", argv[0]);
+        return 2;
+    }
+
+    std::ifstream in(argv[1]);
+
+    if (!in)
+    {
+        std::fprintf(stderr, "error: cannot open '%s'\n", argv[1]);
+        return 2;
+    }
+
+    std::size_t const tolerance = argc > 2 ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+    function_map const functions = parse(in);
+
+    int failures = 0;
+    int pairs = 0;
+
+    std::printf("%-24s %8s %8s %8s %8s  %s\n", "kernel", "raw", "neo", "raw vec", "neo vec", "result");
+
+    for (auto const& f : functions)
+    {
+        if (!starts_with(f.first, "raw_"))
+        {
+            continue;
+        }
+
+        std::string const name = f.first.substr(4);
+        auto const neo = functions.find("neo_" + name);
+
+        if (neo == functions.end())
+        {
+            std::printf("%-24s missing neo_%s\n", name.c_str(), name.c_str());
+            ++failures;
+            continue;
+        }
+
+        ++pairs;
+
+        auto const& raw_body = f.second;
+        auto const& neo_body = neo->second;
+
+        std::size_t const raw_vector = count_vector(raw_body);
+        std::size_t const neo_vector = count_vector(neo_body);
+
+        bool const expected = std::any_of(std::begin(expected_failures), std::end(expected_failures),
+                [&](char const* k) { return name == k; });
+
+        char const* result = nullptr;
+
+        if (raw_vector > 0 && neo_vector == 0)
+        {
+            result = "not vectorized";
+        }
+        else if (neo_vector < raw_vector)
+        {
+            result = "partially vectorized";
+        }
+        else if (count_memory_updates(neo_body) > count_memory_updates(raw_body))
+        {
+            result = "updated in memory";
+        }
+        else if (neo_body.size() > raw_body.size() + tolerance)
+        {
+            result = "extra instructions";
+        }
+
+        // An expected failure that now matches fails the check, as does any
+        // other difference.
+        bool const failed = expected ? !result : result != nullptr;
+
+        if (expected && !result)
+        {
+            result = "matches, remove from expected_failures";
+        }
+
+        std::printf("%-24s %8zu %8zu %8zu %8zu  %s%s\n", name.c_str(),
+                raw_body.size(), neo_body.size(), raw_vector, neo_vector,
+                !result ? "ok" : failed ? "FAILED: " : "expected failure: ",
+                result ? result : "");
+
+        if (failed)
+        {
+            ++failures;
+            print_bodies(raw_body, neo_body);
+        }
+    }
+
+    if (pairs == 0)
+    {
+        std::fprintf(stderr, "error: no raw_/neo_ kernel pairs found in '%s'\n", argv[1]);
+        return 2;
+    }
+
+    std::printf("\n%d of %d kernels differ\n", failures, pairs);
+
+    return failures == 0 ? 0 : 1;
+}
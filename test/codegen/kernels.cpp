@@ -0,0 +1,390 @@
+/*
+ * Paired kernels for the codegen equivalence check.
+ *
+ * Every kernel is defined twice: once over fundamental types (raw_<name>) and
+ * once over the equivalent Neo types (neo_<name>). The bodies are written
+ * identically, so after inlining the two should compile to the same code.
+ * check_codegen.cpp compares the emitted assembly of each pair.
+ *
+ * The kernels have C linkage so that their names appear unmangled in the
+ * assembly listing.
+ */
+
+#include <neo/atomic.hpp>
+#include <neo/ranged.hpp>
+#include <neo/stdint.hpp>
+#include <neo/value.hpp>
+#include <neo/wrapping.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+extern "C"
+{
+
+// saxpy: y = a * x + y
+//----------------------
+
+void raw_saxpy(std::size_t n, float a, float const* x, float* y)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+void neo_saxpy(std::size_t n, neo::float_ a, neo::float_ const* x, neo::float_* y)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+// Population count (SWAR)
+//-------------------------
+
+unsigned raw_popcount(std::size_t n, unsigned const* x)
+{
+    unsigned count = 0u;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        unsigned v = x[i];
+        v = v - ((v >> 1u) & 0x55555555u);
+        v = (v & 0x33333333u) + ((v >> 2u) & 0x33333333u);
+        v = (v + (v >> 4u)) & 0x0f0f0f0fu;
+        count += (v * 0x01010101u) >> 24u;
+    }
+
+    return count;
+}
+
+neo::uint neo_popcount(std::size_t n, neo::uint const* x)
+{
+    neo::uint count = 0u;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        neo::uint v = x[i];
+        v = v - ((v >> 1u) & 0x55555555u);
+        v = (v & 0x33333333u) + ((v >> 2u) & 0x33333333u);
+        v = (v + (v >> 4u)) & 0x0f0f0f0fu;
+        count += (v * 0x01010101u) >> 24u;
+    }
+
+    return count;
+}
+
+// Integer sum
+//-------------
+
+std::int32_t raw_sum_int32(std::size_t n, std::int32_t const* x)
+{
+    std::int32_t sum = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sum += x[i];
+    }
+
+    return sum;
+}
+
+neo::int32 neo_sum_int32(std::size_t n, neo::int32 const* x)
+{
+    neo::int32 sum = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sum += x[i];
+    }
+
+    return sum;
+}
+
+// Widening addition (wider_t result)
+//------------------------------------
+
+void raw_add_int16_int32(std::size_t n, std::int16_t const* a, std::int32_t const* b, std::int32_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] + b[i];
+    }
+}
+
+void neo_add_int16_int32(std::size_t n, neo::int16 const* a, neo::int32 const* b, neo::int32* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] + b[i];
+    }
+}
+
+// Unpromoted byte arithmetic
+//----------------------------
+
+void raw_add_uint8(std::size_t n, std::uint8_t const* a, std::uint8_t const* b, std::uint8_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = static_cast<std::uint8_t>(a[i] + b[i]);
+    }
+}
+
+void neo_add_uint8(std::size_t n, neo::uint8 const* a, neo::uint8 const* b, neo::uint8* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] + b[i];
+    }
+}
+
+// Dot product
+//-------------
+
+double raw_dot(std::size_t n, double const* a, double const* b)
+{
+    double sum = 0.0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+neo::double_ neo_dot(std::size_t n, neo::double_ const* a, neo::double_ const* b)
+{
+    neo::double_ sum = 0.0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+// Element-wise maximum (comparison and select)
+//----------------------------------------------
+
+void raw_max_int32(std::size_t n, std::int32_t const* a, std::int32_t const* b, std::int32_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] < b[i] ? b[i] : a[i];
+    }
+}
+
+void neo_max_int32(std::size_t n, neo::int32 const* a, neo::int32 const* b, neo::int32* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] < b[i] ? b[i] : a[i];
+    }
+}
+
+// Compound assignment to a copied value
+//---------------------------------------
+
+void raw_compound_and_uint32(std::size_t n, std::uint32_t const* a, std::uint32_t const* b, std::uint32_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] &= b[i];
+    }
+}
+
+void neo_compound_and_uint32(std::size_t n, neo::uint32 const* a, neo::uint32 const* b, neo::uint32* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] &= b[i];
+    }
+}
+
+void raw_compound_xor_uint64(std::size_t n, std::uint64_t const* a, std::uint64_t const* b, std::uint64_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] ^= b[i];
+    }
+}
+
+void neo_compound_xor_uint64(std::size_t n, neo::uint64 const* a, neo::uint64 const* b, neo::uint64* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] ^= b[i];
+    }
+}
+
+void raw_compound_shl_uint32(std::size_t n, std::uint32_t const* a, std::uint32_t const* b, std::uint32_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] <<= b[i];
+    }
+}
+
+void neo_compound_shl_uint32(std::size_t n, neo::uint32 const* a, neo::uint32 const* b, neo::uint32* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] <<= b[i];
+    }
+}
+
+void raw_compound_shr_uint64(std::size_t n, std::uint64_t const* a, std::uint64_t const* b, std::uint64_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] >>= b[i];
+    }
+}
+
+void neo_compound_shr_uint64(std::size_t n, neo::uint64 const* a, neo::uint64 const* b, neo::uint64* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i];
+        out[i] >>= b[i];
+    }
+}
+
+// Hash mixing (compound assignment, shifts and xor)
+//---------------------------------------------------
+
+void raw_mix_uint64(std::size_t n, std::uint64_t* x)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::uint64_t v = x[i];
+        v ^= v >> 33u;
+        v *= 0xff51afd7ed558ccdull;
+        v ^= v >> 33u;
+        x[i] = v;
+    }
+}
+
+void neo_mix_uint64(std::size_t n, neo::uint64* x)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        neo::uint64 v = x[i];
+        v ^= v >> 33u;
+        v *= 0xff51afd7ed558ccdull;
+        v ^= v >> 33u;
+        x[i] = v;
+    }
+}
+
+// Wrapping signed arithmetic (polynomial hash)
+//----------------------------------------------
+
+std::uint32_t raw_hash_wrapping(std::size_t n, std::uint32_t const* x)
+{
+    std::uint32_t h = 0u;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        h = h * 31u + x[i];
+    }
+
+    return h;
+}
+
+neo::wrapping<std::int32_t> neo_hash_wrapping(std::size_t n, neo::wrapping<std::int32_t> const* x)
+{
+    neo::wrapping<std::int32_t> h = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        h = h * 31 + x[i];
+    }
+
+    return h;
+}
+
+// Ranged difference (no runtime checks)
+//---------------------------------------
+
+void raw_sub_ranged(std::size_t n, std::uint8_t const* a, std::uint8_t const* b, std::int16_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] - b[i];
+    }
+}
+
+void neo_sub_ranged(std::size_t n, neo::ranged<0, 255> const* a, neo::ranged<0, 255> const* b, neo::ranged<-255, 255>* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = a[i] - b[i];
+    }
+}
+
+// Atomic histogram (LOCK ADD)
+//-----------------------------
+
+void raw_atomic_histogram(std::size_t n, std::uint8_t const* x, std::atomic<std::uint32_t>* counts)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        counts[x[i]].fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+void neo_atomic_histogram(std::size_t n, neo::uint8 const* x, neo::atomic<neo::uint32>* counts)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        counts[x[i].get()].fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+// Atomic flags (LOCK OR)
+//------------------------
+
+void raw_atomic_flags(std::size_t n, std::uint32_t const* x, std::atomic<std::uint64_t>* flags)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        flags[x[i] >> 6u].fetch_or(std::uint64_t(1) << (x[i] & 63u), std::memory_order_relaxed);
+    }
+}
+
+void neo_atomic_flags(std::size_t n, neo::uint32 const* x, neo::atomic<neo::uint64>* flags)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        flags[(x[i] >> 6u).get()].fetch_or(neo::uint64(1u) << (x[i] & 63u), std::memory_order_relaxed);
+    }
+}
+
+// Reference count release (LOCK SUB)
+//------------------------------------
+
+bool raw_atomic_release(std::atomic<std::int32_t>* count)
+{
+    return count->fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+bool neo_atomic_release(neo::atomic<neo::int32>* count)
+{
+    return (count->fetch_sub(1, std::memory_order_acq_rel) == 1).get();
+}
+
+} // extern "C"
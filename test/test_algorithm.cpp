@@ -0,0 +1,275 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using neo::cpu::isa;
+
+// Every instruction set the processor supports, so that each implementation
+// of a kernel is tested rather than only the one chosen at runtime.
+std::vector<isa> supported_isas()
+{
+    std::vector<isa> isas;
+
+    for (int i = 0; i <= static_cast<int>(neo::cpu::detected_isa()); ++i)
+    {
+        isas.push_back(static_cast<isa>(i));
+    }
+
+    return isas;
+}
+
+template<typename Kernel, typename... Args>
+auto run(isa i, Args... args)
+{
+    return neo::detail::dispatch<Kernel>::template select<Args...>(i)(args...);
+}
+
+template<typename T>
+std::vector<T> iota(std::size_t count, T first, T step)
+{
+    std::vector<T> v(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        v[i] = static_cast<T>(first + static_cast<T>(i) * step);
+    }
+
+    return v;
+}
+
+template<typename A, typename B, typename Out, typename = void>
+struct transform_add_traits : std::false_type
+{
+};
+
+template<typename A, typename B, typename Out>
+struct transform_add_traits<A, B, Out, neo::detail::void_t<decltype(neo::transform_add(
+    std::declval<neo::span<A>>(), std::declval<neo::span<B>>(), std::declval<neo::span<Out>>()))>
+> : std::true_type
+{
+};
+
+} // namespace
+
+TEST_CASE("span kernels match scalar code on every instruction set", "neo::transform_add")
+{
+    using neo::detail::transform_kernel;
+
+    for (isa target : supported_isas())
+    {
+        for (std::size_t count = 0; count < 150; count += 7)
+        {
+            std::vector<std::int32_t> a = iota<std::int32_t>(count, -50, 3);
+            std::vector<std::int32_t> b = iota<std::int32_t>(count, 40, -2);
+            std::vector<std::int32_t> out(count);
+
+            run<transform_kernel<std::int32_t, neo::detail::add_op>>(target, a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) { CHECK(out[i] == a[i] + b[i]); }
+
+            run<transform_kernel<std::int32_t, neo::detail::sub_op>>(target, a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) { CHECK(out[i] == a[i] - b[i]); }
+
+            run<transform_kernel<std::int32_t, neo::detail::mul_op>>(target, a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) { CHECK(out[i] == a[i] * b[i]); }
+
+            run<transform_kernel<std::int32_t, neo::detail::min_op>>(target, a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) { CHECK(out[i] == std::min(a[i], b[i])); }
+
+            run<transform_kernel<std::int32_t, neo::detail::max_op>>(target, a.data(), b.data(), out.data(), count);
+            for (std::size_t i = 0; i < count; ++i) { CHECK(out[i] == std::max(a[i], b[i])); }
+
+            std::int32_t sum = 0;
+            std::int32_t dot = 0;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum += a[i];
+                dot += a[i] * b[i];
+            }
+
+            CHECK(run<neo::detail::sum_kernel<std::int32_t>>(target, a.data(), count) == sum);
+            CHECK(run<neo::detail::dot_kernel<std::int32_t>>(target, a.data(), b.data(), count) == dot);
+
+            std::vector<std::int32_t> c = a;
+            CHECK(run<neo::detail::mismatch_kernel<std::int32_t>>(target, a.data(), c.data(), count) == count);
+
+            if (count != 0)
+            {
+                c[count - 1] += 1;
+                CHECK(run<neo::detail::mismatch_kernel<std::int32_t>>(target, a.data(), c.data(), count) == count - 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("span kernels convert lanes to the wider type", "neo::transform_add")
+{
+    for (isa target : supported_isas())
+    {
+        std::size_t const count = 100;
+        std::vector<std::int8_t> a = iota<std::int8_t>(count, -50, 1);
+        std::vector<std::int64_t> b = iota<std::int64_t>(count, 1000000000000, 3);
+        std::vector<std::int64_t> out(count);
+
+        run<neo::detail::transform_kernel<std::int64_t, neo::detail::add_op>>(target, a.data(), b.data(), out.data(), count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            CHECK(out[i] == a[i] + b[i]);
+        }
+
+        std::vector<float> x = iota<float>(count, -3.0f, 0.25f);
+        std::vector<double> y = iota<double>(count, 0.5, 0.125);
+        std::vector<double> z(count);
+
+        run<neo::detail::transform_kernel<double, neo::detail::mul_op>>(target, x.data(), y.data(), z.data(), count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            CHECK(z[i] == double(x[i]) * y[i]);
+        }
+    }
+}
+
+TEST_CASE("span kernels follow value conversion rules", "neo::transform_add")
+{
+    CHECK((transform_add_traits<neo::int32 const, neo::int32 const, neo::int32>::value));
+    CHECK((transform_add_traits<neo::int16, neo::int32 const, neo::int32>::value));
+    CHECK((transform_add_traits<neo::int32 const, neo::int16 const, neo::int32>::value));
+    CHECK((!transform_add_traits<neo::int16 const, neo::int32 const, neo::int16>::value));
+    CHECK((!transform_add_traits<neo::int32 const, neo::uint32 const, neo::int32>::value));
+    CHECK((!transform_add_traits<neo::int32 const, neo::float_ const, neo::float_>::value));
+    CHECK((!transform_add_traits<int const, int const, int>::value));
+}
+
+TEST_CASE("span kernels operate on values", "neo::transform_add")
+{
+    std::size_t const count = 37;
+
+    neo::vector<neo::int16> a(count);
+    neo::vector<neo::int32> b(count);
+    neo::vector<neo::int32> out(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        a[i] = static_cast<std::int16_t>(i);
+        b[i] = static_cast<std::int32_t>(100000 - i);
+    }
+
+    SECTION("add")
+    {
+        neo::transform_add(neo::span<neo::int16 const>(a), neo::span<neo::int32 const>(b), out);
+
+        CHECK(out[0] == 100000);
+        CHECK(out[36] == 100000);
+    }
+
+    SECTION("sub")
+    {
+        neo::transform_sub(neo::span<neo::int16>(a), neo::span<neo::int32>(b), out);
+
+        CHECK(out[0] == -100000);
+        CHECK(out[36] == 36 - 99964);
+    }
+
+    SECTION("in place")
+    {
+        neo::transform_mul(neo::span<neo::int32>(b), neo::span<neo::int16>(a), b);
+
+        CHECK(b[0] == 0);
+        CHECK(b[2] == 2 * 99998);
+    }
+
+    SECTION("no integer promotion")
+    {
+        neo::uint8 x[20];
+        neo::uint8 y[20];
+
+        for (int i = 0; i < 20; ++i)
+        {
+            x[i] = std::uint8_t(200);
+            y[i] = std::uint8_t(100);
+        }
+
+        neo::transform_add(neo::span<neo::uint8>(x), neo::span<neo::uint8>(y), x);
+
+        CHECK(x[0] == std::uint8_t(44));
+        CHECK(x[19] == std::uint8_t(44));
+    }
+
+    SECTION("sum")
+    {
+        CHECK(neo::sum(neo::span<neo::int16>(a)) == 666);
+        CHECK((std::is_same<decltype(neo::sum(neo::span<neo::int16>(a))), neo::int16>::value));
+    }
+
+    SECTION("dot")
+    {
+        neo::int16 ones[count];
+        neo::fill_n(ones, count, neo::int16(std::int16_t(1)));
+
+        CHECK(neo::dot(neo::span<neo::int16>(ones), neo::span<neo::int32>(b)) == 100000 * 37 - 666);
+        CHECK((std::is_same<decltype(neo::dot(neo::span<neo::int16>(a), neo::span<neo::int32>(b))), neo::int32>::value));
+    }
+}
+
+TEST_CASE("span kernels handle NaN", "neo::transform_min")
+{
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+
+    neo::float_ a[3] = { 1.0f, nan, 3.0f };
+    neo::float_ b[3] = { 2.0f, 2.0f, nan };
+    neo::float_ out[3];
+
+    neo::transform_min(neo::span<neo::float_>(a), neo::span<neo::float_>(b), out);
+
+    CHECK(out[0] == 1.0f);
+    CHECK(out[1] == 2.0f);
+    CHECK(std::isnan(float(out[2])));
+
+    neo::transform_max(neo::span<neo::float_>(a), neo::span<neo::float_>(b), out);
+
+    CHECK(out[0] == 2.0f);
+    CHECK(out[1] == 2.0f);
+    CHECK(std::isnan(float(out[2])));
+}
+
+TEST_CASE("neo::compare compares spans lexicographically", "neo::compare")
+{
+    neo::int_ a[5] = { 1, 2, 3, 4, 5 };
+    neo::short_ b[5] = { short(1), short(2), short(3), short(4), short(5) };
+
+    neo::span<neo::int_ const> sa = a;
+    neo::span<neo::short_ const> sb = b;
+
+    CHECK(neo::compare(sa, sb) == 0);
+    CHECK(neo::compare(sa.subspan(0, 4), sb) < 0);
+    CHECK(neo::compare(sa, sb.subspan(0, 4)) > 0);
+    CHECK(neo::compare(sa.subspan(0, 0), sb.subspan(0, 0)) == 0);
+
+    b[3] = short(7);
+    CHECK(neo::compare(sa, sb) < 0);
+    CHECK(neo::compare(sb, sa) > 0);
+
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+    neo::float_ x[2] = { nan, 1.0f };
+    neo::float_ y[2] = { 0.0f, 1.0f };
+
+    CHECK(neo::compare(neo::span<neo::float_>(x), neo::span<neo::float_>(y)) == 0);
+
+    neo::double_ zeros[40];
+    neo::double_ negative_zeros[40];
+    neo::fill_n(negative_zeros, 40, -0.0);
+
+    CHECK(neo::compare(neo::span<neo::double_>(zeros), neo::span<neo::double_>(negative_zeros)) == 0);
+
+    negative_zeros[39] = 1.0;
+    CHECK(neo::compare(neo::span<neo::double_>(zeros), neo::span<neo::double_>(negative_zeros)) < 0);
+}
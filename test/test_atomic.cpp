@@ -0,0 +1,199 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+template<typename Atomic, typename Arg, typename = void>
+struct has_fetch_add : std::false_type
+{
+};
+
+template<typename Atomic, typename Arg>
+struct has_fetch_add<Atomic, Arg, decltype(void(std::declval<Atomic&>().fetch_add(std::declval<Arg>())))> : std::true_type
+{
+};
+
+template<typename Atomic, typename Arg, typename = void>
+struct has_fetch_or : std::false_type
+{
+};
+
+template<typename Atomic, typename Arg>
+struct has_fetch_or<Atomic, Arg, decltype(void(std::declval<Atomic&>().fetch_or(std::declval<Arg>())))> : std::true_type
+{
+};
+
+template<typename Atomic, typename Arg, typename = void>
+struct has_store : std::false_type
+{
+};
+
+template<typename Atomic, typename Arg>
+struct has_store<Atomic, Arg, decltype(void(std::declval<Atomic&>().store(std::declval<Arg>())))> : std::true_type
+{
+};
+
+} // namespace
+
+TEST_CASE("neo::atomic operands follow the conversion rules of neo::value", "neo::atomic")
+{
+    CHECK(sizeof(neo::atomic<neo::int32>) == sizeof(std::int32_t));
+    CHECK(alignof(neo::atomic<neo::uint64>) == 8);
+
+    // Operands may widen, but not narrow, change sign or mix policies.
+    CHECK((has_store<neo::atomic<neo::int64>, neo::int32>::value));
+    CHECK((has_store<neo::atomic<neo::int64>, int>::value));
+    CHECK((!has_store<neo::atomic<neo::int32>, neo::int64>::value));
+    CHECK((!has_store<neo::atomic<neo::uint32>, neo::int32>::value));
+    CHECK((!has_store<neo::atomic<neo::int32>, neo::checked<std::int32_t>>::value));
+
+    CHECK((has_fetch_add<neo::atomic<neo::int32>, neo::int16>::value));
+    CHECK((!has_fetch_add<neo::atomic<neo::int16>, neo::int32>::value));
+    CHECK((has_fetch_add<neo::atomic<neo::double_>, neo::float_>::value));
+    CHECK((!has_fetch_add<neo::atomic<neo::value<bool>>, neo::value<bool>>::value));
+
+    // Bitwise operations are only provided for unsigned types.
+    CHECK((has_fetch_or<neo::atomic<neo::uint32>, neo::uint8>::value));
+    CHECK((!has_fetch_or<neo::atomic<neo::int32>, neo::int32>::value));
+    CHECK((!has_fetch_or<neo::atomic<neo::float_>, neo::float_>::value));
+    CHECK((has_fetch_or<neo::atomic_ref<neo::uint16>, neo::uint16>::value));
+    CHECK((!has_fetch_or<neo::atomic_ref<neo::int16>, neo::int16>::value));
+}
+
+TEST_CASE("neo::atomic loads, stores and exchanges values", "neo::atomic")
+{
+    neo::atomic<neo::int32> a;
+    CHECK(a.load() == 0);
+    CHECK(a.is_lock_free());
+
+    a.store(neo::int16(std::int16_t(5)), std::memory_order_release);
+    CHECK(a.load(std::memory_order_acquire) == 5);
+    CHECK(a.exchange(7) == 5);
+
+    neo::int32 expected = 5;
+    CHECK(!a.compare_exchange_strong(expected, 9));
+    CHECK(expected == 7);
+    CHECK(a.compare_exchange_strong(expected, 9, std::memory_order_acq_rel));
+    CHECK(a.load() == 9);
+
+    expected = 9;
+    while (!a.compare_exchange_weak(expected, 11, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+    }
+    CHECK(a.load() == 11);
+
+    neo::atomic<neo::value<bool>> b;
+    CHECK(!b.load().get());
+    CHECK(!b.exchange(true).get());
+    CHECK(b.load().get());
+}
+
+TEST_CASE("neo::atomic arithmetic and bitwise operations return the previous value", "neo::atomic")
+{
+    neo::atomic<neo::uint32> a(10u);
+    CHECK(a.fetch_add(neo::uint8(std::uint8_t(5)), std::memory_order_relaxed) == 10u);
+    CHECK(a.fetch_sub(3u) == 15u);
+    CHECK(a.load() == 12u);
+
+    CHECK(a.fetch_or(0x100u) == 12u);
+    CHECK(a.fetch_and(0x10cu, std::memory_order_acq_rel) == 0x10cu);
+    CHECK(a.fetch_xor(0x4u) == 0x10cu);
+    CHECK(a.load() == 0x108u);
+
+    // Unchecked unsigned and wrapping arithmetic wrap around.
+    neo::atomic<neo::uint8> u;
+    CHECK(u.fetch_sub(std::uint8_t(1)) == 0u);
+    CHECK(u.load() == 255u);
+
+    neo::atomic<neo::wrapping<std::int8_t>> w(std::int8_t(127));
+    CHECK(w.fetch_add(std::int8_t(1)).get() == 127);
+    CHECK(w.load().get() == -128);
+
+    neo::atomic<neo::double_> d(1.5);
+    CHECK(d.fetch_add(neo::float_(2.0f)) == 1.5);
+    CHECK(d.fetch_sub(0.5) == 3.5);
+    CHECK(d.load() == 3.0);
+}
+
+TEST_CASE("neo::atomic arithmetic follows the policy", "neo::atomic")
+{
+    neo::atomic<neo::saturating<std::uint8_t>> s(std::uint8_t(250));
+    CHECK(s.fetch_add(std::uint8_t(10)).get() == 250u);
+    CHECK(s.load().get() == 255u);
+    CHECK(s.fetch_sub(std::uint8_t(10)).get() == 255u);
+    CHECK(s.load().get() == 245u);
+
+    // A checked operation which overflows throws, and leaves the value as it
+    // was.
+    neo::atomic<neo::checked<std::int32_t>> c(2147483647);
+    CHECK_THROWS_AS(c.fetch_add(1), std::overflow_error const&);
+    CHECK(c.load().get() == 2147483647);
+    CHECK(c.fetch_sub(1).get() == 2147483647);
+    CHECK(c.load().get() == 2147483646);
+}
+
+TEST_CASE("neo::atomic_ref operates on a value in place", "neo::atomic")
+{
+    CHECK(neo::atomic_ref<neo::uint64>::required_alignment == 8);
+
+    neo::uint64 counters[4] = {};
+    neo::atomic_ref<neo::uint64> r(counters[2]);
+    CHECK(r.fetch_add(3u) == 0u);
+    CHECK(r.fetch_or(0x10u) == 3u);
+    CHECK(counters[2] == 0x13u);
+
+    neo::atomic_ref<neo::uint64> copy = r;
+    copy.store(7u);
+    CHECK(r.load() == 7u);
+    CHECK(counters[0] == 0u);
+    CHECK(counters[3] == 0u);
+
+    neo::uint64 expected = 7u;
+    CHECK(r.compare_exchange_strong(expected, 8u));
+    CHECK(counters[2] == 8u);
+}
+
+TEST_CASE("neo::atomic operations are atomic", "neo::atomic")
+{
+    std::size_t const thread_count = 4;
+    std::size_t const iterations = 10000;
+
+    neo::atomic<neo::uint64> sum;
+    neo::atomic<neo::uint32> bits;
+    neo::atomic<neo::saturating<std::int32_t>> saturated;
+    neo::uint32 in_place = 0u;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != thread_count; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            neo::atomic_ref<neo::uint32> r(in_place);
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                sum.fetch_add(2u, std::memory_order_relaxed);
+                sum.fetch_sub(1u, std::memory_order_relaxed);
+                bits.fetch_or(neo::uint32(1u) << static_cast<unsigned>(t), std::memory_order_relaxed);
+                saturated.fetch_add(1, std::memory_order_relaxed);
+                r.fetch_add(1u, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(sum.load() == thread_count * iterations);
+    CHECK(bits.load() == 0xfu);
+    CHECK(saturated.load().get() == static_cast<std::int32_t>(thread_count * iterations));
+    CHECK(in_place == thread_count * iterations);
+}
@@ -0,0 +1,184 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Without CMPXCHG16B (-mcx16 with GCC and Clang), atomic_versioned_ptr is a
+// std::atomic of two words, so this file must be linked with -latomic.
+
+namespace
+{
+
+struct node
+{
+    neo::atomic_ptr<node> next;
+    neo::int32 data;
+};
+
+struct base
+{
+    neo::int64 b;
+};
+
+struct other
+{
+    neo::int64 o;
+};
+
+struct derived : other, base
+{
+};
+
+// A Treiber stack, whose nodes are reused, so a pop that was preempted may see
+// its top node again, with a different successor.
+struct stack
+{
+    neo::atomic_versioned_ptr<node> top;
+
+    void push(node* n) noexcept
+    {
+        auto expected = top.load(std::memory_order_relaxed);
+        do
+        {
+            n->next.store(expected.pointer, std::memory_order_relaxed);
+        }
+        while (!top.compare_exchange_weak(expected, n, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    node* pop() noexcept
+    {
+        auto expected = top.load(std::memory_order_acquire);
+        while (expected.pointer &&
+            !top.compare_exchange_weak(expected, expected.pointer->next.load(std::memory_order_relaxed),
+                std::memory_order_acquire, std::memory_order_acquire))
+        {
+        }
+        return expected.pointer;
+    }
+};
+
+} // namespace
+
+TEST_CASE("neo::atomic_ptr loads, stores and exchanges a ptr", "neo::atomic_ptr")
+{
+    CHECK(sizeof(neo::atomic_ptr<int>) == sizeof(int*));
+
+    neo::atomic_ptr<int> a;
+    CHECK(a.load() == nullptr);
+    CHECK(a.is_lock_free());
+
+    int i = 1;
+    int j = 2;
+    a.store(&i);
+    CHECK(a.load().get() == &i);
+    CHECK(a.exchange(&j, std::memory_order_acq_rel).get() == &i);
+    CHECK(a.load(std::memory_order_relaxed).get() == &j);
+
+    neo::ptr<int> expected = &i;
+    CHECK(!a.compare_exchange_strong(expected, nullptr));
+    CHECK(expected.get() == &j);
+    CHECK(a.compare_exchange_strong(expected, &i, std::memory_order_acq_rel, std::memory_order_acquire));
+    CHECK(a.load().get() == &i);
+
+    expected = &i;
+    while (!a.compare_exchange_weak(expected, &j))
+    {
+    }
+    CHECK(a.load().get() == &j);
+
+    derived d;
+    neo::ptr<base> p = &d;
+    neo::atomic_ptr<base> b(p);
+    CHECK(b.load().get() == static_cast<base*>(&d));
+}
+
+TEST_CASE("neo::atomic_versioned_ptr increments its version on every change", "neo::atomic_ptr")
+{
+    neo::atomic_versioned_ptr<int> a;
+    CHECK(a.load().pointer == nullptr);
+    CHECK(a.load().version == 0u);
+#if defined(NEO_DETAIL_CMPXCHG16B)
+    CHECK(a.is_lock_free());
+#endif
+
+    int i = 1;
+    int j = 2;
+    a.store(&i);
+    CHECK(a.load().pointer.get() == &i);
+    CHECK(a.load().version == 1u);
+
+    auto previous = a.exchange(&j);
+    CHECK(previous.pointer.get() == &i);
+    CHECK(previous.version == 1u);
+    CHECK(a.load().version == 2u);
+
+    // The pointer is the same, but the version is stale.
+    neo::versioned_ptr<int> expected = { &j, 1u };
+    CHECK(!a.compare_exchange_strong(expected, &i));
+    CHECK(expected.pointer.get() == &j);
+    CHECK(expected.version == 2u);
+
+    CHECK(a.compare_exchange_strong(expected, &i));
+    CHECK((a.load() == neo::versioned_ptr<int>{ &i, 3u }));
+
+    // Storing the same pointer is still a change.
+    a.store(&i);
+    CHECK((a.load() != expected));
+    CHECK(a.load().version == 4u);
+}
+
+TEST_CASE("neo::atomic_versioned_ptr defeats ABA in a Treiber stack", "neo::atomic_ptr")
+{
+    std::size_t const thread_count = 4;
+    std::size_t const node_count = 64;
+    std::size_t const iterations = 20000;
+
+    std::vector<node> nodes(node_count);
+    stack s;
+    for (auto& n : nodes)
+    {
+        s.push(&n);
+    }
+
+    std::atomic<bool> corrupt(false);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != thread_count; ++t)
+    {
+        threads.emplace_back([&]
+        {
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                node* a = s.pop();
+                node* b = s.pop();
+                if (a == b && a != nullptr)
+                {
+                    corrupt = true;
+                }
+                if (b)
+                {
+                    s.push(b);
+                }
+                if (a)
+                {
+                    s.push(a);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(!corrupt);
+
+    // Every node is on the stack exactly once.
+    std::size_t count = 0;
+    while (s.pop())
+    {
+        ++count;
+    }
+    CHECK(count == node_count);
+}
@@ -0,0 +1,226 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+// Compares the portable overflow checks with the compiler builtins for every
+// pair of operands of an 8-bit type.
+template<typename T>
+bool portable_checks_match_builtins()
+{
+    for (int i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); ++i)
+    {
+        for (int j = std::numeric_limits<T>::min(); j <= std::numeric_limits<T>::max(); ++j)
+        {
+            T const lhs = static_cast<T>(i);
+            T const rhs = static_cast<T>(j);
+            T expected;
+            T actual;
+
+            if (neo::detail::portable_add_overflow(lhs, rhs, actual) != neo::detail::add_overflow(lhs, rhs, expected) ||
+                actual != expected)
+            {
+                return false;
+            }
+
+            if (neo::detail::portable_sub_overflow(lhs, rhs, actual) != neo::detail::sub_overflow(lhs, rhs, expected) ||
+                actual != expected)
+            {
+                return false;
+            }
+
+            if (neo::detail::portable_mul_overflow(lhs, rhs, actual) != neo::detail::mul_overflow(lhs, rhs, expected) ||
+                actual != expected)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Checks the multiplication fallback for types as wide as long long against
+// the builtin.
+template<typename T>
+bool portable_mul_matches_builtin(T lhs, T rhs)
+{
+    T expected;
+    T actual;
+
+    return neo::detail::portable_mul_overflow(lhs, rhs, actual) == neo::detail::mul_overflow(lhs, rhs, expected) &&
+        actual == expected;
+}
+
+} // namespace
+
+TEST_CASE("neo::checked arithmetic gives the same results as value", "neo::checked")
+{
+    neo::checked<int> a = 7;
+    neo::checked<int> b = -3;
+
+    CHECK((a + b) == 4);
+    CHECK((a - b) == 10);
+    CHECK((a * b) == -21);
+    CHECK((a / b) == -2);
+    CHECK((a % b) == 1);
+    CHECK(-a == -7);
+    CHECK(+a == 7);
+}
+
+TEST_CASE("neo::checked throws on overflow", "neo::checked")
+{
+    neo::checked<std::int32_t> const max = std::numeric_limits<std::int32_t>::max();
+    neo::checked<std::int32_t> const min = std::numeric_limits<std::int32_t>::min();
+
+    CHECK_THROWS_AS(max + 1, std::overflow_error const&);
+    CHECK_THROWS_AS(min - 1, std::overflow_error const&);
+    CHECK_THROWS_AS(max * 2, std::overflow_error const&);
+    CHECK_THROWS_AS(min / -1, std::overflow_error const&);
+    CHECK_THROWS_AS(-min, std::overflow_error const&);
+    CHECK((min % -1) == 0);
+
+    neo::checked<std::uint32_t> const zero = 0u;
+
+    CHECK_THROWS_AS(zero - 1u, std::overflow_error const&);
+    CHECK_THROWS_AS(-neo::checked<std::uint32_t>(1u), std::overflow_error const&);
+    CHECK(-zero == 0u);
+}
+
+TEST_CASE("neo::checked does not promote operands", "neo::checked")
+{
+    neo::checked<std::uint8_t> a = std::uint8_t(200);
+    neo::checked<std::uint8_t> b = std::uint8_t(55);
+
+    CHECK((a + b) == 255u);
+    CHECK_THROWS_AS(a + neo::checked<std::uint8_t>(std::uint8_t(56)), std::overflow_error const&);
+    CHECK((std::is_same<decltype(a + b), neo::checked<std::uint8_t>>::value));
+}
+
+TEST_CASE("neo::checked checks in the wider operand type", "neo::checked")
+{
+    neo::checked<std::int16_t> a = std::int16_t(30000);
+    neo::checked<std::int32_t> b = 30000;
+
+    CHECK((a + b) == 60000);
+    CHECK((std::is_same<decltype(a + b), neo::checked<std::int32_t>>::value));
+    CHECK_THROWS_AS(a + a, std::overflow_error const&);
+}
+
+TEST_CASE("neo::checked throws on division by zero", "neo::checked")
+{
+    neo::checked<int> a = 1;
+
+    CHECK_THROWS_AS(a / 0, std::domain_error const&);
+    CHECK_THROWS_AS(a % 0, std::domain_error const&);
+    CHECK_THROWS_AS(a /= 0, std::domain_error const&);
+}
+
+TEST_CASE("neo::checked checks compound assignment and increment", "neo::checked")
+{
+    neo::checked<std::int8_t> a = std::int8_t(126);
+
+    ++a;
+    CHECK(a == 127);
+    CHECK_THROWS_AS(++a, std::overflow_error const&);
+    CHECK_THROWS_AS(a++, std::overflow_error const&);
+    CHECK(a == 127);
+    CHECK_THROWS_AS(a += std::int8_t(1), std::overflow_error const&);
+    CHECK_THROWS_AS(a *= std::int8_t(2), std::overflow_error const&);
+
+    a -= std::int8_t(127);
+    CHECK(a == 0);
+    CHECK(a-- == 0);
+    CHECK(a == -1);
+}
+
+TEST_CASE("neo::checked does not check floating-point arithmetic", "neo::checked")
+{
+    neo::checked<double> const max = std::numeric_limits<double>::max();
+
+    CHECK((max * 2.0) == std::numeric_limits<double>::infinity());
+    CHECK(std::isinf((neo::checked<double>(1.0) / 0.0).get()));
+}
+
+TEST_CASE("neo::checked follows value conversion rules", "neo::checked")
+{
+    CHECK((std::is_convertible<neo::checked<std::int16_t>, neo::checked<std::int32_t>>::value));
+    CHECK((!std::is_convertible<neo::checked<std::int32_t>, neo::checked<std::int16_t>>::value));
+    CHECK((explicit_conversion_traits<neo::checked<std::int32_t>, neo::checked<std::int16_t>>::value));
+    CHECK((explicit_conversion_traits<neo::checked<std::int32_t>, neo::checked<std::uint32_t>>::value));
+    CHECK((!std::is_convertible<neo::checked<std::uint32_t>, neo::checked<std::int32_t>>::value));
+}
+
+TEST_CASE("neo::checked does not mix with other policies", "neo::checked")
+{
+    CHECK((!add_traits<neo::checked<int>, neo::value<int>>::value));
+    CHECK((!add_traits<neo::value<int>, neo::checked<int>>::value));
+    CHECK((!std::is_convertible<neo::value<int>, neo::checked<int>>::value));
+    CHECK((!std::is_convertible<neo::checked<int>, neo::value<int>>::value));
+    CHECK((explicit_conversion_traits<neo::value<int>, neo::checked<int>>::value));
+    CHECK((explicit_conversion_traits<neo::checked<int>, neo::value<int>>::value));
+    CHECK((!explicit_conversion_traits<neo::value<std::int32_t>, neo::checked<std::int16_t>>::value));
+
+    neo::value<int> const v = 3;
+    CHECK((neo::checked<int>(v) + 1) == 4);
+}
+
+TEST_CASE("neo::checked portable overflow checks match the builtins", "neo::checked")
+{
+    CHECK(portable_checks_match_builtins<std::int8_t>());
+    CHECK(portable_checks_match_builtins<std::uint8_t>());
+
+    std::int64_t const min = std::numeric_limits<std::int64_t>::min();
+    std::int64_t const max = std::numeric_limits<std::int64_t>::max();
+
+    CHECK(portable_mul_matches_builtin<std::int64_t>(min, -1));
+    CHECK(portable_mul_matches_builtin<std::int64_t>(-1, min));
+    CHECK(portable_mul_matches_builtin<std::int64_t>(max, 2));
+    CHECK(portable_mul_matches_builtin<std::int64_t>(min / 2, 2));
+    CHECK(portable_mul_matches_builtin<std::int64_t>(min / 2, -2));
+    CHECK(portable_mul_matches_builtin<std::int64_t>(3037000500, 3037000500));
+    CHECK(portable_mul_matches_builtin<std::int64_t>(-3037000499, 3037000499));
+    CHECK(portable_mul_matches_builtin<std::uint64_t>(4294967296u, 4294967296u));
+    CHECK(portable_mul_matches_builtin<std::uint64_t>(4294967295u, 4294967297u));
+    CHECK(portable_mul_matches_builtin<std::uint64_t>(0u, 4294967297u));
+}
+
+#if defined(NEO_DETAIL_INT128)
+
+TEST_CASE("neo::checked supports 128-bit integers", "neo::checked")
+{
+    using int128_t = neo::detail::int128_t;
+    using uint128_t = neo::detail::uint128_t;
+
+    neo::checked<int128_t> const max = neo::detail::numeric_limits<int128_t>::max();
+    neo::checked<int128_t> const min = neo::detail::numeric_limits<int128_t>::min();
+    neo::checked<int128_t> const a = int128_t(1) << 100;
+
+    CHECK((a + a) == neo::checked<int128_t>(int128_t(1) << 101));
+    CHECK((a - a - a) == -a);
+    CHECK((a / 4) == neo::checked<int128_t>(int128_t(1) << 98));
+    CHECK((a % 3) == 1);
+    CHECK_THROWS_AS(a * a, std::overflow_error const&);
+    CHECK_THROWS_AS(max + 1, std::overflow_error const&);
+    CHECK_THROWS_AS(min / -1, std::overflow_error const&);
+    CHECK_THROWS_AS(-min, std::overflow_error const&);
+    CHECK((min % -1) == 0);
+    CHECK_THROWS_AS(neo::checked<uint128_t>(uint128_t(0)) - 1u, std::overflow_error const&);
+
+    CHECK(portable_mul_matches_builtin<int128_t>(min, -1));
+    CHECK(portable_mul_matches_builtin<int128_t>(int128_t(1) << 63, int128_t(1) << 63));
+    CHECK(portable_mul_matches_builtin<int128_t>(-(int128_t(1) << 63), int128_t(1) << 64));
+    CHECK(portable_mul_matches_builtin<uint128_t>(uint128_t(1) << 64, uint128_t(1) << 64));
+}
+
+#endif
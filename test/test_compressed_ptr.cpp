@@ -0,0 +1,101 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+struct node_arena_tag;
+using node_arena = neo::arena<node_arena_tag>;
+
+struct node
+{
+    neo::compressed_ptr<node, node_arena> next;
+    neo::int32 data;
+};
+
+struct base
+{
+    neo::int64 b;
+};
+
+struct other
+{
+    neo::int64 o;
+};
+
+struct derived : other, base
+{
+};
+
+} // namespace
+
+TEST_CASE("neo::compressed_ptr is 32 bits", "neo::compressed_ptr")
+{
+    CHECK(sizeof(neo::compressed_ptr<node, node_arena>) == 4);
+    CHECK(sizeof(node) == 8);
+    CHECK((std::is_trivially_copyable<neo::compressed_ptr<node, node_arena>>::value));
+    CHECK((neo::is_zero_initialized_by_default<neo::compressed_ptr<node, node_arena>>::value));
+    CHECK((std::is_convertible<neo::compressed_ptr<derived, node_arena>, neo::compressed_ptr<base, node_arena>>::value));
+    CHECK((!std::is_convertible<neo::compressed_ptr<base, node_arena>, neo::compressed_ptr<derived, node_arena>>::value));
+    CHECK((!std::is_convertible<neo::compressed_ptr<node, node_arena>, neo::compressed_ptr<node, neo::arena<int>>>::value));
+}
+
+TEST_CASE("neo::compressed_ptr addresses objects in an arena", "neo::compressed_ptr")
+{
+    std::vector<node> nodes(100);
+    node_arena::set_base(nodes.data());
+
+    neo::compressed_ptr<node, node_arena> p;
+    CHECK(!p);
+    CHECK(p == nullptr);
+    CHECK(p.get() == nullptr);
+
+    // The first object in the arena is not null.
+    p = &nodes[0];
+    CHECK(p);
+    CHECK(p.get() == &nodes[0]);
+    CHECK(p.raw() == 1u);
+
+    for (std::size_t i = 0; i + 1 < nodes.size(); ++i)
+    {
+        nodes[i].next = &nodes[i + 1];
+        nodes[i].data = static_cast<std::int32_t>(i);
+    }
+
+    neo::int32 sum;
+    for (node* n = &nodes[0]; n != nullptr; n = n->next)
+    {
+        sum += n->data;
+    }
+    CHECK(sum == 4851);
+
+    auto q = neo::make_compressed_ptr<node_arena>(&nodes[10]);
+    CHECK(q->data == 10);
+    CHECK((*q).next == &nodes[11]);
+    CHECK(q != p);
+    CHECK(p < q);
+    CHECK(q >= p);
+    CHECK(q == nodes[9].next);
+
+    neo::ptr<node> r = q;
+    CHECK(r == &nodes[10]);
+
+    q = nullptr;
+    CHECK(!q);
+}
+
+TEST_CASE("neo::compressed_ptr converts between pointers to related types", "neo::compressed_ptr")
+{
+    std::vector<derived> objects(4);
+    node_arena::set_base(objects.data());
+
+    neo::compressed_ptr<derived, node_arena> d = &objects[2];
+    neo::compressed_ptr<base, node_arena> b = d;
+
+    CHECK(b.get() == static_cast<base*>(&objects[2]));
+    CHECK(b == d);
+}
@@ -0,0 +1,80 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+TEST_CASE("neo::cpu detects consistent features", "neo::cpu")
+{
+    neo::cpu::features const& f = neo::cpu::detected_features();
+
+    CHECK(&f == &neo::cpu::detected_features());
+    CHECK((!f.avx2 || f.avx));
+    CHECK((!f.fma || f.avx));
+    CHECK((!f.avx512bw || f.avx512f));
+
+#if defined(__x86_64__) || defined(_M_X64)
+    CHECK(f.sse2);
+    CHECK(neo::cpu::detected_isa() >= neo::cpu::isa::sse2);
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    CHECK(f.sse41 == !!__builtin_cpu_supports("sse4.1"));
+    CHECK(f.avx2 == !!__builtin_cpu_supports("avx2"));
+    CHECK(f.avx512f == !!__builtin_cpu_supports("avx512f"));
+#endif
+}
+
+TEST_CASE("neo::cpu selects an instruction set the processor supports", "neo::cpu")
+{
+    neo::cpu::isa const detected = neo::cpu::detected_isa();
+    neo::cpu::isa const selected = neo::cpu::selected_isa();
+
+    CHECK(selected <= detected);
+    CHECK(selected == neo::cpu::selected_isa());
+
+    if (detected == neo::cpu::isa::avx512)
+    {
+        CHECK(neo::cpu::detected_features().avx512vl);
+    }
+
+    if (detected >= neo::cpu::isa::avx2)
+    {
+        CHECK(neo::cpu::detected_features().avx2);
+    }
+}
+
+TEST_CASE("neo::cpu instruction sets can be overridden", "neo::cpu")
+{
+    using neo::cpu::isa;
+
+    SECTION("names")
+    {
+        for (int i = 0; i <= static_cast<int>(isa::avx512); ++i)
+        {
+            isa parsed = isa::generic;
+
+            CHECK(neo::detail::parse_isa(neo::cpu::name(static_cast<isa>(i)), parsed));
+            CHECK(parsed == static_cast<isa>(i));
+        }
+
+        isa parsed = isa::avx2;
+        CHECK(!neo::detail::parse_isa("avx", parsed));
+        CHECK(parsed == isa::avx2);
+    }
+
+    SECTION("with a lower instruction set")
+    {
+        CHECK(neo::detail::override_isa(isa::avx512, "sse2") == isa::sse2);
+        CHECK(neo::detail::override_isa(isa::avx2, "generic") == isa::generic);
+    }
+
+    SECTION("with an unsupported instruction set")
+    {
+        CHECK(neo::detail::override_isa(isa::avx2, "avx512") == isa::avx2);
+    }
+
+    SECTION("with an unrecognized or missing name")
+    {
+        CHECK(neo::detail::override_isa(isa::avx2, "AVX2") == isa::avx2);
+        CHECK(neo::detail::override_isa(isa::avx2, "") == isa::avx2);
+        CHECK(neo::detail::override_isa(isa::avx2, nullptr) == isa::avx2);
+    }
+}
@@ -0,0 +1,174 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+std::uint64_t next(std::uint64_t& seed)
+{
+    seed = seed * 6364136223846793005u + 1442695040888963407u;
+    return seed ^ (seed >> 29);
+}
+
+// Compares every numerator of an 8-bit type with the built-in operators,
+// for every divisor.
+template<typename T>
+bool divides_exhaustively()
+{
+    using limits = std::numeric_limits<T>;
+
+    for (int d = limits::min(); d <= limits::max(); ++d)
+    {
+        if (d == 0)
+        {
+            continue;
+        }
+
+        neo::divider<neo::value<T>> const divider(neo::value<T>(static_cast<T>(d)));
+
+        for (int n = limits::min(); n <= limits::max(); ++n)
+        {
+            // The quotient of the most negative value by -1 overflows.
+            if (limits::is_signed && n == limits::min() && d == -1)
+            {
+                continue;
+            }
+
+            neo::value<T> const x = static_cast<T>(n);
+
+            if ((x / divider).get() != static_cast<T>(n / d) || (x % divider).get() != static_cast<T>(n % d))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Compares numerators of a wider type, including those at the ends of its
+// range, with the built-in operators, for divisors of every width.
+template<typename T>
+bool divides_samples()
+{
+    using limits = std::numeric_limits<T>;
+
+    std::uint64_t seed = 0x9e3779b97f4a7c15u;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        T d = static_cast<T>(next(seed) >> (i % 64));
+        d = i < 20 ? static_cast<T>(i - 10) : i < 40 ? static_cast<T>(limits::max() - (i - 20)) : d;
+
+        if (d == 0 || (limits::is_signed && d == T(-1)))
+        {
+            continue;
+        }
+
+        neo::divider<neo::value<T>> const divider = neo::divider<neo::value<T>>(neo::value<T>(d));
+
+        for (int j = 0; j < 200; ++j)
+        {
+            T const n = j < 4 ? (j < 2 ? static_cast<T>(limits::min() + j) : static_cast<T>(limits::max() - (j - 2))) :
+                static_cast<T>(next(seed) >> (j % 64));
+
+            if ((neo::value<T>(n) / divider).get() != n / d || (neo::value<T>(n) % divider).get() != n % d)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("neo::divider matches the built-in operators", "neo::divider")
+{
+    CHECK(divides_exhaustively<std::uint8_t>());
+    CHECK(divides_exhaustively<std::int8_t>());
+    CHECK(divides_samples<std::uint16_t>());
+    CHECK(divides_samples<std::int16_t>());
+    CHECK(divides_samples<std::uint32_t>());
+    CHECK(divides_samples<std::int32_t>());
+    CHECK(divides_samples<std::uint64_t>());
+    CHECK(divides_samples<std::int64_t>());
+
+    neo::divider<neo::uint64> const d(neo::uint64(10u));
+    CHECK(d.get() == 10u);
+    CHECK(neo::uint64(12345u) / d == 1234u);
+    CHECK(neo::uint64(12345u) % d == 5u);
+    CHECK((std::is_same<decltype(neo::uint64() / d), neo::uint64>::value));
+
+    neo::divider<neo::int32> const e(neo::int32(-7));
+    CHECK(neo::int32(-50) / e == 7);
+    CHECK(neo::int32(-50) % e == -1);
+    CHECK(neo::int32(std::numeric_limits<std::int32_t>::min()) / neo::divider<neo::int32>(neo::int32(std::numeric_limits<std::int32_t>::min())) == 1);
+
+    CHECK_THROWS_AS(neo::divider<neo::uint32>(neo::uint32()), std::invalid_argument const&);
+}
+
+TEST_CASE("neo::divider span kernels", "neo::divider")
+{
+    std::size_t const count = 1003;
+
+    std::vector<neo::uint32> a32(count);
+    std::vector<neo::uint32> out32(count);
+    std::vector<neo::uint64> a64(count);
+    std::vector<neo::uint64> out64(count);
+    std::vector<neo::int16> a16(count);
+    std::vector<neo::int16> out16(count);
+
+    std::uint64_t seed = 1;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        a32[i] = static_cast<std::uint32_t>(next(seed));
+        a64[i] = next(seed);
+        a16[i] = static_cast<std::int16_t>(next(seed));
+    }
+
+    a32[0] = std::numeric_limits<std::uint32_t>::max();
+    a64[0] = std::numeric_limits<std::uint64_t>::max();
+
+    // Divisors which take each division path.
+    std::uint64_t const divisors[] = { 1u, 2u, 4096u, 3u, 7u, 10u, 641u, 0xfffffffbu, 0x100000001u, 0xffffffffffffffc5u };
+
+    bool equal = true;
+
+    for (std::uint64_t divisor : divisors)
+    {
+        neo::divider<neo::uint32> const d32(neo::uint32(static_cast<std::uint32_t>(divisor | 1u)));
+        neo::divider<neo::uint64> const d64 = neo::divider<neo::uint64>(neo::uint64(divisor));
+        neo::divider<neo::int16> const d16(neo::int16(static_cast<std::int16_t>(-static_cast<int>(divisor % 1000u) - 1)));
+
+        neo::transform_div(neo::span<neo::uint32 const>(a32.data(), count), neo::span<neo::uint32>(out32.data(), count), d32);
+        neo::transform_div(neo::span<neo::uint64 const>(a64.data(), count), neo::span<neo::uint64>(out64.data(), count), d64);
+        neo::transform_div(neo::span<neo::int16 const>(a16.data(), count), neo::span<neo::int16>(out16.data(), count), d16);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            equal = equal && out32[i].get() == a32[i].get() / d32.get().get() &&
+                    out64[i].get() == a64[i].get() / divisor &&
+                    out16[i].get() == a16[i].get() / d16.get().get();
+        }
+
+        neo::transform_mod(neo::span<neo::uint32 const>(a32.data(), count), neo::span<neo::uint32>(out32.data(), count), d32);
+        neo::transform_mod(neo::span<neo::uint64 const>(a64.data(), count), neo::span<neo::uint64>(out64.data(), count), d64);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            equal = equal && out32[i].get() == a32[i].get() % d32.get().get() && out64[i].get() == a64[i].get() % divisor;
+        }
+    }
+
+    CHECK(equal);
+}
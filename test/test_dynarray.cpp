@@ -0,0 +1,110 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <string>
+
+TEST_CASE("neo types are zero-initialized by default", "neo::is_zero_initialized_by_default")
+{
+    CHECK(neo::is_zero_initialized_by_default<neo::bool_>::value);
+    CHECK(neo::is_zero_initialized_by_default<neo::int_>::value);
+    CHECK(neo::is_zero_initialized_by_default<neo::uint64>::value);
+    CHECK(neo::is_zero_initialized_by_default<neo::double_>::value);
+    CHECK(neo::is_zero_initialized_by_default<neo::ptr<int>>::value);
+    CHECK(neo::is_zero_initialized_by_default<neo::optional_ref<int>>::value);
+
+    CHECK(!neo::is_zero_initialized_by_default<int>::value);
+    CHECK(!neo::is_zero_initialized_by_default<int*>::value);
+    CHECK(!neo::is_zero_initialized_by_default<neo::void_>::value);
+    CHECK(!neo::is_zero_initialized_by_default<neo::ref<int>>::value);
+    CHECK(!neo::is_zero_initialized_by_default<std::string>::value);
+}
+
+TEST_CASE("neo::dynarray is default constructed", "neo::dynarray")
+{
+    SECTION("for small arrays")
+    {
+        neo::dynarray<neo::int_> a(16u);
+
+        REQUIRE(a.size() == 16u);
+        CHECK(a[0] == 0);
+        CHECK(a[15] == 0);
+    }
+
+    SECTION("for arrays backed by zero pages")
+    {
+        neo::dynarray<neo::uint64> a(1u << 20);
+
+        REQUIRE(a.size() == 1u << 20);
+        CHECK(a.front() == 0u);
+        CHECK(a[12345] == 0u);
+        CHECK(a.back() == 0u);
+
+        a[12345] = 42u;
+        CHECK(a[12345] == 42u);
+    }
+
+    SECTION("for pointers")
+    {
+        neo::dynarray<neo::ptr<int>> a(1u << 16);
+
+        CHECK(a.front() == nullptr);
+        CHECK(a.back() == nullptr);
+    }
+
+    SECTION("for types which are not zero-initialized by default")
+    {
+        neo::dynarray<std::string> a(1u << 16);
+
+        CHECK(a.front().empty());
+        CHECK(a.back().empty());
+    }
+}
+
+TEST_CASE("neo::dynarray can be constructed from values", "neo::dynarray")
+{
+    neo::dynarray<neo::int_> a(3u, 7);
+
+    REQUIRE(a.size() == 3u);
+    CHECK(a[0] == 7);
+    CHECK(a[2] == 7);
+
+    neo::dynarray<neo::int_> b = { 1, 2, 3 };
+
+    REQUIRE(b.size() == 3u);
+    CHECK(b[0] == 1);
+    CHECK(b[2] == 3);
+}
+
+TEST_CASE("neo::dynarray can be left undefined", "neo::dynarray")
+{
+    neo::dynarray<neo::int_> a(1000u, neo::undefined);
+
+    REQUIRE(a.size() == 1000u);
+
+    for (auto& v : a)
+    {
+        v = 5;
+    }
+
+    CHECK(a[999] == 5);
+}
+
+TEST_CASE("neo::dynarray can be copied and moved", "neo::dynarray")
+{
+    neo::dynarray<neo::int_> a = { 1, 2, 3 };
+    neo::dynarray<neo::int_> b = a;
+
+    REQUIRE(b.size() == 3u);
+    CHECK(b[1] == 2);
+
+    neo::dynarray<neo::int_> c = std::move(a);
+
+    CHECK(a.empty());
+    REQUIRE(c.size() == 3u);
+    CHECK(c[2] == 3);
+
+    a = c;
+
+    REQUIRE(a.size() == 3u);
+    CHECK(a[0] == 1);
+}
@@ -0,0 +1,331 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+using q16 = neo::fixed<std::int32_t, 16>;
+using q8 = neo::fixed<std::int32_t, 8>;
+using q32 = neo::fixed<std::int64_t, 32>;
+using q8_16 = neo::fixed<std::int16_t, 8>;
+
+// Compares the reciprocal-based span division of each dividend by each divisor
+// with exact division, wherever the exact quotient is representable.
+template<typename T, int FracBits>
+bool matches_exact_division(std::vector<T> const& dividends, std::vector<T> const& divisors)
+{
+    using q = neo::fixed<T, FracBits>;
+    using wide = typename std::conditional<std::is_signed<T>::value, std::int64_t, std::uint64_t>::type;
+
+    std::vector<q> a;
+    std::vector<q> out(dividends.size());
+
+    for (T raw : dividends)
+    {
+        a.push_back(q::from_raw(raw));
+    }
+
+    for (T raw : divisors)
+    {
+        q const d = q::from_raw(raw);
+        neo::transform_div(neo::span<q const>(a.data(), a.size()), d, neo::span<q>(out.data(), out.size()));
+
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            wide const exact = static_cast<wide>(dividends[i]) * (static_cast<wide>(1) << FracBits) / static_cast<wide>(raw);
+
+            if (exact < static_cast<wide>(std::numeric_limits<T>::min()) ||
+                exact > static_cast<wide>(std::numeric_limits<T>::max()))
+            {
+                continue;
+            }
+
+            std::int64_t const error = static_cast<std::int64_t>(out[i].raw().get()) - static_cast<std::int64_t>(exact);
+
+            if (error < -1 || error > 1)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Dividends spread across the whole range of T, including both extremes.
+template<typename T>
+std::vector<T> spread_of(std::uint64_t step)
+{
+    std::vector<T> values;
+    std::int64_t const lowest = static_cast<std::int64_t>(std::numeric_limits<T>::min());
+    std::int64_t const highest = static_cast<std::int64_t>(std::numeric_limits<T>::max());
+
+    for (std::int64_t v = lowest; v <= highest; v += static_cast<std::int64_t>(step))
+    {
+        values.push_back(static_cast<T>(v));
+    }
+
+    values.push_back(std::numeric_limits<T>::max());
+
+    return values;
+}
+
+// Divisors of every magnitude up to 2^Bits, including 7 and 196, and their
+// negations for signed types.
+template<typename T>
+std::vector<T> divisors_of(int bits, std::uint64_t step)
+{
+    std::vector<T> values = { T(7), T(196) };
+
+    for (std::uint64_t raw = 1; raw < (static_cast<std::uint64_t>(1) << bits); raw += step)
+    {
+        values.push_back(static_cast<T>(raw));
+
+        if (std::is_signed<T>::value)
+        {
+            values.push_back(static_cast<T>(0 - static_cast<std::int64_t>(raw)));
+        }
+    }
+
+    for (int i = 0; i < bits; ++i)
+    {
+        values.push_back(static_cast<T>(static_cast<std::uint64_t>(1) << i));
+    }
+
+    return values;
+}
+
+} // namespace
+
+TEST_CASE("neo::fixed stores the value scaled by 2^FracBits", "neo::fixed")
+{
+    q16 const a(3);
+    q16 const b(-1.25);
+
+    CHECK(a.raw() == 3 * 65536);
+    CHECK(b.raw() == -81920);
+    CHECK(static_cast<double>(b) == -1.25);
+    CHECK(static_cast<int>(b) == -1);
+    CHECK(q16() == q16::from_raw(0));
+    CHECK(sizeof(q16) == sizeof(std::int32_t));
+    CHECK((q16::int_bits == 15));
+}
+
+TEST_CASE("neo::fixed rounds floating-point values to nearest", "neo::fixed")
+{
+    using q4 = neo::fixed<std::int16_t, 4>;
+
+    CHECK(q4(0.03).raw() == 0);
+    CHECK(q4(0.04).raw() == 1);
+    CHECK(q4(-0.04).raw() == -1);
+    CHECK(q4(1.5).raw() == 24);
+}
+
+TEST_CASE("neo::fixed arithmetic", "neo::fixed")
+{
+    q16 const a(2.5);
+    q16 const b(-0.75);
+
+    CHECK((a + b) == q16(1.75));
+    CHECK((a - b) == q16(3.25));
+    CHECK((a * b) == q16(-1.875));
+    CHECK((a / b) == q16::from_raw(-218453));
+    CHECK(-a == q16(-2.5));
+    CHECK((a * 3) == q16(7.5));
+    CHECK((2 * a) == q16(5.0));
+    CHECK((a / 2) == q16(1.25));
+    CHECK(a > b);
+    CHECK(b <= a);
+}
+
+TEST_CASE("neo::fixed products and quotients use a wider intermediate", "neo::fixed")
+{
+    q16 const big(20000.0);
+    q16 const small(0.001);
+
+    CHECK(static_cast<int>(big * small) == 20);
+    CHECK((big / q16(4000.0)) == q16(5.0));
+
+    q32 const x(1000.5);
+    q32 const y(-3000.25);
+
+    CHECK(static_cast<double>(x * y) == -3001750.125);
+    CHECK(static_cast<double>(q32(-3001750.125) / y) == 1000.5);
+}
+
+TEST_CASE("neo::fixed products round towards negative infinity", "neo::fixed")
+{
+    q16 const tiny = q16::from_raw(1);
+
+    CHECK((tiny * q16(0.5)).raw() == 0);
+    CHECK((-tiny * q16(0.5)).raw() == -1);
+    CHECK((q16::from_raw(-3) / q16(2.0)).raw() == -1);
+}
+
+TEST_CASE("neo::fixed compound assignment", "neo::fixed")
+{
+    q16 a(1.5);
+
+    a += q16(0.25);
+    CHECK(a == q16(1.75));
+    a -= q8_16(1.0);
+    CHECK(a == q16(0.75));
+    a *= q16(4.0);
+    CHECK(a == q16(3.0));
+    a /= q16(-2.0);
+    CHECK(a == q16(-1.5));
+    a *= 4;
+    CHECK(a == q16(-6.0));
+    a /= 3;
+    CHECK(a == q16(-2.0));
+}
+
+TEST_CASE("neo::fixed follows the value conversion rules", "neo::fixed")
+{
+    // Conversions are safe if neither integer nor fractional bits are lost.
+    CHECK((std::is_convertible<q8_16, q16>::value));
+    CHECK((std::is_convertible<q16, q32>::value));
+    CHECK((!std::is_convertible<q8, q16>::value));
+    CHECK((!std::is_convertible<q16, q8>::value));
+    CHECK((explicit_conversion_traits<q16, q8>::value));
+    CHECK((explicit_conversion_traits<q8, q16>::value));
+    CHECK((!std::is_convertible<q8, q8_16>::value));
+    CHECK((!std::is_convertible<q16, neo::fixed<std::uint32_t, 16>>::value));
+
+    // Integers convert implicitly if they fit in the integer bits.
+    CHECK((std::is_convertible<std::int16_t, q8>::value));
+    CHECK((!std::is_convertible<std::int32_t, q8>::value));
+    CHECK((!std::is_convertible<unsigned, q8>::value));
+    CHECK((std::is_convertible<neo::int8, q16>::value));
+    CHECK((!std::is_convertible<double, q16>::value));
+    CHECK((!std::is_convertible<q16, double>::value));
+    CHECK((!std::is_convertible<q16, int>::value));
+    CHECK((explicit_conversion_traits<q16, neo::double_>::value));
+
+    // Formats can be mixed if one converts safely to the other.
+    CHECK((std::is_same<decltype(q8_16() + q16()), q16>::value));
+    CHECK((std::is_same<decltype(q16() * q32()), q32>::value));
+    CHECK((!add_traits<q16, q8>::value));
+    CHECK((!add_traits<q16, int>::value));
+}
+
+TEST_CASE("neo::fixed conversions between formats", "neo::fixed")
+{
+    using q0 = neo::fixed<std::int32_t, 0>;
+
+    q16 const a(-1.75);
+
+    CHECK(q32(a) == q32(-1.75));
+    CHECK(static_cast<q8>(a) == q8(-1.75));
+    CHECK(static_cast<q0>(a) == q0(-2));
+}
+
+TEST_CASE("neo::fixed is usable in constant expressions", "neo::fixed")
+{
+    constexpr q16 a(1.5);
+    constexpr q16 b = a * a + q16(std::int16_t(1));
+
+    static_assert(b.raw().get() == 13 * 16384, "");
+    CHECK(b == q16(3.25));
+}
+
+TEST_CASE("neo::fixed span kernels", "neo::fixed")
+{
+    std::vector<q16> a;
+    std::vector<q16> b;
+    std::vector<q16> out(101);
+
+    for (int i = 0; i < 101; ++i)
+    {
+        a.push_back(q16(i * 1.5 - 70.0));
+        b.push_back(q16(i * -0.25 + 3.0));
+    }
+
+    neo::span<q16 const> const sa(a.data(), a.size());
+    neo::span<q16 const> const sb(b.data(), b.size());
+    neo::span<q16> const sout(out.data(), out.size());
+
+    bool add = true;
+    bool sub = true;
+    bool mul = true;
+    bool div = true;
+
+    neo::transform_add(sa, sb, sout);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        add = add && out[i] == a[i] + b[i];
+    }
+
+    neo::transform_sub(sa, sb, sout);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        sub = sub && out[i] == a[i] - b[i];
+    }
+
+    neo::transform_mul(sa, sb, sout);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        mul = mul && out[i] == a[i] * b[i];
+    }
+
+    neo::transform_div(sa, q16(4.0), sout);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        div = div && out[i] == a[i] / 4;
+    }
+
+    CHECK(add);
+    CHECK(sub);
+    CHECK(mul);
+    CHECK(div);
+}
+
+TEST_CASE("neo::fixed 64-bit span kernels", "neo::fixed")
+{
+    std::vector<q32> a;
+    std::vector<q32> out(37);
+
+    for (int i = 0; i < 37; ++i)
+    {
+        a.push_back(q32(i * 1000.125 - 9000.0));
+    }
+
+    neo::span<q32 const> const sa(a.data(), a.size());
+    neo::span<q32> const sout(out.data(), out.size());
+
+    bool mul = true;
+    bool div = true;
+
+    neo::transform_mul(sa, sa, sout);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        mul = mul && out[i] == a[i] * a[i];
+    }
+
+    neo::transform_div(sa, q32(-3.0), sout);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        div = div && out[i] == a[i] / q32(-3.0);
+    }
+
+    CHECK(mul);
+    CHECK(div);
+}
+
+TEST_CASE("neo::fixed reciprocal division is within one unit", "neo::fixed")
+{
+    CHECK((matches_exact_division<std::int16_t, 8>(spread_of<std::int16_t>(97), divisors_of<std::int16_t>(12, 37))));
+    CHECK((matches_exact_division<std::uint16_t, 8>(spread_of<std::uint16_t>(1), divisors_of<std::uint16_t>(16, 37))));
+    CHECK((matches_exact_division<std::uint16_t, 15>(spread_of<std::uint16_t>(1), divisors_of<std::uint16_t>(16, 541))));
+    CHECK((matches_exact_division<std::int32_t, 16>(spread_of<std::int32_t>(65521), divisors_of<std::int32_t>(31, 8388593))));
+    CHECK((matches_exact_division<std::uint32_t, 16>(spread_of<std::uint32_t>(65521), divisors_of<std::uint32_t>(32, 8388593))));
+    CHECK((matches_exact_division<std::uint32_t, 31>(spread_of<std::uint32_t>(65521), divisors_of<std::uint32_t>(32, 8388593))));
+}
@@ -0,0 +1,216 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+float float_from(std::uint32_t bits)
+{
+    float x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+// Converts a spread of float bit patterns, including subnormals, infinities
+// and NaNs, with the span conversions, and compares the results with the
+// scalar conversions, bit for bit.
+template<typename H>
+bool span_conversions_match()
+{
+    std::vector<neo::float_> in;
+
+    for (std::uint64_t bits = 0; bits < (std::uint64_t(1) << 32); bits += 1000003)
+    {
+        in.push_back(float_from(static_cast<std::uint32_t>(bits)));
+    }
+
+    std::vector<H> narrow(in.size());
+    std::vector<neo::float_> wide(in.size());
+
+    neo::convert(neo::span<neo::float_ const>(in.data(), in.size()), neo::span<H>(narrow.data(), narrow.size()));
+    neo::convert(neo::span<H const>(narrow.data(), narrow.size()), neo::span<neo::float_>(wide.data(), wide.size()));
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        float const x = static_cast<float>(narrow[i]);
+
+        if (narrow[i].bits() != H(in[i]).bits() || std::memcmp(&x, &wide[i], sizeof(x)) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("neo::float16 and neo::bfloat16 representations", "neo::float16")
+{
+    CHECK(sizeof(neo::float16) == 2);
+    CHECK(sizeof(neo::bfloat16) == 2);
+    CHECK(neo::float16(1.0f).bits() == 0x3c00u);
+    CHECK(neo::float16(-2.0).bits() == 0xc000u);
+    CHECK(neo::float16(65504).bits() == 0x7bffu);
+    CHECK(neo::bfloat16(1.0f).bits() == 0x3f80u);
+    CHECK(neo::bfloat16(-3.0).bits() == 0xc040u);
+    CHECK(neo::float16().bits() == 0u);
+    CHECK(static_cast<float>(neo::float16::from_bits(std::uint16_t(0x3555))) == 0.333251953125f);
+    CHECK((-neo::float16(1.5f)).bits() == 0xbe00u);
+}
+
+TEST_CASE("neo::float16 rounds to nearest, ties to even", "neo::float16")
+{
+    float const ulp = std::ldexp(1.0f, -10);
+
+    CHECK(neo::float16(1.0f + ulp / 2).bits() == 0x3c00u);
+    CHECK(neo::float16(1.0f + ulp * 3 / 2).bits() == 0x3c02u);
+    CHECK(neo::float16(1.0f + ulp * 3 / 4).bits() == 0x3c01u);
+    CHECK(neo::float16(65519.0f).bits() == 0x7bffu);
+    CHECK(neo::float16(65520.0f).bits() == 0x7c00u);
+    CHECK(neo::float16(-1e10).bits() == 0xfc00u);
+    CHECK(neo::float16(2049).bits() == neo::float16(2048).bits());
+    CHECK(neo::float16(2051).bits() == neo::float16(2052).bits());
+    CHECK(neo::float16(std::numeric_limits<std::uint64_t>::max()).bits() == 0x7c00u);
+
+    // Subnormals are multiples of 2^-24.
+    CHECK(neo::float16(std::ldexp(1.0, -24)).bits() == 0x0001u);
+    CHECK(neo::float16(std::ldexp(1.0f, -25)).bits() == 0x0000u);
+    CHECK(neo::float16(std::ldexp(3.0f, -26)).bits() == 0x0001u);
+    CHECK(neo::float16(-std::ldexp(1.0f, -26)).bits() == 0x8000u);
+    CHECK(neo::float16(std::ldexp(1023.5, -24)).bits() == 0x0400u);
+
+    CHECK(std::isnan(static_cast<float>(neo::float16(std::numeric_limits<float>::quiet_NaN()))));
+    CHECK(std::isinf(static_cast<float>(neo::float16(std::numeric_limits<double>::infinity()))));
+}
+
+TEST_CASE("neo::bfloat16 rounds to nearest, ties to even", "neo::float16")
+{
+    float const ulp = std::ldexp(1.0f, -7);
+
+    CHECK(neo::bfloat16(1.0f + ulp / 2).bits() == 0x3f80u);
+    CHECK(neo::bfloat16(1.0f + ulp * 3 / 2).bits() == 0x3f82u);
+    CHECK(neo::bfloat16(std::numeric_limits<float>::max()).bits() == 0x7f80u);
+    CHECK(neo::bfloat16(std::numeric_limits<float>::denorm_min()).bits() == 0x0000u);
+    CHECK(neo::bfloat16(1.0 + 1e-3).bits() == 0x3f80u);
+    CHECK(neo::bfloat16(257).bits() == neo::bfloat16(256).bits());
+    CHECK(std::isnan(static_cast<float>(neo::bfloat16(float_from(0x7f800001u)))));
+    CHECK(std::isnan(static_cast<float>(neo::bfloat16(float_from(0xffffffffu)))));
+}
+
+TEST_CASE("neo::float16 converts exactly to float", "neo::float16")
+{
+    bool exact = true;
+
+    for (std::uint32_t bits = 0; bits < 0x10000u; ++bits)
+    {
+        neo::float16 const h = neo::float16::from_bits(static_cast<std::uint16_t>(bits));
+        float const x = h;
+
+        exact = exact && (std::isnan(x) ? (bits & 0x7c00u) == 0x7c00u : bool(neo::float16(x).bits() == bits));
+    }
+
+    CHECK(exact);
+}
+
+TEST_CASE("neo::float16 follows the value conversion rules", "neo::float16")
+{
+    CHECK((std::is_convertible<neo::float16, float>::value));
+    CHECK((std::is_convertible<neo::float16, double>::value));
+    CHECK((std::is_convertible<neo::float16, neo::float_>::value));
+    CHECK((std::is_convertible<neo::bfloat16, neo::double_>::value));
+    CHECK((!std::is_convertible<float, neo::float16>::value));
+    CHECK((!std::is_convertible<neo::float_, neo::float16>::value));
+    CHECK((!std::is_convertible<int, neo::bfloat16>::value));
+    CHECK((!std::is_convertible<neo::float16, int>::value));
+    CHECK((!std::is_convertible<neo::float16, neo::int32>::value));
+    CHECK((!std::is_convertible<neo::float16, neo::bfloat16>::value));
+    CHECK((!std::is_convertible<neo::bfloat16, neo::float16>::value));
+    CHECK((explicit_conversion_traits<float, neo::float16>::value));
+    CHECK((explicit_conversion_traits<neo::float_, neo::float16>::value));
+    CHECK((explicit_conversion_traits<neo::float16, int>::value));
+    CHECK((explicit_conversion_traits<neo::float16, neo::int32>::value));
+    CHECK((explicit_conversion_traits<neo::float16, neo::bfloat16>::value));
+
+    neo::float16 const h(neo::float_(-2.75f));
+    neo::float_ const f = h;
+    neo::double_ const d = neo::bfloat16(h);
+
+    CHECK(f == -2.75f);
+    CHECK(d == -2.75);
+    CHECK(static_cast<int>(h) == -2);
+    CHECK(static_cast<neo::int32>(h) == -2);
+}
+
+TEST_CASE("neo::float16 comparisons", "neo::float16")
+{
+    neo::float16 const a(1.5f);
+    neo::float16 const b(-0.25f);
+    neo::float16 const nan(std::numeric_limits<float>::quiet_NaN());
+
+    CHECK(a == a);
+    CHECK(a != b);
+    CHECK(b < a);
+    CHECK(a >= b);
+    CHECK(neo::float16(0.0f) == neo::float16(-0.0f));
+    CHECK(nan != nan);
+    CHECK(!(nan < a));
+}
+
+TEST_CASE("neo::float16 arithmetic is done in float_", "neo::float16")
+{
+    neo::float16 const h(1.5f);
+    neo::bfloat16 const b(-3.0f);
+
+    CHECK((std::is_same<neo::float_, add_traits_t<neo::float16, neo::float16>>::value));
+    CHECK((std::is_same<neo::float_, add_traits_t<neo::float16, float>>::value));
+    CHECK((std::is_same<neo::float_, add_traits_t<neo::float_, neo::bfloat16>>::value));
+    CHECK((std::is_same<neo::double_, add_traits_t<neo::float16, double>>::value));
+    CHECK((std::is_same<neo::double_, add_traits_t<neo::double_, neo::float16>>::value));
+    CHECK((std::is_same<neo::value<bool>, equals_traits_t<neo::float16, float>>::value));
+    CHECK((!add_traits<neo::float16, int>::value));
+    CHECK((!add_traits<neo::float16, neo::int_>::value));
+    CHECK((!add_traits<neo::float16, neo::bfloat16>::value));
+
+    CHECK(h * 2.0f == 3.0f);
+    CHECK(2.0f * h == 3.0f);
+    CHECK(h / 4.0 == 0.375);
+    CHECK(neo::float_(2.0f) + h == 3.5f);
+    CHECK(h - neo::float_(2.0f) == -0.5f);
+    CHECK(b * 1.5f == -4.5f);
+    CHECK(h + h == 3.0f);
+    CHECK(h - neo::float16(0.5f) == 1.0f);
+    CHECK(h / neo::float16(-0.5f) == -3.0f);
+
+    // Results are not rounded to half precision.
+    CHECK(neo::float16(2049.0f) + 1.0f == 2049.0f);
+    CHECK(h * neo::float16(std::ldexp(1.0f, -24)) == std::ldexp(1.5f, -24));
+
+    CHECK(h == 1.5f);
+    CHECK(1.5 == h);
+    CHECK(h != 1.25f);
+    CHECK(h < neo::float_(1.75f));
+    CHECK(neo::float_(1.0f) < h);
+    CHECK(b <= -3.0f);
+    CHECK(h > 1.0);
+    CHECK(h >= neo::double_(1.5));
+    CHECK(!(neo::float16(std::numeric_limits<float>::quiet_NaN()) == std::numeric_limits<float>::quiet_NaN()));
+
+    CHECK(std::sqrt(static_cast<float>(neo::float16(2.25f))) == 1.5f);
+}
+
+TEST_CASE("neo::float16 span conversions", "neo::float16")
+{
+    CHECK(span_conversions_match<neo::float16>());
+    CHECK(span_conversions_match<neo::bfloat16>());
+}
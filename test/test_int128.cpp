@@ -0,0 +1,158 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+using namespace neo_types::operator_traits;
+
+TEST_CASE("neo::mul_high returns the high half of the full product", "neo::int128")
+{
+    std::uint64_t const max64 = std::numeric_limits<std::uint64_t>::max();
+
+    CHECK(neo::mul_high(neo::uint64(max64), neo::uint64(max64)) == max64 - 1);
+    CHECK(neo::mul_high(neo::uint64(std::uint64_t(1) << 63), neo::uint64(std::uint64_t(4))) == 2u);
+    CHECK(neo::mul_high(neo::uint64(std::uint64_t(12345)), neo::uint64(std::uint64_t(67890))) == 0u);
+    CHECK(neo::mul_high(neo::int64(std::int64_t(-1)), neo::int64(std::int64_t(1))) == -1);
+    CHECK(neo::mul_high(neo::int64(std::numeric_limits<std::int64_t>::min()), neo::int64(std::int64_t(-2))) == 1);
+    CHECK(neo::mul_high(neo::uint32(0xffffffffu), neo::uint32(0xffffffffu)) == 0xfffffffeu);
+    CHECK(neo::mul_high(neo::int32(std::int32_t(-2)), neo::int32(std::int32_t(3))) == -1);
+    CHECK(neo::mul_high(neo::ullong(~0ull), neo::ullong(~0ull)) == ~0ull - 1);
+    CHECK(neo::mul_high(neo::llong(-1ll), neo::llong(1ll)) == -1);
+
+    // The portable fallback agrees with the full product.
+    std::uint64_t high;
+    std::uint64_t low;
+    neo::detail::portable_mul_wide(std::int64_t(-3), std::int64_t(0x123456789), high, low);
+    CHECK(high == max64);
+    CHECK(low == std::uint64_t(-3 * 0x123456789ll));
+}
+
+TEST_CASE("neo::full_product widens", "neo::int128")
+{
+    CHECK((std::is_same<decltype(neo::full_product(neo::uint32(), neo::uint32())), neo::uint64>::value));
+    CHECK(neo::full_product(neo::uint32(0xffffffffu), neo::uint32(2u)) == 0x1fffffffeull);
+    CHECK(neo::full_product(neo::int16(std::int16_t(-300)), neo::int16(std::int16_t(300))) == -90000);
+}
+
+#if defined(NEO_DETAIL_INT128)
+
+TEST_CASE("neo::int128 follows the value widening rules", "neo::int128")
+{
+    CHECK((std::is_same<decltype(neo::int64() + neo::int128()), neo::int128>::value));
+    CHECK((std::is_same<decltype(neo::uint128() * neo::uint32()), neo::uint128>::value));
+    CHECK((std::is_convertible<neo::int64, neo::int128>::value));
+    CHECK((!std::is_convertible<neo::uint64, neo::int128>::value));
+    CHECK((std::is_convertible<neo::uint64, neo::uint128>::value));
+    CHECK((!std::is_convertible<neo::int128, neo::int64>::value));
+    CHECK((!std::is_convertible<neo::int128, neo::uint128>::value));
+    CHECK((!std::is_convertible<neo::uint128, neo::int128>::value));
+    CHECK((!std::is_convertible<neo::int64, neo::uint128>::value));
+    CHECK((explicit_conversion_traits<neo::int128, neo::int64>::value));
+    CHECK((!add_traits<neo::int128, neo::uint128>::value));
+    CHECK((!add_traits<neo::int128, neo::double_>::value));
+    CHECK(neo::int128() == 0);
+    CHECK((neo::is_zero_initialized_by_default<neo::uint128>::value));
+}
+
+TEST_CASE("neo::int128 arithmetic", "neo::int128")
+{
+    neo::int128 a = std::int64_t(1) << 62;
+    neo::uint128 b = ~std::uint64_t(0);
+
+    a *= 8;
+    b += std::uint64_t(1);
+    ++b;
+
+    CHECK(a / neo::int128(std::int64_t(1) << 62) == 8);
+    CHECK(a % 7 == 4);
+    CHECK((b >> 64) == 1u);
+    CHECK(static_cast<std::uint64_t>(b) == 1u);
+    CHECK(-a < a);
+}
+
+TEST_CASE("neo::int128 converts to half precision", "neo::int128")
+{
+    using uint128_t = neo::detail::uint128_t;
+
+    uint128_t const tie = (uint128_t(257) << 92);
+
+    CHECK(neo::float16(neo::int128(5)).bits() == neo::float16(5).bits());
+    CHECK(neo::float16(neo::int128(-2048)).bits() == 0xe800u);
+    CHECK(neo::float16(neo::uint128(std::uint64_t(2051))).bits() == neo::float16(2052).bits());
+    CHECK(neo::float16(neo::uint128(neo::detail::numeric_limits<uint128_t>::max())).bits() == 0x7c00u);
+    CHECK(neo::bfloat16(neo::uint128(uint128_t(1) << 100)).bits() == 0x7180u);
+    CHECK(neo::bfloat16(neo::uint128(tie)).bits() == 0x7180u);
+    CHECK(neo::bfloat16(neo::uint128(tie + 1)).bits() == 0x7181u);
+    CHECK(neo::bfloat16(neo::uint128(neo::detail::numeric_limits<uint128_t>::max())).bits() == 0x7f80u);
+    CHECK(neo::bfloat16(neo::int128(neo::detail::numeric_limits<neo::detail::int128_t>::min())).bits() == 0xff00u);
+    CHECK(neo::bfloat16(neo::detail::int128_t(-3)).bits() == 0xc040u);
+}
+
+TEST_CASE("neo::int128 literals", "neo::int128")
+{
+    using namespace neo::literals;
+
+    constexpr neo::uint128 max = 340282366920938463463374607431768211455_nui128;
+    constexpr neo::int128 big = 170141183460469231731687303715884105727_ni128;
+
+    CHECK(max == neo::uint128(neo::detail::numeric_limits<neo::detail::uint128_t>::max()));
+    CHECK(big == neo::int128(neo::detail::numeric_limits<neo::detail::int128_t>::max()));
+    CHECK(18446744073709551616_nui128 == neo::uint128(~std::uint64_t(0)) + neo::uint128(std::uint64_t(1)));
+}
+
+TEST_CASE("neo::full_product of 64-bit integers", "neo::int128")
+{
+    std::uint64_t const max64 = std::numeric_limits<std::uint64_t>::max();
+
+    neo::uint128 const p = neo::full_product(neo::uint64(max64), neo::uint64(max64));
+    neo::int128 const q = neo::full_product(neo::int64(std::int64_t(-5)), neo::int64(std::numeric_limits<std::int64_t>::max()));
+
+    CHECK(static_cast<std::uint64_t>(p >> 64) == max64 - 1);
+    CHECK(static_cast<std::uint64_t>(p) == 1u);
+    CHECK(q < 0);
+    CHECK(q / 5 == -neo::int128(std::numeric_limits<std::int64_t>::max()));
+
+    // long long is distinct from whichever of long and long long int64_t is.
+    unsigned long long const maxll = std::numeric_limits<unsigned long long>::max();
+    neo::uint128 const r = neo::full_product(neo::ullong(maxll), neo::ullong(maxll));
+    neo::int128 const s = neo::full_product(neo::llong(-3ll), neo::llong(1ll << 62));
+
+    CHECK((std::is_same<decltype(neo::full_product(neo::ullong(), neo::ullong())), neo::uint128>::value));
+    CHECK((std::is_same<decltype(neo::full_product(neo::long_(), neo::long_())), neo::int128>::value));
+    CHECK(r == p);
+    CHECK(s == neo::int128(-(1ll << 62)) * 3);
+}
+
+TEST_CASE("neo::int128 is written in decimal", "neo::int128")
+{
+    using namespace neo::literals;
+
+    std::ostringstream s;
+    s << -170141183460469231731687303715884105727_ni128 << ' ' << 18446744073709551616_nui128 << ' ' << neo::int128();
+
+    CHECK(s.str() == "-170141183460469231731687303715884105727 18446744073709551616 0");
+}
+
+TEST_CASE("neo::int128 is padded to the stream width as int is", "neo::int128")
+{
+    std::ostringstream expected;
+    expected << '[' << std::setw(6) << -42 << ']' << '[' << std::left << std::setw(6) << -42 << ']';
+
+    std::ostringstream s;
+    s << '[' << std::setw(6) << neo::int128(-42) << ']' << '[' << std::left << std::setw(6) << neo::int128(-42) << ']';
+
+    CHECK(s.str() == expected.str());
+    CHECK(s.str() == "[   -42][-42   ]");
+
+    std::ostringstream u;
+    u << std::setw(4) << neo::uint128(7u);
+
+    CHECK(u.str() == "   7");
+}
+
+#endif
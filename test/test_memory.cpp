@@ -0,0 +1,212 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct construction_probe
+{
+    static int undefined_count;
+    static int default_count;
+
+    construction_probe() noexcept
+    {
+        ++default_count;
+    }
+
+    construction_probe(neo::undefined_t) noexcept
+    {
+        ++undefined_count;
+    }
+};
+
+int construction_probe::undefined_count = 0;
+int construction_probe::default_count = 0;
+
+} // namespace
+
+TEST_CASE("neo::undefined_allocator leaves neo values undefined", "neo::undefined_allocator")
+{
+    using traits = std::allocator_traits<neo::undefined_allocator<construction_probe>>;
+
+    construction_probe::undefined_count = 0;
+    construction_probe::default_count = 0;
+
+    neo::undefined_allocator<construction_probe> allocator;
+    construction_probe* p = traits::allocate(allocator, 2);
+    traits::construct(allocator, p);
+    traits::construct(allocator, p + 1);
+
+    CHECK(construction_probe::undefined_count == 2);
+    CHECK(construction_probe::default_count == 0);
+
+    traits::destroy(allocator, p + 1);
+    traits::destroy(allocator, p);
+    traits::deallocate(allocator, p, 2);
+
+    neo::undefined_allocator<neo::int_> int_allocator;
+    CHECK(noexcept(int_allocator.construct(static_cast<neo::int_*>(nullptr))));
+}
+
+TEST_CASE("neo::undefined_allocator constructs values from arguments", "neo::undefined_allocator")
+{
+    std::vector<neo::int_, neo::undefined_allocator<neo::int_>> v;
+
+    v.emplace_back(42);
+    v.push_back(7);
+    v.resize(4, 3);
+
+    REQUIRE(v.size() == 4u);
+    CHECK(v[0] == 42);
+    CHECK(v[1] == 7);
+    CHECK(v[2] == 3);
+    CHECK(v[3] == 3);
+}
+
+TEST_CASE("neo::undefined_allocator can resize without initialization", "neo::undefined_allocator")
+{
+    std::vector<neo::int_, neo::undefined_allocator<neo::int_>> v;
+
+    v.resize(1000);
+    REQUIRE(v.size() == 1000u);
+
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = static_cast<int>(i);
+    }
+
+    CHECK(v[999] == 999);
+}
+
+TEST_CASE("neo::undefined_allocator default-initializes other types", "neo::undefined_allocator")
+{
+    std::vector<std::string, neo::undefined_allocator<std::string>> v;
+
+    v.resize(3);
+
+    REQUIRE(v.size() == 3u);
+    CHECK(v[0].empty());
+    CHECK(v[2].empty());
+}
+
+TEST_CASE("neo::undefined_allocator can be rebound", "neo::undefined_allocator")
+{
+    using allocator_t = neo::undefined_allocator<neo::int_>;
+    using rebound_t = std::allocator_traits<allocator_t>::rebind_alloc<neo::double_>;
+
+    CHECK((std::is_same<rebound_t, neo::undefined_allocator<neo::double_>>::value));
+
+    allocator_t a;
+    rebound_t b = a;
+    CHECK(b == rebound_t(a));
+}
+
+TEST_CASE("neo::uninitialized_default_construct_n zero-initializes neo types", "neo::uninitialized_default_construct_n")
+{
+    using storage_t = std::aligned_storage<sizeof(neo::int_) * 16, alignof(neo::int_)>::type;
+
+    storage_t storage;
+    std::memset(&storage, 0xab, sizeof(storage));
+
+    auto p = reinterpret_cast<neo::int_*>(&storage);
+    CHECK(neo::uninitialized_default_construct_n(p, 16) == p + 16);
+
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        CHECK(p[i] == 0);
+    }
+
+    neo::ptr<int> pointers[4];
+    neo::uninitialized_default_construct_n(pointers, 4);
+    CHECK(pointers[3] == nullptr);
+}
+
+TEST_CASE("neo::uninitialized_default_construct_n constructs other types", "neo::uninitialized_default_construct_n")
+{
+    using storage_t = std::aligned_storage<sizeof(std::string) * 3, alignof(std::string)>::type;
+
+    storage_t storage;
+    auto p = reinterpret_cast<std::string*>(&storage);
+    neo::uninitialized_default_construct_n(p, 3);
+
+    CHECK(p[0].empty());
+    CHECK(p[2].empty());
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        p[i].~basic_string();
+    }
+}
+
+TEST_CASE("neo::fill_n assigns every element", "neo::fill_n")
+{
+    neo::int_ a[17];
+
+    CHECK(neo::fill_n(a, 17, -1) == a + 17);
+    CHECK(std::all_of(a, a + 17, [](neo::int_ i) { return bool(i == -1); }));
+
+    CHECK(neo::fill_n(a, 16, 0x01020304) == a + 16);
+    CHECK(std::all_of(a, a + 16, [](neo::int_ i) { return bool(i == 0x01020304); }));
+    CHECK(a[16] == -1);
+
+    neo::fill_n(a + 1, 16, a[0]);
+    CHECK(std::all_of(a, a + 17, [](neo::int_ i) { return bool(i == 0x01020304); }));
+
+    int i = 0, j = 0;
+    neo::ref<int> refs[] = { i, i, i };
+    neo::fill_n(refs, 3, neo::ref<int>(j));
+    CHECK(&refs[2].value() == &j);
+
+    neo::optional_ref<int> optional_refs[3];
+    neo::fill_n(optional_refs, 3, neo::optional_ref<int>(j));
+    CHECK(optional_refs[1] == neo::optional_ref<int>(j));
+}
+
+TEST_CASE("neo::copy_n copies every element", "neo::copy_n")
+{
+    neo::double_ a[] = { 1.0, 2.0, 3.0, 4.0 };
+    neo::double_ b[4];
+
+    CHECK(neo::copy_n(a, 4, b) == b + 4);
+    CHECK(std::equal(a, a + 4, b, [](neo::double_ x, neo::double_ y) { return bool(x == y); }));
+
+    neo::copy_n(a + 1, 3, a);
+    CHECK(a[0] == 2.0);
+    CHECK(a[2] == 4.0);
+
+    std::string s[] = { "a", "b" };
+    std::string t[2];
+    neo::copy_n(s, 2, t);
+    CHECK(t[1] == "b");
+}
+
+TEST_CASE("neo::uninitialized_copy_n and uninitialized_fill_n construct elements", "neo::uninitialized_copy_n")
+{
+    int x = 0;
+    neo::ptr<int> a[] = { &x, nullptr, &x };
+
+    using storage_t = std::aligned_storage<sizeof(a), alignof(neo::ptr<int>)>::type;
+    storage_t storage;
+    auto p = reinterpret_cast<neo::ptr<int>*>(&storage);
+
+    CHECK(neo::uninitialized_copy_n(a, 3, p) == p + 3);
+    CHECK(p[0] == &x);
+    CHECK(p[1] == nullptr);
+
+    CHECK(neo::uninitialized_fill_n(p, 3, a[1]) == p + 3);
+    CHECK(p[2] == nullptr);
+}
+
+TEST_CASE("neo::is_bitwise_copyable", "neo::is_bitwise_copyable")
+{
+    CHECK(neo::is_bitwise_copyable<neo::int_>::value);
+    CHECK(neo::is_bitwise_copyable<neo::ptr<int>>::value);
+    CHECK(neo::is_bitwise_copyable<neo::ref<int>>::value);
+    CHECK(neo::is_bitwise_copyable<neo::optional_ref<int>>::value);
+    CHECK(!neo::is_bitwise_copyable<std::string>::value);
+}
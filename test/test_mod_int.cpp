@@ -0,0 +1,167 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+constexpr std::uint64_t p32 = 998244353u;
+constexpr std::uint64_t p64 = 0xffffffff00000001u;
+
+using m32 = neo::mod_int<p32>;
+using m64 = neo::mod_int<p64>;
+
+std::uint64_t mul_mod(std::uint64_t x, std::uint64_t y, std::uint64_t n)
+{
+    std::uint64_t result = 0;
+    x %= n;
+
+    for (; y != 0; y >>= 1)
+    {
+        if ((y & 1u) != 0)
+        {
+            result = result >= n - x ? result - (n - x) : result + x;
+        }
+
+        x = x >= n - x ? x - (n - x) : x + x;
+    }
+
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("neo::mod_int follows the unsigned conversion rules", "neo::mod_int")
+{
+    CHECK(sizeof(m32) == 4);
+    CHECK(sizeof(m64) == 8);
+    CHECK(sizeof(neo::mod_int<0xffffffffu>) == 4);
+    CHECK((std::is_same<m32::value_type, std::uint32_t>::value));
+    CHECK((std::is_convertible<std::uint32_t, m32>::value));
+    CHECK((std::is_convertible<neo::uint64, m32>::value));
+    CHECK((!std::is_convertible<int, m32>::value));
+    CHECK((!std::is_convertible<neo::int32, m64>::value));
+    CHECK((!std::is_convertible<m32, std::uint32_t>::value));
+    CHECK((!std::is_convertible<m32, neo::mod_int<7>>::value));
+    CHECK((explicit_conversion_traits<int, m32>::value));
+    CHECK((explicit_conversion_traits<m32, neo::uint32>::value));
+    CHECK((!add_traits<m32, int>::value));
+    CHECK((!add_traits<m32, neo::mod_int<7>>::value));
+    CHECK((!equals_traits<m32, neo::mod_int<7>>::value));
+    CHECK((!equals_traits<m32, int>::value));
+    CHECK((std::is_same<decltype(m32() * neo::uint8()), m32>::value));
+
+    CHECK(m32().residue() == 0u);
+    CHECK(m32(p32 + 5u).residue() == 5u);
+    CHECK(m32(-1).residue() == p32 - 1);
+    CHECK(m64(std::int64_t(-5)).residue() == p64 - 5);
+    CHECK(neo::mod_int<7>(neo::int8(std::int8_t(-128))).residue() == 5u);
+    CHECK(static_cast<std::uint32_t>(m32(123u)) == 123u);
+    CHECK(m32(10u) == 10u);
+    CHECK(10u != m32(11u));
+}
+
+TEST_CASE("neo::mod_int arithmetic", "neo::mod_int")
+{
+    m32 a = p32 - 1;
+    m32 const b = 2u;
+
+    CHECK(a + b == 1u);
+    CHECK(b - a == 3u);
+    CHECK(-b == p32 - 2);
+    CHECK(-m32() == 0u);
+    CHECK(a * a == 1u);
+    CHECK(b.pow(23u) == 8388608u);
+    CHECK(b.pow(0u) == 1u);
+    CHECK(b * b.inverse() == 1u);
+    CHECK(m32(3u).pow(p32 - 1) == 1u);
+
+    a += 5u;
+    a -= b;
+    a *= 7u;
+    CHECK(a == 14u);
+
+    // 2^64 - 2^32 + 1 is close enough to 2^64 to overflow a naive sum.
+    m64 const x = p64 - 3;
+    m64 const y = p64 - 2;
+    CHECK(x + y == p64 - 5);
+    CHECK(y - x == 1u);
+    CHECK(x - y == p64 - 1);
+    CHECK((x * y).residue() == 6u);
+    CHECK((x * m64(0x123456789abcdefu)).residue() == mul_mod(p64 - 3, 0x123456789abcdefu, p64));
+    CHECK(m64(7u) * m64(7u).inverse() == 1u);
+
+    // Moduli which need every bit of the storage type.
+    using big32 = neo::mod_int<4294967291u>;
+    using big64 = neo::mod_int<18446744073709551557u>;
+    CHECK((big32(4294967290u) * big32(4294967290u)) == 1u);
+    CHECK((big64(18446744073709551556u) + big64(18446744073709551556u)).residue() == 18446744073709551555u);
+    CHECK((big64(0x123456789abcdefu) * big64(0xfedcba987654321u)).residue() ==
+            mul_mod(0x123456789abcdefu, 0xfedcba987654321u, 18446744073709551557u));
+
+    constexpr m32 c = m32(3u) * m32(5u);
+    CHECK(c == 15u);
+}
+
+TEST_CASE("neo::modulus arithmetic on ordinary residues", "neo::mod_int")
+{
+    neo::modulus<std::uint64_t> const m(neo::uint64(1000000007u));
+    neo::modulus<std::uint32_t> const n(neo::uint32(65537u));
+
+    CHECK(m.get() == 1000000007u);
+    CHECK(m.reduce(neo::uint64(3000000030u)) == 9u);
+    CHECK(m.mul(500000004u, 2u) == 1u);
+    CHECK(m.add(1000000006u, 5u) == 4u);
+    CHECK(m.sub(3u, 5u) == 1000000005u);
+    CHECK(m.pow(2u, 1000000006u) == 1u);
+    CHECK(n.mul(65536u, 65536u) == 1u);
+
+    CHECK_THROWS_AS(neo::modulus<std::uint32_t>(neo::uint32(10u)), std::invalid_argument const&);
+    CHECK_THROWS_AS(neo::modulus<std::uint32_t>(neo::uint32(1u)), std::invalid_argument const&);
+}
+
+TEST_CASE("neo::mod_int span products", "neo::mod_int")
+{
+    std::size_t const count = 1000;
+
+    std::vector<m32> a(count);
+    std::vector<m32> b(count);
+    std::vector<m32> out(count);
+    std::vector<m64> a64(count);
+    std::vector<m64> out64(count);
+    std::vector<neo::uint32> ra(count);
+    std::vector<neo::uint32> rb(count);
+    std::vector<neo::uint32> rout(count);
+
+    neo::modulus<std::uint32_t> const m(neo::uint32(4294967291u));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        a[i] = std::uint64_t(i) * 2654435761u;
+        b[i] = std::uint64_t(i) * 40503u + 7u;
+        a64[i] = std::uint64_t(i) * 0x9e3779b97f4a7c15u;
+        ra[i] = m.reduce(std::uint64_t(i) * 2654435761u);
+        rb[i] = m.reduce(std::uint64_t(count - i) * 0x9e3779b97f4a7c15u);
+    }
+
+    neo::transform_mul(neo::span<m32 const>(a.data(), count), neo::span<m32 const>(b.data(), count), neo::span<m32>(out.data(), count));
+    neo::transform_mul(neo::span<m64 const>(a64.data(), count), neo::span<m64 const>(a64.data(), count), neo::span<m64>(out64.data(), count));
+    neo::transform_mul(neo::span<neo::uint32 const>(ra.data(), count), neo::span<neo::uint32 const>(rb.data(), count), neo::span<neo::uint32>(rout.data(), count), m);
+
+    bool equal = true;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        equal = equal && bool(out[i] == a[i] * b[i]) && bool(out64[i] == a64[i] * a64[i]) &&
+                rout[i].get() == mul_mod(ra[i].get(), rb[i].get(), 4294967291u);
+    }
+
+    CHECK(equal);
+}
@@ -956,6 +956,8 @@ TEST_CASE("neo::ptr", "neo::ptr")
     neo::int_ i[] = { 1, 2, 3, 4, 5 };
     //p = i;
     p = &i[0];
+    CHECK(p < neo::ptr<neo::int_>(&i[1]));
+    CHECK(p <= p);
 
 /*
     CHECK(p);
@@ -0,0 +1,125 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+struct node
+{
+    neo::offset_ptr<node> next;
+    neo::int32 data;
+};
+
+struct base
+{
+    neo::int64 b;
+};
+
+struct other
+{
+    neo::int64 o;
+};
+
+struct derived : other, base
+{
+};
+
+} // namespace
+
+TEST_CASE("neo::offset_ptr is null by default but not trivially relocatable", "neo::offset_ptr")
+{
+    CHECK(sizeof(neo::offset_ptr<int>) == sizeof(int*));
+    CHECK(neo::is_zero_initialized_by_default<neo::offset_ptr<int>>::value);
+    CHECK(!std::is_trivially_copyable<neo::offset_ptr<int>>::value);
+    CHECK(!neo::is_bitwise_copyable<neo::offset_ptr<int>>::value);
+    CHECK(!neo::is_trivially_relocatable<neo::offset_ptr<int>>::value);
+    CHECK(std::is_standard_layout<neo::offset_ptr<int>>::value);
+    CHECK((std::is_convertible<neo::offset_ptr<derived>, neo::offset_ptr<base>>::value));
+    CHECK((!std::is_convertible<neo::offset_ptr<base>, neo::offset_ptr<derived>>::value));
+
+    neo::offset_ptr<int> p;
+    CHECK(!p);
+    CHECK(p == nullptr);
+    CHECK(p.get() == nullptr);
+
+    // Zero-filled memory holds null offset pointers.
+    alignas(neo::offset_ptr<int>) unsigned char zeros[sizeof(neo::offset_ptr<int>)] = {};
+    CHECK(reinterpret_cast<neo::offset_ptr<int> const*>(zeros)->get() == nullptr);
+}
+
+TEST_CASE("neo::offset_ptr copies point to the same object", "neo::offset_ptr")
+{
+    neo::int32 i = 42;
+    neo::offset_ptr<neo::int32> p = &i;
+    CHECK(p.get() == &i);
+    CHECK(*p == 42);
+
+    std::vector<neo::offset_ptr<neo::int32>> v(3, p);
+    v.push_back(p);
+    v.resize(100);
+    CHECK(v[0].get() == &i);
+    CHECK(v[3].get() == &i);
+    CHECK(v[3] == p);
+    CHECK(!v[50]);
+
+    neo::offset_ptr<neo::int32> q;
+    q = v[1];
+    CHECK(q.get() == &i);
+
+    neo::ptr<neo::int32> r = q;
+    CHECK(r == &i);
+
+    derived d;
+    neo::offset_ptr<derived> pd = &d;
+    neo::offset_ptr<base> pb = pd;
+    CHECK(pb.get() == static_cast<base*>(&d));
+    CHECK(pb == pd);
+
+    // A node may point to itself.
+    node n;
+    n.next = &n;
+    CHECK(n.next.get() == &n);
+    CHECK(n.next->next.get() == &n);
+}
+
+TEST_CASE("neo::offset_ptr structures may be moved with their bytes", "neo::offset_ptr")
+{
+    std::size_t const count = 64;
+
+    std::vector<node> nodes(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        nodes[i].next = i + 1 < count ? &nodes[i + 1] : nullptr;
+        nodes[i].data = static_cast<std::int32_t>(i);
+    }
+
+    CHECK(nodes[0].next < nodes[1].next);
+    CHECK(nodes[1].next >= nodes[0].next);
+    CHECK(nodes[0].next != nodes[1].next);
+
+    // Copies the bytes of the whole list elsewhere, as mapping it at another
+    // address would.
+    std::vector<unsigned char> mapping(sizeof(node) * count + alignof(node));
+    void* storage = mapping.data();
+    std::size_t space = mapping.size();
+    node const* copy = static_cast<node const*>(std::align(alignof(node), sizeof(node) * count, storage, space));
+    std::memcpy(storage, static_cast<void const*>(nodes.data()), sizeof(node) * count);
+    nodes.assign(count, node());
+
+    neo::int32 sum;
+    std::size_t length = 0;
+    for (node const* n = copy; n != nullptr; n = n->next)
+    {
+        sum += n->data;
+        ++length;
+    }
+
+    CHECK(length == count);
+    CHECK(sum == 2016);
+}
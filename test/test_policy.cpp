@@ -0,0 +1,131 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+// A user-defined policy which counts the operations it performs.
+struct counting
+{
+    static constexpr bool is_nothrow = true;
+    static int operations;
+
+    template<typename T>
+    static T add(T lhs, T rhs) noexcept
+    {
+        ++operations;
+        return static_cast<T>(lhs + rhs);
+    }
+
+    template<typename T>
+    static T sub(T lhs, T rhs) noexcept
+    {
+        ++operations;
+        return static_cast<T>(lhs - rhs);
+    }
+
+    template<typename T>
+    static T mul(T lhs, T rhs) noexcept
+    {
+        ++operations;
+        return static_cast<T>(lhs * rhs);
+    }
+
+    template<typename T>
+    static T div(T lhs, T rhs) noexcept
+    {
+        ++operations;
+        return static_cast<T>(lhs / rhs);
+    }
+
+    template<typename T>
+    static T mod(T lhs, T rhs) noexcept
+    {
+        ++operations;
+        return static_cast<T>(lhs % rhs);
+    }
+
+    template<typename T>
+    static T neg(T x) noexcept
+    {
+        ++operations;
+        return static_cast<T>(-x);
+    }
+};
+
+int counting::operations = 0;
+
+template<typename T>
+constexpr bool is_nothrow_add()
+{
+    return noexcept(std::declval<T>() + std::declval<T>()) && noexcept(std::declval<T&>() += std::declval<T>());
+}
+
+} // namespace
+
+TEST_CASE("neo::value defaults to the unchecked policy", "neo::policy")
+{
+    CHECK((std::is_same<neo::value<int>, neo::value<int, neo::policy::unchecked>>::value));
+    CHECK((std::is_same<neo::int32, neo::integers<neo::policy::unchecked>::int32>::value));
+    CHECK(sizeof(neo::checked<std::int8_t>) == 1);
+    CHECK(sizeof(neo::saturating<std::int64_t>) == 8);
+}
+
+TEST_CASE("neo::value operators dispatch through the policy", "neo::policy")
+{
+    using int32 = neo::value<std::int32_t, counting>;
+
+    counting::operations = 0;
+
+    int32 a = 6;
+    int32 b = 3;
+    int32 c = (a + b) * (a - b) / -b % a;
+    ++c;
+    c--;
+    c += a;
+
+    CHECK(c == 3);
+    CHECK(counting::operations == 9);
+}
+
+TEST_CASE("neo::integers selects the policy of every alias", "neo::policy")
+{
+    using checked_ints = neo::integers<neo::policy::checked>;
+    using wrapping_ints = neo::integers<neo::policy::wrapping>;
+
+    CHECK((std::is_same<checked_ints::int16, neo::checked<std::int16_t>>::value));
+    CHECK((std::is_same<checked_ints::uintptr, neo::checked<std::uintptr_t>>::value));
+    CHECK((std::is_same<wrapping_ints::int_fast32, neo::wrapping<std::int_fast32_t>>::value));
+    CHECK((std::is_convertible<checked_ints::int16, checked_ints::int32>::value));
+    CHECK((!add_traits<checked_ints::int32, wrapping_ints::int32>::value));
+}
+
+TEST_CASE("policies give operators the right exception specification", "neo::policy")
+{
+    CHECK(is_nothrow_add<neo::value<int>>());
+    CHECK(is_nothrow_add<neo::wrapping<int>>());
+    CHECK(is_nothrow_add<neo::saturating<int>>());
+    CHECK(is_nothrow_add<neo::trapping<int>>());
+    CHECK(!is_nothrow_add<neo::checked<int>>());
+}
+
+TEST_CASE("neo::trapping computes the same results as checked", "neo::policy")
+{
+    neo::trapping<std::int16_t> a = std::int16_t(-300);
+    neo::trapping<std::int16_t> b = std::int16_t(7);
+
+    CHECK((a + b) == -293);
+    CHECK((a - b) == -307);
+    CHECK((a * b) == -2100);
+    CHECK((a / b) == -42);
+    CHECK((a % b) == -6);
+    CHECK(-a == 300);
+    CHECK((!add_traits<neo::trapping<int>, neo::checked<int>>::value));
+}
@@ -0,0 +1,162 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+template<typename T1, typename T2, typename = void>
+struct div_traits : std::false_type
+{
+};
+
+template<typename T1, typename T2>
+struct div_traits<T1, T2, decltype(void(std::declval<T1>() / std::declval<T2>()))> : std::true_type
+{
+};
+
+template<typename T1, typename T2, typename = void>
+struct mod_traits : std::false_type
+{
+};
+
+template<typename T1, typename T2>
+struct mod_traits<T1, T2, decltype(void(std::declval<T1>() % std::declval<T2>()))> : std::true_type
+{
+};
+
+} // namespace
+
+TEST_CASE("neo::ranged picks the smallest storage type", "neo::ranged")
+{
+    CHECK((std::is_same<neo::ranged<0, 255>::value_type, std::uint8_t>::value));
+    CHECK((std::is_same<neo::ranged<-128, 127>::value_type, std::int8_t>::value));
+    CHECK((std::is_same<neo::ranged<0, 510>::value_type, std::uint16_t>::value));
+    CHECK((std::is_same<neo::ranged<-1, 255>::value_type, std::int16_t>::value));
+    CHECK((std::is_same<neo::ranged<0, 65536>::value_type, std::uint32_t>::value));
+    CHECK((std::is_same<neo::ranged<-1, std::numeric_limits<std::int32_t>::max() + 1ll>::value_type, std::int64_t>::value));
+    CHECK(sizeof(neo::ranged<0, 255>) == 1);
+    CHECK((neo::ranged<3, 7>::lower_bound == 3));
+    CHECK((neo::ranged<3, 7>::upper_bound == 7));
+}
+
+TEST_CASE("neo::ranged is zero or lower bound initialized", "neo::ranged")
+{
+    CHECK((neo::ranged<-5, 5>() == 0));
+    CHECK((neo::ranged<3, 7>() == 3));
+}
+
+TEST_CASE("neo::ranged arithmetic computes result bounds", "neo::ranged")
+{
+    using byte = neo::ranged<0, 255>;
+    using offset = neo::ranged<-3, 2>;
+
+    byte const a = std::uint8_t(200);
+    byte const b = std::uint8_t(100);
+    offset const c(-3);
+    neo::ranged<2, 4> const d(4);
+
+    CHECK((std::is_same<decltype(a + b), neo::ranged<0, 510>>::value));
+    CHECK((std::is_same<decltype(a - b), neo::ranged<-255, 255>>::value));
+    CHECK((std::is_same<decltype(a * c), neo::ranged<-765, 510>>::value));
+    CHECK((std::is_same<decltype(a / d), neo::ranged<0, 127>>::value));
+    CHECK((std::is_same<decltype(c / d), neo::ranged<-1, 1>>::value));
+    CHECK((std::is_same<decltype(a % d), neo::ranged<0, 3>>::value));
+    CHECK((std::is_same<decltype(c % d), neo::ranged<-3, 2>>::value));
+    CHECK((std::is_same<decltype(-c), neo::ranged<-2, 3>>::value));
+
+    CHECK((a + b) == 300);
+    CHECK((b - a) == -100);
+    CHECK((a * c) == -600);
+    CHECK((a / d) == 50);
+    CHECK((c / d) == 0);
+    CHECK((neo::ranged<0, 255>(std::uint8_t(203)) % d) == 3);
+    CHECK((c % d) == -3);
+    CHECK(-c == 3);
+}
+
+TEST_CASE("neo::ranged division requires a divisor range excluding zero", "neo::ranged")
+{
+    CHECK((div_traits<neo::ranged<0, 10>, neo::ranged<1, 10>>::value));
+    CHECK((div_traits<neo::ranged<0, 10>, neo::ranged<-10, -1>>::value));
+    CHECK((!div_traits<neo::ranged<0, 10>, neo::ranged<0, 10>>::value));
+    CHECK((!mod_traits<neo::ranged<0, 10>, neo::ranged<-1, 1>>::value));
+}
+
+TEST_CASE("neo::ranged converts implicitly to types which hold its range", "neo::ranged")
+{
+    using byte = neo::ranged<0, 255>;
+
+    CHECK((std::is_convertible<byte, std::uint8_t>::value));
+    CHECK((std::is_convertible<byte, int>::value));
+    CHECK((std::is_convertible<byte, neo::uint8>::value));
+    CHECK((std::is_convertible<byte, neo::int16>::value));
+    CHECK((std::is_convertible<byte, neo::ranged<-1, 300>>::value));
+    CHECK((!std::is_convertible<byte, std::int8_t>::value));
+    CHECK((!std::is_convertible<byte, neo::int8>::value));
+    CHECK((!std::is_convertible<byte, neo::ranged<0, 100>>::value));
+    CHECK((!std::is_convertible<neo::ranged<-1, 1>, unsigned>::value));
+    CHECK((!std::is_convertible<byte, bool>::value));
+    CHECK((explicit_conversion_traits<byte, std::int8_t>::value));
+    CHECK((explicit_conversion_traits<byte, neo::ranged<0, 100>>::value));
+
+    neo::int32 const x = byte(std::uint8_t(200)) + byte(std::uint8_t(100));
+    neo::uint16 const y = byte(std::uint8_t(200)) * byte(std::uint8_t(100));
+
+    CHECK(x == 300);
+    CHECK(y == 20000u);
+}
+
+TEST_CASE("neo::ranged converts implicitly from types within its range", "neo::ranged")
+{
+    CHECK((std::is_convertible<std::uint8_t, neo::ranged<0, 255>>::value));
+    CHECK((std::is_convertible<neo::int8, neo::ranged<-200, 200>>::value));
+    CHECK((!std::is_convertible<int, neo::ranged<0, 255>>::value));
+    CHECK((!std::is_convertible<neo::uint16, neo::ranged<0, 255>>::value));
+    CHECK((explicit_conversion_traits<int, neo::ranged<0, 255>>::value));
+    CHECK((explicit_conversion_traits<neo::uint16, neo::ranged<0, 255>>::value));
+
+    neo::ranged<-200, 200> const a = neo::int8(std::int8_t(-100));
+    neo::ranged<0, 255> const b(neo::uint16(std::uint16_t(42)));
+
+    CHECK(a == -100);
+    CHECK(b == 42);
+}
+
+TEST_CASE("neo::ranged comparisons are correct for mixed signedness", "neo::ranged")
+{
+    neo::ranged<-10, 10> const a(-1);
+
+    CHECK(a < 0u);
+    CHECK(a != std::numeric_limits<unsigned>::max());
+    CHECK(std::numeric_limits<std::uint64_t>::max() > a);
+    CHECK((a < neo::ranged<0, 5>()));
+    CHECK(a >= -1);
+    CHECK(a <= neo::ranged_constant<-1>());
+}
+
+TEST_CASE("neo::ranged clamp produces the nearest value in range", "neo::ranged")
+{
+    using percent = neo::ranged<0, 100>;
+
+    CHECK(percent::clamp(-5) == 0);
+    CHECK(percent::clamp(42) == 42);
+    CHECK(percent::clamp(std::numeric_limits<std::uint64_t>::max()) == 100);
+    CHECK((percent::clamp(neo::ranged<-200, 200>(150)) == 100));
+}
+
+TEST_CASE("neo::ranged is usable in constant expressions", "neo::ranged")
+{
+    constexpr neo::ranged<0, 255> a = std::uint8_t(255);
+    constexpr auto b = a + a + neo::ranged_constant<1>();
+
+    static_assert(decltype(b)::upper_bound == 511, "");
+    CHECK(b == 511);
+}
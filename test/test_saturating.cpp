@@ -0,0 +1,254 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+using neo::cpu::isa;
+
+std::vector<isa> supported_isas()
+{
+    std::vector<isa> isas;
+
+    for (int i = 0; i <= static_cast<int>(neo::cpu::detected_isa()); ++i)
+    {
+        isas.push_back(static_cast<isa>(i));
+    }
+
+    return isas;
+}
+
+template<typename Kernel, typename... Args>
+void run(isa i, Args... args)
+{
+    neo::detail::dispatch<Kernel>::template select<Args...>(i)(args...);
+}
+
+template<typename T>
+T clamp(long long x)
+{
+    return static_cast<T>(x < std::numeric_limits<T>::min() ? std::numeric_limits<T>::min() :
+            x > std::numeric_limits<T>::max() ? std::numeric_limits<T>::max() : x);
+}
+
+// Compares saturating arithmetic with clamped wide arithmetic for every pair
+// of operands of an 8-bit type.
+template<typename T>
+bool matches_clamped_arithmetic()
+{
+    using neo::policy::saturating;
+
+    for (int i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); ++i)
+    {
+        for (int j = std::numeric_limits<T>::min(); j <= std::numeric_limits<T>::max(); ++j)
+        {
+            T const x = static_cast<T>(i);
+            T const y = static_cast<T>(j);
+
+            if (saturating::add(x, y) != clamp<T>(i + j) ||
+                saturating::sub(x, y) != clamp<T>(i - j) ||
+                saturating::mul(x, y) != clamp<T>(i * j))
+            {
+                return false;
+            }
+
+            if (j != 0 && saturating::div(x, y) != clamp<T>(i / j))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Runs the saturating transform kernels on every instruction set and checks
+// each element against clamped wide arithmetic. The operands pair 256 values
+// spread evenly over the range of T, so that every lane both saturates and
+// does not.
+template<typename T>
+bool kernels_match_clamped_arithmetic()
+{
+    using neo::detail::transform_kernel;
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    std::size_t const count = 256 * 256 + 5;
+    unsigned_type const step = std::numeric_limits<unsigned_type>::max() / 255;
+
+    std::vector<T> a(count);
+    std::vector<T> b(count);
+    std::vector<T> out(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        a[i] = static_cast<T>(static_cast<unsigned_type>(i % 256 * step));
+        b[i] = static_cast<T>(static_cast<unsigned_type>(i / 256 * step));
+    }
+
+    for (isa target : supported_isas())
+    {
+        run<transform_kernel<T, neo::detail::saturating_add_op>>(target, a.data(), b.data(), out.data(), count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (out[i] != clamp<T>(static_cast<long long>(a[i]) + b[i]))
+            {
+                return false;
+            }
+        }
+
+        run<transform_kernel<T, neo::detail::saturating_sub_op>>(target, a.data(), b.data(), out.data(), count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (out[i] != clamp<T>(static_cast<long long>(a[i]) - b[i]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename A, typename B, typename Out, typename = void>
+struct transform_mul_traits : std::false_type
+{
+};
+
+template<typename A, typename B, typename Out>
+struct transform_mul_traits<A, B, Out, neo::detail::void_t<decltype(neo::transform_mul(
+    std::declval<neo::span<A>>(), std::declval<neo::span<B>>(), std::declval<neo::span<Out>>()))>
+> : std::true_type
+{
+};
+
+} // namespace
+
+TEST_CASE("neo::saturating clamps instead of wrapping", "neo::saturating")
+{
+    neo::saturating<std::uint8_t> a = std::uint8_t(200);
+    neo::saturating<std::uint8_t> b = std::uint8_t(100);
+
+    CHECK((a + b) == 255u);
+    CHECK((b - a) == 0u);
+    CHECK((a * b) == 255u);
+    CHECK(-a == 0u);
+    CHECK((std::is_same<decltype(a + b), neo::saturating<std::uint8_t>>::value));
+
+    neo::saturating<std::int32_t> const max = std::numeric_limits<std::int32_t>::max();
+    neo::saturating<std::int32_t> const min = std::numeric_limits<std::int32_t>::min();
+
+    CHECK((max + 1) == max);
+    CHECK((min - 1) == min);
+    CHECK((max * -2) == min);
+    CHECK((min * min) == max);
+    CHECK((min / -1) == max);
+    CHECK((min % -1) == 0);
+    CHECK(-min == max);
+}
+
+TEST_CASE("neo::saturating saturates at the range of the wider type", "neo::saturating")
+{
+    neo::saturating<std::int8_t> a = std::int8_t(100);
+    neo::saturating<std::int16_t> b = std::int16_t(100);
+
+    CHECK((a + a) == 127);
+    CHECK((a + b) == 200);
+    CHECK((std::is_same<decltype(a + b), neo::saturating<std::int16_t>>::value));
+}
+
+TEST_CASE("neo::saturating saturates compound assignment and increment", "neo::saturating")
+{
+    neo::saturating<std::uint16_t> a = std::uint16_t(65534);
+
+    ++a;
+    ++a;
+    CHECK(a == 65535u);
+    a += std::uint16_t(10);
+    CHECK(a == 65535u);
+    a = std::uint16_t(1);
+    a--;
+    a--;
+    CHECK(a == 0u);
+    a -= std::uint16_t(1);
+    CHECK(a == 0u);
+}
+
+TEST_CASE("neo::saturating matches clamped arithmetic", "neo::saturating")
+{
+    CHECK(matches_clamped_arithmetic<std::int8_t>());
+    CHECK(matches_clamped_arithmetic<std::uint8_t>());
+}
+
+TEST_CASE("neo::saturating does not mix with other policies", "neo::saturating")
+{
+    CHECK((!add_traits<neo::saturating<int>, neo::value<int>>::value));
+    CHECK((!add_traits<neo::saturating<int>, neo::checked<int>>::value));
+    CHECK((!std::is_convertible<neo::value<int>, neo::saturating<int>>::value));
+    CHECK((explicit_conversion_traits<neo::value<int>, neo::saturating<int>>::value));
+    CHECK((std::is_convertible<neo::saturating<std::int16_t>, neo::saturating<std::int32_t>>::value));
+    CHECK((!std::is_convertible<neo::saturating<std::int32_t>, neo::saturating<std::int16_t>>::value));
+}
+
+TEST_CASE("saturating span kernels match scalar code on every instruction set", "neo::saturating")
+{
+    CHECK(kernels_match_clamped_arithmetic<std::uint8_t>());
+    CHECK(kernels_match_clamped_arithmetic<std::int8_t>());
+    CHECK(kernels_match_clamped_arithmetic<std::uint16_t>());
+    CHECK(kernels_match_clamped_arithmetic<std::int16_t>());
+    CHECK(kernels_match_clamped_arithmetic<std::uint32_t>());
+    CHECK(kernels_match_clamped_arithmetic<std::int32_t>());
+}
+
+TEST_CASE("transforms of saturating spans saturate", "neo::saturating")
+{
+    std::vector<neo::saturating<std::uint8_t>> a(100, std::uint8_t(200));
+    std::vector<neo::saturating<std::uint8_t>> b(100, std::uint8_t(100));
+    std::vector<neo::saturating<std::uint8_t>> out(100);
+
+    neo::transform_add(neo::span<neo::saturating<std::uint8_t> const>(a),
+            neo::span<neo::saturating<std::uint8_t> const>(b), out);
+    CHECK(out[0] == 255u);
+    CHECK(out[99] == 255u);
+
+    neo::transform_sub(neo::span<neo::saturating<std::uint8_t> const>(b),
+            neo::span<neo::saturating<std::uint8_t> const>(a), out);
+    CHECK(out[0] == 0u);
+    CHECK(out[99] == 0u);
+
+    CHECK((!transform_mul_traits<neo::saturating<std::uint8_t>, neo::saturating<std::uint8_t>, neo::saturating<std::uint8_t>>::value));
+    CHECK((!transform_mul_traits<neo::saturating<std::uint8_t>, neo::uint8, neo::uint8>::value));
+    CHECK((transform_mul_traits<neo::uint8, neo::uint8, neo::uint8>::value));
+}
+
+#if defined(NEO_DETAIL_INT128)
+
+TEST_CASE("neo::saturating supports 128-bit integers", "neo::saturating")
+{
+    using int128_t = neo::detail::int128_t;
+    using uint128_t = neo::detail::uint128_t;
+
+    neo::saturating<int128_t> const max = neo::detail::numeric_limits<int128_t>::max();
+    neo::saturating<int128_t> const min = neo::detail::numeric_limits<int128_t>::min();
+    neo::saturating<int128_t> const a = int128_t(1) << 100;
+
+    CHECK((a + a) == neo::saturating<int128_t>(int128_t(1) << 101));
+    CHECK((a * a) == max);
+    CHECK((a * -a) == min);
+    CHECK((max + 1) == max);
+    CHECK((min - 1) == min);
+    CHECK((min / -1) == max);
+    CHECK(-min == max);
+    CHECK((neo::saturating<uint128_t>(uint128_t(0)) - 1u) == 0u);
+}
+
+#endif
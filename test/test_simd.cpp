@@ -0,0 +1,263 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+template<typename T, std::size_t N>
+bool lanes_equal(neo::simd<T, N> const& v, T const (&expected)[N])
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (v[i].get() != expected[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("neo::simd is zero-initialized by default", "neo::simd")
+{
+    neo::simd<int, 4> v;
+
+    CHECK(v[0] == 0);
+    CHECK(v[3] == 0);
+    CHECK(v.size() == 4u);
+}
+
+TEST_CASE("neo::simd loads, stores and broadcasts", "neo::simd")
+{
+    neo::int32 in[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    neo::int32 out[8];
+
+    auto v = neo::simd<std::int32_t, 8>::load(in);
+    v.store(out);
+
+    CHECK(out[0] == 1);
+    CHECK(out[7] == 8);
+
+    neo::simd<float, 4> f = 2.5f;
+    CHECK(f[3] == 2.5f);
+}
+
+TEST_CASE("neo::simd arithmetic matches value arithmetic in every lane", "neo::simd")
+{
+    SECTION("for integers")
+    {
+        std::int32_t a[4] = { 1, -2, 3, 100000 };
+        std::int32_t b[4] = { 5, 6, -7, 100000 };
+        auto x = neo::simd<std::int32_t, 4>::load(a);
+        auto y = neo::simd<std::int32_t, 4>::load(b);
+
+        CHECK(lanes_equal(x + y, { 6, 4, -4, 200000 }));
+        CHECK(lanes_equal(x - y, { -4, -8, 10, 0 }));
+        CHECK(lanes_equal(x * y, { 5, -12, -21, 1410065408 }));
+        CHECK(lanes_equal(y / x, { 5, -3, -2, 1 }));
+        CHECK(lanes_equal(y % x, { 0, 0, -1, 0 }));
+        CHECK(lanes_equal(neo::min(x, y), { 1, -2, -7, 100000 }));
+        CHECK(lanes_equal(neo::max(x, y), { 5, 6, 3, 100000 }));
+        CHECK(lanes_equal(-x, { -1, 2, -3, -100000 }));
+        CHECK(neo::reduce_add(x) == 100002);
+    }
+
+    SECTION("for every integer width")
+    {
+        neo::simd<std::int8_t, 16> i8 = std::int8_t(-3);
+        neo::simd<std::uint16_t, 8> u16 = std::uint16_t(40000);
+        neo::simd<std::uint64_t, 2> u64 = std::uint64_t(1) << 40;
+
+        CHECK((i8 * i8)[15] == 9);
+        CHECK(neo::min(i8, neo::simd<std::int8_t, 16>(std::int8_t(2)))[0] == -3);
+        CHECK(neo::max(u16, neo::simd<std::uint16_t, 8>(std::uint16_t(2)))[7] == 40000u);
+        CHECK((u64 * u64)[1] == 0u);
+        CHECK((u64 + u64)[0] == std::uint64_t(1) << 41);
+    }
+
+    SECTION("for floating point")
+    {
+        double a[4] = { 1.0, 2.0, 3.0, 4.0 };
+        auto x = neo::simd<double, 4>::load(a);
+
+        CHECK(lanes_equal(x * 2.0 + 1.0, { 3.0, 5.0, 7.0, 9.0 }));
+        CHECK(lanes_equal(1.0 / x, { 1.0, 0.5, 1.0 / 3.0, 0.25 }));
+        CHECK(neo::reduce_add(x) == 10.0);
+    }
+
+    SECTION("with compound assignment")
+    {
+        neo::simd<std::uint32_t, 4> v = 1u;
+
+        v += 2u;
+        v *= neo::simd<std::uint16_t, 4>(std::uint16_t(3));
+        v <<= 2;
+        v |= 1u;
+
+        CHECK(v[0] == 37u);
+    }
+}
+
+TEST_CASE("neo::simd does not promote integer lanes", "neo::simd")
+{
+    neo::simd<unsigned char, 16> a = static_cast<unsigned char>(200);
+    auto b = a + a;
+
+    CHECK((std::is_same<decltype(b), neo::simd<unsigned char, 16>>::value));
+    CHECK(b[0] == 144u);
+    CHECK((a << 1)[15] == 144u);
+    CHECK((~a)[0] == 55u);
+    CHECK(((a & a) ^ a)[0] == 0u);
+}
+
+TEST_CASE("neo::simd widens mixed lane types like value", "neo::simd")
+{
+    using i16 = neo::simd<std::int16_t, 8>;
+    using i32 = neo::simd<std::int32_t, 8>;
+
+    CHECK((std::is_same<add_traits_t<i16, i32>, i32>::value));
+    CHECK((std::is_same<add_traits_t<i32, i16>, i32>::value));
+    CHECK((std::is_same<add_traits_t<i16, neo::int32>, i32>::value));
+    CHECK((std::is_same<add_traits_t<std::int8_t, i16>, i16>::value));
+
+    i16 a = std::int16_t(30000);
+    i32 b = 1;
+    CHECK((a + b)[0] == 30001);
+}
+
+TEST_CASE("neo::simd follows value conversion rules", "neo::simd")
+{
+    using i16 = neo::simd<std::int16_t, 8>;
+    using i32 = neo::simd<std::int32_t, 8>;
+    using u32 = neo::simd<std::uint32_t, 8>;
+    using f32 = neo::simd<float, 8>;
+
+    // no implicit narrowing
+    CHECK((implicit_conversion_traits<i16, i32>::value));
+    CHECK((!std::is_convertible<i32, i16>::value));
+    CHECK((explicit_conversion_traits<i32, i16>::value));
+    CHECK((implicit_conversion_traits<std::int16_t, i32>::value));
+    CHECK((!implicit_conversion_traits<std::int64_t, i32>::value));
+
+    // no signed/unsigned or integer/floating-point mixing
+    CHECK((!add_traits<i32, u32>::value));
+    CHECK((!add_traits<i32, unsigned>::value));
+    CHECK((!add_traits<f32, i32>::value));
+    CHECK((!std::is_convertible<u32, i32>::value));
+    CHECK((explicit_conversion_traits<u32, i32>::value));
+
+    // no bitwise operations on signed lanes
+    CHECK((bitand_traits<u32, u32>::value));
+    CHECK((!bitand_traits<i32, i32>::value));
+    CHECK((!bitand_traits<f32, f32>::value));
+
+    i32 a = neo::simd_cast<std::int32_t>(u32(7u));
+    CHECK(a[0] == 7);
+}
+
+TEST_CASE("neo::simd comparisons produce masks", "neo::simd")
+{
+    float a[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    auto x = neo::simd<float, 4>::load(a);
+
+    auto m = x < 2.5f;
+    CHECK(m[0] == true);
+    CHECK(m[3] == false);
+    CHECK(neo::any(m) == true);
+    CHECK(neo::all(m) == false);
+    CHECK(neo::none(x > 5.0f) == true);
+    CHECK(neo::all(x == x) == true);
+    CHECK(neo::all(m || !m) == true);
+
+    auto y = neo::select(m, x, neo::simd<float, 4>(0.0f));
+    CHECK(y[1] == 2.0f);
+    CHECK(y[2] == 0.0f);
+}
+
+TEST_CASE("neo::simd supports sizes without a native register", "neo::simd")
+{
+    neo::simd<short, 3> a = short(2);
+    neo::simd<short, 3> b = short(3);
+
+    CHECK((a * b)[2] == 6);
+    CHECK((std::is_same<neo::simd<short, 3>::native_type, neo::detail::simd_array<short, 3>>::value));
+}
+
+TEST_CASE("neo::simd integer lanes wrap with and without a native register", "neo::simd")
+{
+    int const max = std::numeric_limits<int>::max();
+    int const min = std::numeric_limits<int>::min();
+
+    neo::simd<int, 3> a = max;
+    neo::simd<int, 4> b = max;
+
+    CHECK((a + 1)[2] == min);
+    CHECK((b + 1)[3] == min);
+    CHECK((-neo::simd<int, 3>(min))[0] == min);
+    CHECK((neo::simd<short, 3>(short(-32768)) * short(-1))[1] == -32768);
+    CHECK(neo::reduce_add(a) == max - 2);
+    CHECK(neo::reduce_add(b) == -4);
+
+    neo::simd<unsigned, 3> u = 1u;
+    neo::simd<unsigned, 4> v = 1u;
+    neo::simd<std::uint8_t, 3> w = std::uint8_t(1);
+
+    CHECK((u << 32)[0] == 0u);
+    CHECK((v << 32)[0] == 0u);
+    CHECK((u << 31)[0] == 0x80000000u);
+    CHECK((w << 8)[0] == 0u);
+    CHECK(((u << 31) >> 32)[0] == 0u);
+
+    // Negative counts, and counts that do not fit in an int, also shift every
+    // bit out.
+    CHECK((w << -1)[0] == 0u);
+    CHECK((w >> -1)[0] == 0u);
+    CHECK((u << -1)[0] == 0u);
+    CHECK((v >> -1)[0] == 0u);
+    CHECK((w << ((std::uint64_t(1) << 32) + 1))[0] == 0u);
+    CHECK((v << ((std::uint64_t(1) << 32) + 1))[0] == 0u);
+    CHECK((u >> std::int64_t(-1))[1] == 0u);
+}
+
+namespace
+{
+
+// Whether a simd is held in the portable array fallback. Overloads are used
+// rather than std::is_same, which would drop the attributes of the register
+// types with a warning.
+template<typename T, std::size_t N>
+bool is_array_fallback(neo::detail::simd_array<T, N> const*)
+{
+    return true;
+}
+
+bool is_array_fallback(void const*)
+{
+    return false;
+}
+
+template<typename T>
+bool has_native_register()
+{
+    return !is_array_fallback(static_cast<typename neo::simd<T>::native_type const*>(nullptr));
+}
+
+} // namespace
+
+TEST_CASE("neo::simd defaults to a native register", "neo::simd")
+{
+#if defined(NEO_DETAIL_SIMD_SSE2) || defined(NEO_DETAIL_SIMD_NEON)
+    CHECK(has_native_register<int>());
+    CHECK(has_native_register<float>());
+    CHECK(has_native_register<std::uint8_t>());
+#endif
+}
@@ -0,0 +1,78 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <array>
+#include <vector>
+
+TEST_CASE("neo::span is constructed", "neo::span")
+{
+    neo::int_ a[4] = { 1, 2, 3, 4 };
+
+    SECTION("empty")
+    {
+        neo::span<neo::int_> s;
+
+        CHECK(s.empty());
+        CHECK(s.size() == 0u);
+        CHECK(s.begin() == s.end());
+    }
+
+    SECTION("from a pointer and size")
+    {
+        neo::span<neo::int_> s(a + 1, 2);
+
+        CHECK(s.data() == a + 1);
+        CHECK(s.size() == 2u);
+        CHECK(s[1] == 3);
+    }
+
+    SECTION("from an array")
+    {
+        neo::span<neo::int_> s = a;
+
+        CHECK(s.data() == a);
+        CHECK(s.size() == 4u);
+    }
+
+    SECTION("from a container")
+    {
+        std::vector<neo::int_> v(3);
+        neo::vector<neo::int_> nv(5);
+        std::array<neo::int_, 2> const ca = { { 1, 2 } };
+
+        neo::span<neo::int_> s = v;
+        neo::span<neo::int_ const> ns = nv;
+        neo::span<neo::int_ const> cs = ca;
+
+        CHECK(s.size() == 3u);
+        CHECK(ns.size() == 5u);
+        CHECK(cs.data() == ca.data());
+    }
+
+    SECTION("from a span of non-const elements")
+    {
+        neo::span<neo::int_> s = a;
+        neo::span<neo::int_ const> cs = s;
+
+        CHECK(cs.data() == a);
+        CHECK(cs.size() == 4u);
+    }
+}
+
+TEST_CASE("neo::span preserves constness", "neo::span")
+{
+    CHECK((std::is_convertible<neo::span<neo::int_>, neo::span<neo::int_ const>>::value));
+    CHECK((!std::is_convertible<neo::span<neo::int_ const>, neo::span<neo::int_>>::value));
+    CHECK((!std::is_convertible<std::vector<neo::int_> const&, neo::span<neo::int_>>::value));
+    CHECK((!std::is_convertible<neo::span<neo::short_>, neo::span<neo::int_ const>>::value));
+}
+
+TEST_CASE("neo::span::subspan views part of a span", "neo::span")
+{
+    neo::int_ a[4] = { 1, 2, 3, 4 };
+    neo::span<neo::int_> s = neo::span<neo::int_>(a).subspan(1, 2);
+
+    CHECK(s.size() == 2u);
+    CHECK(s[0] == 2);
+    CHECK(s[1] == 3);
+}
@@ -0,0 +1,122 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+
+// A node which holds a tagged pointer to its own (incomplete) type.
+struct node
+{
+    neo::tagged_ptr<node, 2> next;
+    neo::int32 data;
+};
+
+// The layout which tagged pointers replace.
+struct flagged
+{
+    neo::ptr<flagged> next;
+    neo::bool_ flag;
+};
+
+struct base
+{
+    neo::int64 b;
+};
+
+struct other
+{
+    neo::int64 o;
+};
+
+struct derived : other, base
+{
+};
+
+} // namespace
+
+TEST_CASE("neo::tagged_ptr is the size of a pointer", "neo::tagged_ptr")
+{
+    CHECK(sizeof(neo::tagged_ptr<int, 2>) == sizeof(int*));
+    CHECK(sizeof(neo::tagged_ptr<node, 2>) * 2 == sizeof(flagged));
+    CHECK((std::is_trivially_copyable<neo::tagged_ptr<int, 2>>::value));
+    CHECK((neo::is_zero_initialized_by_default<neo::tagged_ptr<int, 2>>::value));
+    CHECK((neo::is_trivially_relocatable<neo::tagged_ptr<int, 2>>::value));
+    CHECK((std::is_convertible<neo::tagged_ptr<derived, 3>, neo::tagged_ptr<base, 3>>::value));
+    CHECK((!std::is_convertible<neo::tagged_ptr<base, 3>, neo::tagged_ptr<derived, 3>>::value));
+    CHECK((!std::is_convertible<neo::tagged_ptr<int, 2>, neo::tagged_ptr<int, 1>>::value));
+}
+
+TEST_CASE("neo::tagged_ptr stores a tag alongside the pointer", "neo::tagged_ptr")
+{
+    neo::tagged_ptr<node, 2> p;
+
+    CHECK(!p);
+    CHECK(p == nullptr);
+    CHECK(p.tag() == 0u);
+
+    node n;
+    p = &n;
+    CHECK(p);
+    CHECK(p.get() == &n);
+    CHECK(p.tag() == 0u);
+
+    p.set_tag(3u);
+    CHECK(p.get() == &n);
+    CHECK(p.tag() == 3u);
+    CHECK(&p->data == &n.data);
+    CHECK(&*p == &n);
+
+    // Tag bits beyond the width are ignored.
+    p.set_tag(6u);
+    CHECK(p.tag() == 2u);
+
+    node m;
+    p.set_pointer(&m);
+    CHECK(p.get() == &m);
+    CHECK(p.tag() == 2u);
+
+    // Assigning a pointer clears the tag.
+    p = &n;
+    CHECK(p.tag() == 0u);
+
+    neo::ptr<node> q = p;
+    CHECK(q == &n);
+
+    auto r = neo::make_tagged_ptr<2>(&n, 1u);
+    CHECK(r != p);
+    CHECK(r > p);
+    CHECK((r == neo::tagged_ptr<node, 2>(&n, 1u)));
+    CHECK((neo::tagged_ptr<node, 2>::from_raw(r.raw()) == r));
+}
+
+TEST_CASE("neo::tagged_ptr tags of more bits than the alignment", "neo::tagged_ptr")
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    char c[2] = {};
+
+    // char pointers are compared as void pointers, so that Catch does not
+    // print them as strings.
+    neo::tagged_ptr<char, 16> p(&c[1], 0xabcdu);
+    CHECK(sizeof(p) == sizeof(char*));
+    CHECK(static_cast<void*>(p.get()) == static_cast<void*>(&c[1]));
+    CHECK(p.tag() == 0xabcdu);
+
+    // 3 alignment bits and 15 upper bits.
+    neo::int64 x;
+    neo::tagged_ptr<neo::int64, 18> q(&x, 0x3ffffu);
+    CHECK(q.get() == &x);
+    CHECK(q.tag() == 0x3ffffu);
+    *q = 42;
+    CHECK(x == 42);
+#endif
+
+    derived d;
+    neo::tagged_ptr<derived, 3> pd(&d, 5u);
+    neo::tagged_ptr<base, 3> pb = pd;
+    CHECK(pb.get() == static_cast<base*>(&d));
+    CHECK(pb.tag() == 5u);
+    CHECK(pb == pd);
+}
@@ -0,0 +1,206 @@
+#include <neo/neo.hpp>
+#include <catch.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct widget
+{
+    int id;
+};
+
+} // namespace
+
+TEST_CASE("neo types are trivially relocatable", "neo::is_trivially_relocatable")
+{
+    CHECK(neo::is_trivially_relocatable<neo::int_>::value);
+    CHECK(neo::is_trivially_relocatable<neo::double_>::value);
+    CHECK(neo::is_trivially_relocatable<neo::ptr<widget>>::value);
+    CHECK(neo::is_trivially_relocatable<neo::ref<widget>>::value);
+    CHECK(neo::is_trivially_relocatable<neo::optional_ref<widget>>::value);
+
+    CHECK(!neo::is_trivially_relocatable<std::string>::value);
+
+#ifdef NEO_DETAIL_LIBSTDCXX_BITWISE_RELOCATABLE
+    CHECK(std::__is_bitwise_relocatable<neo::int_>::value);
+    CHECK(std::__is_bitwise_relocatable<neo::ptr<widget>>::value);
+    CHECK(std::__is_bitwise_relocatable<neo::ref<widget>>::value);
+    CHECK(std::__is_bitwise_relocatable<neo::optional_ref<widget>>::value);
+#endif
+}
+
+TEST_CASE("std::vector of neo types can reallocate", "neo::is_trivially_relocatable")
+{
+    widget w[3] = { { 0 }, { 1 }, { 2 } };
+    std::vector<neo::ref<widget>> v;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(w[i % 3]);
+    }
+
+    CHECK(v[0]->id == 0);
+    CHECK(v[998]->id == 2);
+    CHECK(v[999]->id == 0);
+}
+
+TEST_CASE("neo::vector is constructed", "neo::vector")
+{
+    SECTION("empty")
+    {
+        neo::vector<neo::int_> v;
+
+        CHECK(v.empty());
+        CHECK(v.capacity() == 0u);
+        CHECK(v.begin() == v.end());
+    }
+
+    SECTION("from a count")
+    {
+        neo::vector<neo::int_> v(100u);
+
+        REQUIRE(v.size() == 100u);
+        CHECK(v.front() == 0);
+        CHECK(v.back() == 0);
+    }
+
+    SECTION("from a count and a value")
+    {
+        neo::vector<neo::int_> v(100u, 7);
+
+        REQUIRE(v.size() == 100u);
+        CHECK(v[50] == 7);
+    }
+
+    SECTION("from an initializer list")
+    {
+        neo::vector<std::string> v = { "a", "b", "c" };
+
+        REQUIRE(v.size() == 3u);
+        CHECK(v[2] == "c");
+    }
+
+    SECTION("by copy and move")
+    {
+        neo::vector<neo::int_> v = { 1, 2, 3 };
+        neo::vector<neo::int_> c = v;
+        neo::vector<neo::int_> m = std::move(v);
+
+        CHECK(v.empty());
+        REQUIRE(c.size() == 3u);
+        REQUIRE(m.size() == 3u);
+        CHECK(c[1] == 2);
+        CHECK(m[2] == 3);
+
+        c = m;
+        CHECK(c.size() == 3u);
+    }
+}
+
+TEST_CASE("neo::vector grows", "neo::vector")
+{
+    SECTION("with trivially relocatable types")
+    {
+        widget w[3] = { { 0 }, { 1 }, { 2 } };
+        neo::vector<neo::ref<widget>> v;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.push_back(w[i % 3]);
+        }
+
+        REQUIRE(v.size() == 1000u);
+        CHECK(v.capacity() >= 1000u);
+        CHECK(v[0]->id == 0);
+        CHECK(v[998]->id == 2);
+    }
+
+    SECTION("with other types")
+    {
+        neo::vector<std::unique_ptr<int>> v;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            v.emplace_back(new int(i));
+        }
+
+        REQUIRE(v.size() == 1000u);
+        CHECK(*v[0] == 0);
+        CHECK(*v[999] == 999);
+    }
+
+    SECTION("from its own elements")
+    {
+        neo::vector<std::string> v = { "abc" };
+
+        for (int i = 0; i < 100; ++i)
+        {
+            v.push_back(v[0]);
+        }
+
+        CHECK(v[100] == "abc");
+    }
+
+    SECTION("by resizing")
+    {
+        neo::vector<neo::int_> v = { 1 };
+
+        v.resize(1000);
+        CHECK(v[0] == 1);
+        CHECK(v[999] == 0);
+
+        v.resize(2000, v[0]);
+        CHECK(v[1999] == 1);
+
+        v.resize(10);
+        CHECK(v.size() == 10u);
+
+        v.shrink_to_fit();
+        CHECK(v.capacity() == 10u);
+
+        v.reserve(100);
+        CHECK(v.capacity() == 100u);
+        CHECK(v[0] == 1);
+    }
+
+    SECTION("no further than an allocation can hold")
+    {
+        using vector_t = neo::vector<neo::int_>;
+
+        CHECK(vector_t::max_size() * sizeof(neo::int_) <= static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()));
+
+        vector_t v;
+        CHECK_THROWS_AS(v.reserve(vector_t::max_size() + 1), std::bad_alloc const&);
+    }
+}
+
+TEST_CASE("neo::vector erases elements", "neo::vector")
+{
+    neo::vector<neo::int_> v = { 0, 1, 2, 3, 4, 5 };
+
+    CHECK(*v.erase(v.begin() + 1) == 2);
+    CHECK(*v.erase(v.begin() + 2, v.begin() + 4) == 5);
+
+    REQUIRE(v.size() == 3u);
+    CHECK(v[0] == 0);
+    CHECK(v[1] == 2);
+    CHECK(v[2] == 5);
+
+    neo::vector<std::string> s = { "a", "b", "c" };
+    s.erase(s.begin());
+    REQUIRE(s.size() == 2u);
+    CHECK(s[0] == "b");
+
+    s.pop_back();
+    CHECK(s.back() == "b");
+
+    s.clear();
+    CHECK(s.empty());
+}
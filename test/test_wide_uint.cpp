@@ -0,0 +1,131 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+template<typename T>
+std::string to_string(T const& x)
+{
+    std::ostringstream s;
+    s << x;
+    return s.str();
+}
+
+} // namespace
+
+TEST_CASE("neo::wide_uint follows the value widening rules", "neo::wide_uint")
+{
+    CHECK(sizeof(neo::uint256) == 32);
+    CHECK(sizeof(neo::uint512) == 64);
+    CHECK((std::is_convertible<std::uint64_t, neo::uint256>::value));
+    CHECK((std::is_convertible<neo::uint64, neo::uint256>::value));
+    CHECK((std::is_convertible<neo::uint8, neo::uint512>::value));
+    CHECK((std::is_convertible<neo::uint256, neo::uint512>::value));
+    CHECK((!std::is_convertible<neo::uint512, neo::uint256>::value));
+    CHECK((!std::is_convertible<int, neo::uint256>::value));
+    CHECK((!std::is_convertible<neo::int64, neo::uint256>::value));
+    CHECK((!std::is_convertible<neo::uint256, std::uint64_t>::value));
+    CHECK((explicit_conversion_traits<neo::uint512, neo::uint256>::value));
+    CHECK((explicit_conversion_traits<neo::int64, neo::uint256>::value));
+    CHECK((explicit_conversion_traits<neo::uint256, neo::uint64>::value));
+    CHECK((std::is_same<decltype(neo::uint256() + neo::uint64()), neo::uint256>::value));
+    CHECK((std::is_same<decltype(std::uint32_t() * neo::uint256()), neo::uint256>::value));
+    CHECK((std::is_same<decltype(neo::uint256() - neo::uint512()), neo::uint512>::value));
+    CHECK((!add_traits<neo::uint256, int>::value));
+    CHECK((!add_traits<neo::uint256, neo::int64>::value));
+    CHECK((!add_traits<neo::uint256, double>::value));
+
+    CHECK(neo::uint256() == 0u);
+    CHECK(neo::uint256(-1) == ~neo::uint256());
+    CHECK(neo::uint256(neo::int32(-2)).limb(3) == ~std::uint64_t(0));
+    CHECK(static_cast<std::uint32_t>(neo::uint256(0x123456789u)) == 0x23456789u);
+    CHECK(static_cast<neo::uint64>(neo::uint512(neo::uint256(7u) << 200) >> 200) == 7u);
+    CHECK(neo::uint256(neo::uint512(1u) << 256) == 0u);
+}
+
+TEST_CASE("neo::wide_uint addition and subtraction carry between limbs", "neo::wide_uint")
+{
+    std::uint64_t const max64 = std::numeric_limits<std::uint64_t>::max();
+
+    neo::uint256 x = max64;
+    x += 1u;
+    CHECK(x.limb(0) == 0u);
+    CHECK(x.limb(1) == 1u);
+
+    neo::uint256 y = ~neo::uint256();
+    ++y;
+    CHECK(y == 0u);
+    --y;
+    CHECK(y == ~neo::uint256());
+    CHECK(y + neo::uint64(2u) == 1u);
+    CHECK(neo::uint256(0u) - 1u == y);
+    CHECK((neo::uint256(1u) << 192) - 1u == neo::uint256(max64) * (neo::uint256(1u) + (neo::uint256(1u) << 64) + (neo::uint256(1u) << 128)));
+    CHECK(-neo::uint256(5u) + 5u == 0u);
+}
+
+TEST_CASE("neo::wide_uint multiplication", "neo::wide_uint")
+{
+    std::uint64_t const max64 = std::numeric_limits<std::uint64_t>::max();
+    neo::uint256 const max128 = (neo::uint256(1u) << 128) - 1u;
+
+    // (2^128 - 1)^2 = 2^256 - 2^129 + 1
+    neo::uint256 const square = max128 * max128;
+    CHECK(square.limb(0) == 1u);
+    CHECK(square.limb(1) == 0u);
+    CHECK(square.limb(2) == max64 - 1);
+    CHECK(square.limb(3) == max64);
+
+    // Products wrap modulo 2^256.
+    neo::uint256 const all = ~neo::uint256();
+    CHECK(all * all == 1u);
+    CHECK(all * 3u == all - 2u);
+
+    neo::uint512 const full = neo::full_product(all, all);
+    CHECK(full == neo::uint512(0u) - (neo::uint512(1u) << 257) + 1u);
+    CHECK(neo::uint256(full >> 256) == all - 1u);
+
+    neo::uint256 z = 10u;
+    for (int i = 0; i < 70; ++i)
+    {
+        z *= 10u;
+    }
+    CHECK(to_string(z) == "1" + std::string(71, '0'));
+}
+
+TEST_CASE("neo::wide_uint bitwise operations and comparisons", "neo::wide_uint")
+{
+    neo::uint512 const x = neo::uint512(0xf0u) << 300;
+
+    CHECK((x >> 300) == 0xf0u);
+    CHECK((x >> 304) == 0xfu);
+    CHECK((x << 300) == 0u);
+    CHECK((x >> 512) == 0u);
+    CHECK((x << -1) == 0u);
+    CHECK((x | 1u) - x == 1u);
+    CHECK((x & ~(neo::uint512(1u) << 304)) == neo::uint512(0xe0u) << 300);
+    CHECK((x ^ x) == 0u);
+
+    CHECK(x > 0xffu);
+    CHECK(neo::uint64(1u) < x);
+    CHECK(x >= x);
+    CHECK(x != x + 1u);
+    CHECK(!(x < x));
+    CHECK((neo::uint256(1u) << 255) > (neo::uint256(1u) << 254));
+}
+
+TEST_CASE("neo::wide_uint is written in decimal", "neo::wide_uint")
+{
+    CHECK(to_string(neo::uint256()) == "0");
+    CHECK(to_string(neo::uint256(18446744073709551615u) + 1u) == "18446744073709551616");
+    CHECK(to_string(~neo::uint256()) == "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+}
@@ -0,0 +1,128 @@
+#include <neo/neo.hpp>
+#include <operator_traits.hpp>
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+using namespace neo_types::operator_traits;
+
+namespace
+{
+
+// Compares wrapping arithmetic with the unsigned arithmetic of the same width
+// for every pair of operands of an 8-bit type.
+template<typename T>
+bool matches_unsigned_arithmetic()
+{
+    using neo::policy::wrapping;
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    for (int i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); ++i)
+    {
+        for (int j = std::numeric_limits<T>::min(); j <= std::numeric_limits<T>::max(); ++j)
+        {
+            T const x = static_cast<T>(i);
+            T const y = static_cast<T>(j);
+            unsigned_type const ux = static_cast<unsigned_type>(x);
+            unsigned_type const uy = static_cast<unsigned_type>(y);
+
+            if (wrapping::add(x, y) != static_cast<T>(static_cast<unsigned_type>(ux + uy)) ||
+                wrapping::sub(x, y) != static_cast<T>(static_cast<unsigned_type>(ux - uy)) ||
+                wrapping::mul(x, y) != static_cast<T>(static_cast<unsigned_type>(ux * uy)))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("neo::wrapping wraps signed overflow", "neo::wrapping")
+{
+    neo::wrapping<std::int32_t> const max = std::numeric_limits<std::int32_t>::max();
+    neo::wrapping<std::int32_t> const min = std::numeric_limits<std::int32_t>::min();
+
+    CHECK((max + 1) == min);
+    CHECK((min - 1) == max);
+    CHECK((max * 2) == -2);
+    CHECK((min * -1) == min);
+    CHECK((min / -1) == min);
+    CHECK((min % -1) == 0);
+    CHECK(-min == min);
+    CHECK((std::is_same<decltype(max + 1), neo::wrapping<std::int32_t>>::value));
+}
+
+TEST_CASE("neo::wrapping does not promote operands", "neo::wrapping")
+{
+    neo::wrapping<std::int8_t> a = std::int8_t(100);
+
+    CHECK((a + a) == -56);
+    CHECK((a * a) == 16);
+
+    // unsigned short would otherwise be promoted to int, which overflows.
+    neo::wrapping<std::uint16_t> b = std::uint16_t(65535);
+
+    CHECK((b * b) == 1u);
+}
+
+TEST_CASE("neo::wrapping wraps compound assignment and increment", "neo::wrapping")
+{
+    neo::wrapping<std::int64_t> a = std::numeric_limits<std::int64_t>::max();
+
+    ++a;
+    CHECK(a == std::numeric_limits<std::int64_t>::min());
+    a--;
+    CHECK(a == std::numeric_limits<std::int64_t>::max());
+    a *= std::int64_t(3);
+    CHECK(a == std::numeric_limits<std::int64_t>::max() - 2);
+}
+
+TEST_CASE("neo::wrapping matches unsigned arithmetic", "neo::wrapping")
+{
+    CHECK(matches_unsigned_arithmetic<std::int8_t>());
+    CHECK(matches_unsigned_arithmetic<std::uint8_t>());
+}
+
+TEST_CASE("neo::wrapping is usable in constant expressions", "neo::wrapping")
+{
+    constexpr neo::wrapping<std::int16_t> a = std::int16_t(32767);
+    constexpr neo::wrapping<std::int16_t> b = a + std::int16_t(1);
+
+    CHECK(b == -32768);
+}
+
+TEST_CASE("neo::wrapping follows value rules", "neo::wrapping")
+{
+    CHECK((!add_traits<neo::wrapping<std::int32_t>, neo::wrapping<std::uint32_t>>::value));
+    CHECK((!add_traits<neo::wrapping<int>, neo::value<int>>::value));
+    CHECK((!std::is_convertible<neo::wrapping<std::int32_t>, neo::wrapping<std::int16_t>>::value));
+    CHECK((std::is_convertible<neo::wrapping<std::int16_t>, neo::wrapping<std::int32_t>>::value));
+    CHECK((explicit_conversion_traits<neo::value<int>, neo::wrapping<int>>::value));
+    CHECK((!bitand_traits<neo::wrapping<int>, neo::wrapping<int>>::value));
+    CHECK((bitand_traits<neo::wrapping<unsigned>, neo::wrapping<unsigned>>::value));
+}
+
+#if defined(NEO_DETAIL_INT128)
+
+TEST_CASE("neo::wrapping supports 128-bit integers", "neo::wrapping")
+{
+    using int128_t = neo::detail::int128_t;
+
+    neo::wrapping<int128_t> const max = neo::detail::numeric_limits<int128_t>::max();
+    neo::wrapping<int128_t> const min = neo::detail::numeric_limits<int128_t>::min();
+    neo::wrapping<int128_t> const a = (int128_t(1) << 100) + 1;
+
+    CHECK((a * a) == neo::wrapping<int128_t>((int128_t(1) << 101) + 1));
+    CHECK((max + 1) == min);
+    CHECK((min - 1) == max);
+    CHECK((min / -1) == min);
+    CHECK((min % -1) == 0);
+    CHECK(-min == min);
+}
+
+#endif